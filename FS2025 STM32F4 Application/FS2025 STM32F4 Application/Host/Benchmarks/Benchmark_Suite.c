@@ -0,0 +1,424 @@
+/**
+  ******************************************************************************
+  * @file           : Benchmark_Suite.c
+  * @brief          : Native timing of the Benchmark kernels with regression limits
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Control_Unit.h"
+#include "Battery_Pack_Control_Unit.h"
+#include "Channel_Filter.h"
+#include "LTC6811.h"
+#include "LTC6811_Simulator.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+// Same kernels and input sweep as the on-target Benchmark module, timed with
+// the host clock over batches: the batch grows until it lasts
+// BENCHMARK_SUITE_MIN_TIME_NS, then BENCHMARK_SUITE_REPETITIONS batches are
+// timed and the median is reported.
+#define BENCHMARK_SUITE_MIN_TIME_NS			20000000.0
+#define BENCHMARK_SUITE_REPETITIONS			5U
+#define BENCHMARK_SUITE_TOLERANCE				10.0		// % over the baseline file
+#define BENCHMARK_SUITE_NAME_SIZE				48U
+
+typedef struct
+{
+	const char*							Name;
+	Benchmark_Kernel_TypeDef	Kernel;
+	void										(*Loop)(uint32_t Iterations);
+	double									Limit_ns;				// Regression limit of one call
+} Benchmark_Suite_Case_TypeDef;
+
+typedef struct
+{
+	uint32_t	Iterations;
+	double		Median_ns;
+	double		Min_ns;
+	double		Max_ns;
+} Benchmark_Suite_Result_TypeDef;
+
+// Inputs of the runs, as Benchmark_Kernel builds them from the run index
+static uint8_t		Bench_Register[BENCHMARK_RUNS][LTC6811_REG_GROUP_SIZE];
+static float			Bench_Voltage[BENCHMARK_RUNS];
+static float			Bench_Temperature[BENCHMARK_RUNS];
+static float			Bench_Cell[BENCHMARK_RUNS];
+static uint32_t		Bench_Samples[CHANNEL_FILTER_PAIRS];
+static uint32_t		Bench_State[BENCHMARK_RUNS][CHANNEL_FILTER_PAIRS];
+static uint32_t		Bench_Alpha[CHANNEL_FILTER_PAIRS];
+static uint32_t		Bench_Failed[BENCHMARK_RUNS];
+static uint32_t		Bench_Hot[BENCHMARK_RUNS];
+
+// A unit after a few scans of the simulated chips, the status checks run on it
+static LTC6811_Simulator_TypeDef Bench_Chip[2];
+static Control_Unit_TypeDef Bench_Unit;
+
+// Results are stored here so the compiler cannot drop the timed calls
+static volatile uint32_t Bench_Sink;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Kernels                       ***************	
+********************************************************************************
+*******************************************************************************/
+static void Bench_PEC15(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Bench_Sink=LTC6811_PEC15_Calc(Bench_Register[i%BENCHMARK_RUNS],LTC6811_REG_GROUP_SIZE);
+	}
+}
+
+static void Bench_Voltage_To_Temperature(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Bench_Sink=(uint32_t)LTC_Voltage_to_Temperature(Bench_Voltage[i%BENCHMARK_RUNS]);
+	}
+}
+
+static void Bench_Encode_Temp(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Bench_Sink=LTC6811_Enconde_Temp(Bench_Temperature[i%BENCHMARK_RUNS]);
+	}
+}
+
+static void Bench_Encode_Volt(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Bench_Sink=LTC6811_Encode_Volt_10mV(Bench_Cell[i%BENCHMARK_RUNS]);
+	}
+}
+
+// The readings do not change, every call after the first is a scan of a
+// settled pack
+static void Bench_Check_Temperatures(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Battery_Pack_Control_Unit_Check_Temperatures(&Bench_Unit);
+	}
+	Bench_Sink=Bench_Unit.Status.Temperatures.Hot;
+}
+
+static void Bench_Check_Fails(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Bench_Unit.Status.Temperatures.Failed=Bench_Failed[i%BENCHMARK_RUNS];
+		Bench_Unit.Status.Temperatures.Hot=Bench_Hot[i%BENCHMARK_RUNS];
+		Battery_Pack_Control_Check_Fails(&Bench_Unit);
+	}
+	Bench_Sink=Bench_Unit.State;
+}
+
+static void Bench_Channel_Filter(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Channel_Filter_Run(Bench_Samples,Bench_State[i%BENCHMARK_RUNS],Bench_Alpha,CHANNEL_FILTER_PAIRS);
+	}
+	Bench_Sink=Bench_State[0][0];
+}
+
+static void Bench_Channel_Filter_Portable(uint32_t Iterations)
+{
+	for(uint32_t i=0; i<Iterations; i++)
+	{
+		Channel_Filter_Run_Portable(Bench_Samples,Bench_State[i%BENCHMARK_RUNS],Bench_Alpha,CHANNEL_FILTER_PAIRS);
+	}
+	Bench_Sink=Bench_State[0][0];
+}
+
+// Limits are about five times the times of a RelWithDebInfo build on a desktop
+// machine, they catch a kernel that got slower in kind, not in noise. The
+// baseline file does the fine comparison on one machine.
+static const Benchmark_Suite_Case_TypeDef Benchmark_Suite_Cases[BENCHMARK_KERNELS]=
+{
+	{"PEC15_Calc",															BENCHMARK_PEC15,										Bench_PEC15,										250.0},
+	{"LTC_Voltage_to_Temperature",							BENCHMARK_VOLTAGE_TO_TEMPERATURE,	Bench_Voltage_To_Temperature,		150.0},
+	{"LTC6811_Enconde_Temp",										BENCHMARK_ENCODE_TEMP,							Bench_Encode_Temp,							25.0},
+	{"LTC6811_Encode_Volt_10mV",								BENCHMARK_ENCODE_VOLT,							Bench_Encode_Volt,							25.0},
+	{"Battery_Pack_Control_Unit_Check_Temperatures",	BENCHMARK_CHECK_TEMPERATURES,			Bench_Check_Temperatures,				1000.0},
+	{"Battery_Pack_Control_Check_Fails",				BENCHMARK_CHECK_FAILS,							Bench_Check_Fails,							30.0},
+	{"Channel_Filter_Run",											BENCHMARK_CHANNEL_FILTER,						Bench_Channel_Filter,						350.0},
+	{"Channel_Filter_Run_Portable",							BENCHMARK_CHANNEL_FILTER_PORTABLE,	Bench_Channel_Filter_Portable,	350.0}
+};
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Functions                     ***************	
+********************************************************************************
+*******************************************************************************/
+static void Benchmark_Suite_Inputs(void)
+{
+	float Readings[BPCU_CHANNELS];
+
+	for(uint8_t Run=0; Run<BENCHMARK_RUNS; Run++)
+	{
+		float Input=(float)Run/(float)BENCHMARK_RUNS;
+
+		for(uint8_t i=0; i<LTC6811_REG_GROUP_SIZE; i++)
+		{
+			Bench_Register[Run][i]=(uint8_t)(Run*LTC6811_REG_GROUP_SIZE+i);
+		}
+		Bench_Voltage[Run]=3.0f*Input;
+		Bench_Temperature[Run]=-30.0f+150.0f*Input;
+		Bench_Cell[Run]=1.5f+3.5f*Input;
+		Bench_Failed[Run]=(Run & 1U) ? (1UL<<Run%BPCU_CHANNELS) : 0U;
+		Bench_Hot[Run]=(Run & 2U) ? (3UL<<Run%(BPCU_CHANNELS-1U)) : 0U;
+	}
+
+	// Pack settled at 30 degC, the filter states start Run degC over it
+	LTC6811_Simulator_Init(&Bench_Chip[0]);
+	LTC6811_Simulator_Init(&Bench_Chip[1]);
+	LTC6811_Simulator_Attach(&Bench_Chip[0],HOST_SPI_1);
+	LTC6811_Simulator_Attach(&Bench_Chip[1],HOST_SPI_2);
+	LTC6811_Simulator_Set_Temperatures(&Bench_Chip[0],30.0f);
+	LTC6811_Simulator_Set_Temperatures(&Bench_Chip[1],30.0f);
+	Host_Reset();
+	memset((void*)&CONTROL_UNIT,0,sizeof(CONTROL_UNIT));
+	Control_Unit_MCU_Init();
+	Control_Unit_Init();
+	Host_Run_ms(3000);
+	Bench_Unit=CONTROL_UNIT;
+
+	Channel_Filter_Pack(Bench_Unit.Status.Temperatures.Readed_Value,Bench_Samples,CHANNEL_FILTER_PAIRS);
+	for(uint8_t Run=0; Run<BENCHMARK_RUNS; Run++)
+	{
+		for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+		{
+			Readings[i]=Bench_Unit.Status.Temperatures.Readed_Value[i]+(float)Run;
+		}
+		Channel_Filter_Pack(Readings,Bench_State[Run],CHANNEL_FILTER_PAIRS);
+	}
+	for(uint8_t p=0; p<CHANNEL_FILTER_PAIRS; p++)
+	{
+		Bench_Alpha[p]=CHANNEL_FILTER_ALPHA_PAIR(0.1f,0.5f);
+	}
+}
+
+static double Benchmark_Suite_Time_ns(const Benchmark_Suite_Case_TypeDef* Case, uint32_t Iterations)
+{
+	struct timespec Start;
+	struct timespec Stop;
+
+	clock_gettime(CLOCK_MONOTONIC,&Start);
+	Case->Loop(Iterations);
+	clock_gettime(CLOCK_MONOTONIC,&Stop);
+	return (double)(Stop.tv_sec-Start.tv_sec)*1e9+(double)(Stop.tv_nsec-Start.tv_nsec);
+}
+
+static int Benchmark_Suite_Compare(const void* A, const void* B)
+{
+	double a=*(const double*)A;
+	double b=*(const double*)B;
+
+	return (a>b)-(a<b);
+}
+
+static Benchmark_Suite_Result_TypeDef Benchmark_Suite_Measure(const Benchmark_Suite_Case_TypeDef* Case)
+{
+	Benchmark_Suite_Result_TypeDef Result;
+	double Sample[BENCHMARK_SUITE_REPETITIONS];
+	uint32_t Iterations=1;
+
+	// Warm up and size the batch, ten times per step as google-benchmark does
+	while(Iterations<UINT32_MAX/10U)
+	{
+		double Time=Benchmark_Suite_Time_ns(Case,Iterations);
+
+		if(Time>=BENCHMARK_SUITE_MIN_TIME_NS)
+		{
+			break;
+		}
+		double Scale=(Time>0.0) ? 1.4*BENCHMARK_SUITE_MIN_TIME_NS/Time : 10.0;
+		Iterations=(uint32_t)((double)Iterations*((Scale>10.0) ? 10.0 : (Scale<2.0) ? 2.0 : Scale));
+	}
+
+	for(uint8_t r=0; r<BENCHMARK_SUITE_REPETITIONS; r++)
+	{
+		Sample[r]=Benchmark_Suite_Time_ns(Case,Iterations)/(double)Iterations;
+	}
+	qsort(Sample,BENCHMARK_SUITE_REPETITIONS,sizeof(double),Benchmark_Suite_Compare);
+
+	Result.Iterations=Iterations;
+	Result.Median_ns=Sample[BENCHMARK_SUITE_REPETITIONS/2U];
+	Result.Min_ns=Sample[0];
+	Result.Max_ns=Sample[BENCHMARK_SUITE_REPETITIONS-1U];
+	return Result;
+}
+
+// Baseline lines are "name ns", -1 if the kernel is not in the file
+static double Benchmark_Suite_Baseline(FILE* File, const char* Name)
+{
+	char Line_Name[BENCHMARK_SUITE_NAME_SIZE];
+	double Time;
+
+	if(File==NULL)
+	{
+		return -1.0;
+	}
+	rewind(File);
+	while(fscanf(File,"%47s %lf",Line_Name,&Time)==2)
+	{
+		if(strcmp(Line_Name,Name)==0)
+		{
+			return Time;
+		}
+	}
+	return -1.0;
+}
+
+static void Benchmark_Suite_Usage(void)
+{
+	printf("Benchmark_Suite [--save FILE] [--baseline FILE] [--tolerance PERCENT]\n");
+	printf("  Times the Benchmark kernels, fails if one is over its limit or, with a\n");
+	printf("  baseline saved on the same machine, slower than it by the tolerance.\n");
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(int argc, char** argv)
+{
+	const char* Save_Path=NULL;
+	const char* Baseline_Path=NULL;
+	double Tolerance=BENCHMARK_SUITE_TOLERANCE;
+	unsigned int Regressions=0;
+
+	for(int i=1; i<argc; i++)
+	{
+		if(strcmp(argv[i],"--save")==0 && i+1<argc)
+		{
+			Save_Path=argv[++i];
+		}
+		else if(strcmp(argv[i],"--baseline")==0 && i+1<argc)
+		{
+			Baseline_Path=argv[++i];
+		}
+		else if(strcmp(argv[i],"--tolerance")==0 && i+1<argc)
+		{
+			Tolerance=atof(argv[++i]);
+		}
+		else
+		{
+			Benchmark_Suite_Usage();
+			return 2;
+		}
+	}
+
+	FILE* Baseline=(Baseline_Path!=NULL) ? fopen(Baseline_Path,"r") : NULL;
+	FILE* Save=(Save_Path!=NULL) ? fopen(Save_Path,"w") : NULL;
+	if((Baseline_Path!=NULL && Baseline==NULL) || (Save_Path!=NULL && Save==NULL))
+	{
+		printf("cannot open %s\n",(Baseline_Path!=NULL && Baseline==NULL) ? Baseline_Path : Save_Path);
+		return 2;
+	}
+
+	Benchmark_Suite_Inputs();
+	printf("%-46s %10s %10s %10s %12s %10s\n","Kernel","Time","Min","Max","Iterations","Limit");
+	for(uint8_t k=0; k<BENCHMARK_KERNELS; k++)
+	{
+		const Benchmark_Suite_Case_TypeDef* Case=&Benchmark_Suite_Cases[k];
+		Benchmark_Suite_Result_TypeDef Result=Benchmark_Suite_Measure(Case);
+		double Reference=Benchmark_Suite_Baseline(Baseline,Case->Name);
+		BoolTypeDef Regressed=(Result.Median_ns>Case->Limit_ns) ? TRUE : FALSE;
+
+		printf("%-46s %7.1f ns %7.1f ns %7.1f ns %12u %7.0f ns",Case->Name,Result.Median_ns,Result.Min_ns,Result.Max_ns,
+			Result.Iterations,Case->Limit_ns);
+		if(Reference>0.0)
+		{
+			double Change=100.0*(Result.Median_ns-Reference)/Reference;
+
+			printf(" %+6.1f %%",Change);
+			if(Change>Tolerance)
+			{
+				Regressed=TRUE;
+			}
+		}
+		printf("%s\n",(Regressed==TRUE) ? "  REGRESSION" : "");
+		Regressions+=(Regressed==TRUE) ? 1U : 0U;
+
+		if(Save!=NULL)
+		{
+			fprintf(Save,"%s %.3f\n",Case->Name,Result.Median_ns);
+		}
+	}
+
+	if(Baseline!=NULL)
+	{
+		fclose(Baseline);
+	}
+	if(Save!=NULL)
+	{
+		fclose(Save);
+	}
+	printf("%u kernels, %u regressions\n",(unsigned int)BENCHMARK_KERNELS,Regressions);
+	return (Regressions==0U) ? 0 : 1;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Benchmark_Suite.c
+  * @brief          : Native timing of the Benchmark kernels with regression limits
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
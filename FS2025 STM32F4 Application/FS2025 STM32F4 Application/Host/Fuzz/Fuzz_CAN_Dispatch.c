@@ -0,0 +1,449 @@
+/**
+  ******************************************************************************
+  * @file           : Fuzz_CAN_Dispatch.c
+  * @brief          : Fuzz harness of the CAN receive dispatch and the state machine
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Fuzz_CAN_Dispatch.h"
+#include "Control_Unit.h"
+#include "LTC6811_Simulator.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+// Chip 1 holds the channels 0 to 11, chip 2 the channels 12 to 23
+static LTC6811_Simulator_TypeDef Fuzz_Chip_1;
+static LTC6811_Simulator_TypeDef Fuzz_Chip_2;
+
+// Every identifier the unit handles or sends, a frame step picks one by index
+static const uint32_t Fuzz_Known_Id[]=
+{
+	BPCU_INIT_MEASURE_DEF, BPCU_TEMP_1_DEF, BPCU_TEMP_2_DEF, BPCU_TEMP_3_DEF, BPCU_TEMP_4_DEF,
+	BPCU_VOLT_1_DEF, BPCU_VOLT_2_DEF, BPCU_VOLT_3_DEF, BPCU_FINISHED_MEASURE, BPCU_STATUS_DEF,
+	BPCU_CANCEL_SENSOR_1_DEF, BPCU_CANCEL_SENSOR_2_DEF, BPCU_CANCEL_SENSOR_3_DEF, BPCU_REBOOT_DEF,
+	BPCU_DIAG_REQUEST_DEF, BPCU_DIAG_RESPONSE_DEF, BPCU_STARTUP_DIAG_DEF, BPCU_THERMAL_TREND_DEF,
+	BPCU_CELL_STATS_DEF, BPCU_BALANCING_DEF, BPCU_CALIBRATION_DEF, BPCU_SELF_TEST_DEF,
+	BPCU_BALANCING_COMMAND_DEF, BPCU_NVM_WINDOW_DEF
+};
+
+#define FUZZ_KNOWN_IDS	(sizeof(Fuzz_Known_Id)/sizeof(Fuzz_Known_Id[0]))
+
+// What the frames sent so far should have done, checked after every step
+typedef struct
+{
+	uint32_t	Time_ms;
+	uint32_t	Disabled;					// Sensor mask the cancel frames leave
+	uint32_t	Frames;						// Accepted by the FIFO
+	uint32_t	Rejected;					// Not standard data frames of up to 8 bytes
+	uint32_t	Rx_Base;					// CAN statistics at boot, they outlive the unit
+	uint32_t	Rejected_Base;
+} Fuzz_Model_TypeDef;
+
+static Fuzz_Model_TypeDef Fuzz_Model;
+
+#define FUZZ_CHECK(Condition) \
+	do { \
+		if(!(Condition)) \
+		{ \
+			fprintf(stderr, "%s:%d: invariant failed: %s\n", __FILE__, __LINE__, #Condition); \
+			abort(); \
+		} \
+	} while(0)
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Steps                         ***************	
+********************************************************************************
+*******************************************************************************/
+static size_t Fuzz_Frame_Bytes(uint8_t Format)
+{
+	uint8_t DLC=Format & FUZZ_FORMAT_DLC;
+
+	if((Format & FUZZ_FORMAT_REMOTE)!=0U)
+	{
+		return 0;
+	}
+	return (DLC<8U) ? DLC : 8U;
+}
+
+size_t Fuzz_Step_Length(const uint8_t* Data, size_t Size)
+{
+	size_t Length;
+
+	if(Size==0U)
+	{
+		return 0;
+	}
+	switch(Data[0] & FUZZ_STEP_MASK)
+	{
+		case FUZZ_STEP_FRAME:
+			Length=(Size>=2U) ? 2U+Fuzz_Frame_Bytes(Data[1]) : 2U;
+		break;
+
+		case FUZZ_STEP_RAW_FRAME:
+			Length=(Size>=3U) ? 3U+Fuzz_Frame_Bytes(Data[2]) : 3U;
+		break;
+
+		case FUZZ_STEP_WAIT:
+			Length=1;
+		break;
+
+		default:
+			Length=2;
+		break;
+	}
+	return (Length<=Size) ? Length : 0U;
+}
+
+// Only standard data frames reach the dispatcher, the cancel frames of 8
+// bytes then set the sensors like Battery_Pack_Control_Unit_Cancel_Sensors
+static void Fuzz_Frame(uint32_t Id, uint8_t Format, const uint8_t* Payload)
+{
+	uint32_t IDE=((Format & FUZZ_FORMAT_EXTENDED)!=0U) ? CAN_ID_EXT : CAN_ID_STD;
+	uint32_t RTR=((Format & FUZZ_FORMAT_REMOTE)!=0U) ? CAN_RTR_REMOTE : CAN_RTR_DATA;
+	uint8_t DLC=Format & FUZZ_FORMAT_DLC;
+
+	if(Host_CAN1_Inject_Format(Id,IDE,RTR,DLC,Payload)==FALSE)
+	{
+		return;
+	}
+	Fuzz_Model.Frames++;
+	if(IDE!=CAN_ID_STD || RTR!=CAN_RTR_DATA || DLC>8U)
+	{
+		Fuzz_Model.Rejected++;
+		return;
+	}
+
+	uint8_t First;
+	switch(Id & 0x7FFU)
+	{
+		case BPCU_CANCEL_SENSOR_1_DEF: First=0*BPCU_CANCEL_SENSORS_PER_FRAME; break;
+		case BPCU_CANCEL_SENSOR_2_DEF: First=1*BPCU_CANCEL_SENSORS_PER_FRAME; break;
+		case BPCU_CANCEL_SENSOR_3_DEF: First=2*BPCU_CANCEL_SENSORS_PER_FRAME; break;
+		default: return;
+	}
+	if(DLC!=8U)
+	{
+		return;
+	}
+	for(uint8_t i=0; i<BPCU_CANCEL_SENSORS_PER_FRAME; i++)
+	{
+		if(Payload[i]==0x01)
+		{
+			Fuzz_Model.Disabled&=~(1UL<<(First+i));
+		}
+		else if(Payload[i]==0x02)
+		{
+			Fuzz_Model.Disabled|=1UL<<(First+i);
+		}
+	}
+}
+
+static void Fuzz_Sensor(uint8_t Channel, uint8_t Temperature)
+{
+	LTC6811_Simulator_TypeDef* Chip=(Channel<LTC6811_SIMULATOR_INPUTS) ? &Fuzz_Chip_1 : &Fuzz_Chip_2;
+	float Voltage=(Temperature==FUZZ_SENSOR_OPEN) ? FUZZ_SENSOR_OPEN_VOLTAGE :
+		LTC6811_Simulator_Sensor_Voltage(FUZZ_SENSOR_MIN+FUZZ_SENSOR_LSB*(float)Temperature);
+
+	Chip->Sensor[Channel%LTC6811_SIMULATOR_INPUTS]=LTC6811_Simulator_Constant(Voltage);
+}
+
+static void Fuzz_Wait(uint32_t Time_ms)
+{
+	if(Fuzz_Model.Time_ms+Time_ms>FUZZ_MAX_TIME_MS)
+	{
+		Time_ms=FUZZ_MAX_TIME_MS-Fuzz_Model.Time_ms;
+	}
+	Fuzz_Model.Time_ms+=Time_ms;
+	Host_Run_ms(Time_ms);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Invariants                    ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief The checks of Battery_Pack_Control_Unit_Check_Invariants, done here
+ * as well so a violation stops the run at the step that caused it, and what
+ * the model expects of the frames sent. Sent frames are taken from the log.
+ */
+static void Fuzz_Check_Invariants(void)
+{
+	const Control_Unit_TypeDef* Control_Unit=&CONTROL_UNIT;
+	const CAN_Bus_Statistics_TypeDef* Statistics=CAN1_Get_Statistics();
+	Host_CAN_Frame_TypeDef Frame;
+
+	FUZZ_CHECK(Host_Halted()==FALSE);
+	FUZZ_CHECK(Control_Unit->Diagnostics.Invariant_Violations==0U);
+	FUZZ_CHECK(Control_Unit->State<=TEMP_PLUS_60_FAIL_MODE);
+	FUZZ_CHECK(Control_Unit->Status.Read_Temperatures<=READING);
+	FUZZ_CHECK(Control_Unit->Status.Temperatures_Hot<=BPCU_CHANNELS);
+	FUZZ_CHECK(Control_Unit->Status.Temperatures_Failed<=BPCU_CHANNELS);
+	FUZZ_CHECK(((Control_Unit->Status.Temperatures.Disabled | Control_Unit->Status.Temperatures.Hot |
+		Control_Unit->Status.Temperatures.Failed | Control_Unit->Status.Temperatures.Stale) & ~BPCU_CHANNEL_MASK)==0U);
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		FUZZ_CHECK(Control_Unit->Status.Temperatures.Cont_Fail[i]<=3U);
+	}
+	FUZZ_CHECK(Control_Unit->Diagnostics.Request_DLC<=8U);
+	FUZZ_CHECK(Control_Unit->Tx_Message.DLC<=8U);
+
+	FUZZ_CHECK(Control_Unit->Status.Temperatures.Disabled==Fuzz_Model.Disabled);
+	FUZZ_CHECK(Statistics->Rx_Frames+CAN1_Rx_Overflows()-Fuzz_Model.Rx_Base==Fuzz_Model.Frames);
+	FUZZ_CHECK(Statistics->Rx_Rejected-Fuzz_Model.Rejected_Base==Fuzz_Model.Rejected);
+
+	while(Host_CAN1_Take(&Frame)==TRUE)
+	{
+		FUZZ_CHECK(Frame.Id<=0x7FFU && Frame.DLC<=8U);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Boot                          ***************	
+********************************************************************************
+*******************************************************************************/
+// Every input starts from the same board: blank flash, both chips as they
+// power up and the unit just out of Control_Unit_Init
+static void Fuzz_Boot(void)
+{
+	const Host_Statistics_TypeDef* Statistics=Host_Get_Statistics();
+
+	if(Statistics->Flash_Erases!=0U || Statistics->Flash_Programs!=0U)
+	{
+		Host_Flash_Erase_All();
+	}
+	LTC6811_Simulator_Init(&Fuzz_Chip_1);
+	LTC6811_Simulator_Init(&Fuzz_Chip_2);
+	Host_Reset();
+	memset((void*)&CONTROL_UNIT,0,sizeof(CONTROL_UNIT));
+	Control_Unit_MCU_Init();
+	Control_Unit_Init();
+
+	memset(&Fuzz_Model,0,sizeof(Fuzz_Model));
+	Fuzz_Model.Disabled=CONTROL_UNIT.Status.Temperatures.Disabled;
+	Fuzz_Model.Rx_Base=CAN1_Get_Statistics()->Rx_Frames+CAN1_Rx_Overflows();
+	Fuzz_Model.Rejected_Base=CAN1_Get_Statistics()->Rx_Rejected;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Entry Points                  ***************	
+********************************************************************************
+*******************************************************************************/
+int LLVMFuzzerInitialize(int* argc, char*** argv)
+{
+	LTC6811_Simulator_Attach(&Fuzz_Chip_1,HOST_SPI_1);
+	LTC6811_Simulator_Attach(&Fuzz_Chip_2,HOST_SPI_2);
+	return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t* Data, size_t Size)
+{
+	size_t Length;
+
+	if(Size>FUZZ_MAX_LENGTH)
+	{
+		return -1;
+	}
+	Fuzz_Boot();
+	for(size_t Offset=0; (Length=Fuzz_Step_Length(&Data[Offset],Size-Offset))!=0U; Offset+=Length)
+	{
+		const uint8_t* Step=&Data[Offset];
+		uint8_t Argument=Step[0] & FUZZ_STEP_ARGUMENT;
+
+		switch(Step[0] & FUZZ_STEP_MASK)
+		{
+			case FUZZ_STEP_FRAME:
+				Fuzz_Frame(Fuzz_Known_Id[Argument%FUZZ_KNOWN_IDS],Step[1],&Step[2]);
+			break;
+
+			case FUZZ_STEP_RAW_FRAME:
+				Fuzz_Frame(((uint32_t)Argument<<8) | Step[1],Step[2],&Step[3]);
+			break;
+
+			case FUZZ_STEP_WAIT:
+				Fuzz_Wait(Argument);
+			break;
+
+			default:
+				Fuzz_Sensor(Argument%BPCU_CHANNELS,Step[1]);
+			break;
+		}
+		Fuzz_Check_Invariants();
+	}
+	return 0;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Mutator                       ***************	
+********************************************************************************
+*******************************************************************************/
+static uint32_t Fuzz_Random_State;
+
+static uint32_t Fuzz_Random(uint32_t Range)
+{
+	Fuzz_Random_State^=Fuzz_Random_State<<13;
+	Fuzz_Random_State^=Fuzz_Random_State>>17;
+	Fuzz_Random_State^=Fuzz_Random_State<<5;
+	return Fuzz_Random_State%Range;
+}
+
+// Payloads the handlers accept: services and pages, commands and channels,
+// the enable and disable codes of the cancel frames, the balancing switch
+static void Fuzz_Payload(uint32_t Id, uint8_t* Payload)
+{
+	for(uint8_t i=0; i<8U; i++)
+	{
+		Payload[i]=(uint8_t)Fuzz_Random(256);
+	}
+	switch(Id)
+	{
+		case BPCU_DIAG_REQUEST_DEF:
+			Payload[0]=(uint8_t)(1U+Fuzz_Random(DIAG_SERVICE_SUM_CHECK));
+			Payload[1]=(uint8_t)Fuzz_Random(BPCU_CHANNELS+1U);
+			Payload[2]=(Fuzz_Random(8)==0U) ? 0xFFU : (uint8_t)Fuzz_Random(0x12);
+		break;
+
+		case BPCU_CALIBRATION_DEF:
+			Payload[0]=(uint8_t)(1U+Fuzz_Random(CALIBRATION_DEFAULTS));
+			Payload[1]=(Fuzz_Random(4)==0U) ? CALIBRATION_ALL_CHANNELS : (uint8_t)Fuzz_Random(BPCU_CHANNELS+1U);
+		break;
+
+		case BPCU_CANCEL_SENSOR_1_DEF:
+		case BPCU_CANCEL_SENSOR_2_DEF:
+		case BPCU_CANCEL_SENSOR_3_DEF:
+			for(uint8_t i=0; i<8U; i++)
+			{
+				Payload[i]=(uint8_t)Fuzz_Random(3);
+			}
+		break;
+
+		case BPCU_BALANCING_COMMAND_DEF:
+		case BPCU_NVM_WINDOW_DEF:
+			Payload[0]=(uint8_t)Fuzz_Random(2);
+		break;
+	}
+}
+
+/**
+ * @brief Byte level mutations most of the time, otherwise a whole step put
+ * between two steps: a frame the unit handles with a payload it accepts, a
+ * wait or a sensor change. Random bytes alone rarely get past the service
+ * and command checks.
+ */
+size_t LLVMFuzzerCustomMutator(uint8_t* Data, size_t Size, size_t Max_Size, unsigned int Seed)
+{
+	uint8_t Step[2+8];
+	size_t Length=0;
+	size_t Offset=0;
+	size_t Boundary;
+
+	Fuzz_Random_State=Seed | 1U;
+	if(Fuzz_Random(3)!=0U)
+	{
+		return LLVMFuzzerMutate(Data,Size,Max_Size);
+	}
+
+	switch(Fuzz_Random(4))
+	{
+		case 0:
+		case 1:
+		{
+			uint8_t Index=(uint8_t)Fuzz_Random(FUZZ_KNOWN_IDS);
+			uint8_t DLC=(Fuzz_Random(4)==0U) ? (uint8_t)Fuzz_Random(16) : 8U;
+
+			Step[0]=FUZZ_STEP_FRAME | Index;
+			Step[1]=DLC;
+			Fuzz_Payload(Fuzz_Known_Id[Index],&Step[2]);
+			Length=2U+Fuzz_Frame_Bytes(DLC);
+		}
+		break;
+
+		case 2:
+			Step[0]=FUZZ_STEP_WAIT | (uint8_t)Fuzz_Random(FUZZ_STEP_ARGUMENT+1U);
+			Length=1;
+		break;
+
+		default:
+			Step[0]=FUZZ_STEP_SENSOR | (uint8_t)Fuzz_Random(BPCU_CHANNELS);
+			Step[1]=(uint8_t)Fuzz_Random(256);
+			Length=2;
+		break;
+	}
+	if(Size+Length>Max_Size)
+	{
+		return LLVMFuzzerMutate(Data,Size,Max_Size);
+	}
+
+	// Any step boundary up to the first broken step
+	Boundary=Fuzz_Random((uint32_t)Size+1U);
+	for(size_t Next; Offset<Boundary && (Next=Fuzz_Step_Length(&Data[Offset],Size-Offset))!=0U; Offset+=Next)
+	{
+	}
+	memmove(&Data[Offset+Length],&Data[Offset],Size-Offset);
+	memcpy(&Data[Offset],Step,Length);
+	return Size+Length;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Fuzz_CAN_Dispatch.c
+  * @brief          : Fuzz harness of the CAN receive dispatch and the state machine
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,119 @@
+/**
+  ******************************************************************************
+  * @file           : Fuzz_CAN_Dispatch.h
+  * @brief          : Input format and entry points of the CAN receive fuzz harness
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef FUZZ_CAN_DISPATCH_H
+#define FUZZ_CAN_DISPATCH_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Input Format                  ***************	
+********************************************************************************
+*******************************************************************************/
+/*
+ * An input is a sequence of steps run on a unit booted from a blank flash.
+ * The two top bits of the first byte give the step, its low six bits the
+ * argument. A step cut short by the end of the input is not run.
+ *
+ *  Frame:      Step | Known identifier, Format, Data[min(DLC,8)]
+ *  Raw frame:  Step | Identifier bits 13..8, Identifier bits 7..0, Format, Data[min(DLC,8)]
+ *  Wait:       Step | Main loop time (ms), 0 sends the next frame in the same pass
+ *  Sensor:     Step | Channel, Temperature
+ *
+ * Remote frames carry no data bytes. Standard frames keep the 11 low bits of
+ * a raw identifier, extended frames all of them.
+ */
+#define FUZZ_STEP_MASK					0xC0U
+#define FUZZ_STEP_ARGUMENT			0x3FU
+#define FUZZ_STEP_FRAME					0x00U
+#define FUZZ_STEP_RAW_FRAME			0x40U
+#define FUZZ_STEP_WAIT					0x80U
+#define FUZZ_STEP_SENSOR				0xC0U
+
+#define FUZZ_FORMAT_DLC					0x0FU		// 9 to 15 as the bxCAN gives them
+#define FUZZ_FORMAT_EXTENDED		0x10U
+#define FUZZ_FORMAT_REMOTE			0x20U
+
+// Temperature byte: FUZZ_SENSOR_LSB steps from FUZZ_SENSOR_MIN, the last
+// value is a sensor off the curve as an open input reads
+#define FUZZ_SENSOR_MIN					(-20.0f)	//degC
+#define FUZZ_SENSOR_LSB					0.5f			//degC
+#define FUZZ_SENSOR_OPEN				0xFFU
+#define FUZZ_SENSOR_OPEN_VOLTAGE	3.0f			//V
+
+// Virtual time of one input, the waits past it are cut
+#define FUZZ_MAX_TIME_MS				5000U
+#define FUZZ_MAX_LENGTH					4096U
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Entry Points                  ***************	
+********************************************************************************
+*******************************************************************************/
+// The libFuzzer interface, Fuzz_Driver.c provides the engine side without it
+int			LLVMFuzzerInitialize				(int* argc, char*** argv);
+int			LLVMFuzzerTestOneInput			(const uint8_t* Data, size_t Size);
+size_t	LLVMFuzzerCustomMutator			(uint8_t* Data, size_t Size, size_t Max_Size, unsigned int Seed);
+size_t	LLVMFuzzerMutate						(uint8_t* Data, size_t Size, size_t Max_Size);
+
+// Bytes of the step at Data, 0 if the input ends inside it
+size_t	Fuzz_Step_Length						(const uint8_t* Data, size_t Size);
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Fuzz_CAN_Dispatch.h
+  * @brief          : Input format and entry points of the CAN receive fuzz harness
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,402 @@
+/**
+  ******************************************************************************
+  * @file           : Fuzz_Corpus.c
+  * @brief          : Seed inputs of the CAN fuzz harness from bus traffic and captures
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Fuzz_CAN_Dispatch.h"
+#include "Node_Image.h"
+#include "CAN_Bus_Simulator.h"
+#include "Capture_Replayer.h"
+#include <dlfcn.h>
+#include <stdio.h>
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+#define FUZZ_CORPUS_UNITS				4U
+#define FUZZ_CORPUS_BUS_MS			3000U
+#define FUZZ_CORPUS_WINDOW_MS		1000U			// Bus traffic of one seed
+#define FUZZ_CORPUS_RECORDS			65536U
+
+static const char* const Fuzz_Corpus_Node_Path[FUZZ_CORPUS_UNITS]={FUZZ_NODE_1,FUZZ_NODE_2,FUZZ_NODE_3,FUZZ_NODE_4};
+static const Node_Image_TypeDef* Fuzz_Corpus_Node[FUZZ_CORPUS_UNITS];
+
+// Port 0 is the master, port n the unit n
+static CAN_Bus_Simulator_TypeDef Fuzz_Corpus_Bus;
+static CAN_Bus_Master_TypeDef Fuzz_Corpus_Master;
+static Capture_Record_TypeDef Fuzz_Corpus_Capture[FUZZ_CORPUS_RECORDS];
+
+// One seed being written, Time_ms is where its waits got to
+typedef struct
+{
+	uint8_t		Data[FUZZ_MAX_LENGTH];
+	size_t		Size;
+	uint32_t	Time_ms;
+} Fuzz_Corpus_Seed_TypeDef;
+
+static Fuzz_Corpus_Seed_TypeDef Fuzz_Corpus_Seed;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Seed Steps                    ***************	
+********************************************************************************
+*******************************************************************************/
+static void Fuzz_Corpus_Start(void)
+{
+	memset(&Fuzz_Corpus_Seed,0,sizeof(Fuzz_Corpus_Seed));
+}
+
+static BoolTypeDef Fuzz_Corpus_Put(const uint8_t* Step, size_t Length)
+{
+	if(Fuzz_Corpus_Seed.Size+Length>FUZZ_MAX_LENGTH)
+	{
+		return FALSE;
+	}
+	memcpy(&Fuzz_Corpus_Seed.Data[Fuzz_Corpus_Seed.Size],Step,Length);
+	Fuzz_Corpus_Seed.Size+=Length;
+	return TRUE;
+}
+
+static void Fuzz_Corpus_Wait_Until(uint32_t Time_ms)
+{
+	while(Fuzz_Corpus_Seed.Time_ms<Time_ms)
+	{
+		uint32_t Wait=Time_ms-Fuzz_Corpus_Seed.Time_ms;
+		uint8_t Step=FUZZ_STEP_WAIT | (uint8_t)((Wait<FUZZ_STEP_ARGUMENT) ? Wait : FUZZ_STEP_ARGUMENT);
+
+		if(Fuzz_Corpus_Put(&Step,1)==FALSE)
+		{
+			return;
+		}
+		Fuzz_Corpus_Seed.Time_ms+=Step & FUZZ_STEP_ARGUMENT;
+	}
+}
+
+// Standard data frames as raw frames, the harness table is not needed
+static void Fuzz_Corpus_Frame(uint32_t Time_ms, uint32_t Id, uint8_t DLC, const uint8_t* Data)
+{
+	uint8_t Step[3+8];
+
+	Fuzz_Corpus_Wait_Until(Time_ms);
+	Step[0]=FUZZ_STEP_RAW_FRAME | (uint8_t)((Id>>8) & FUZZ_STEP_ARGUMENT);
+	Step[1]=(uint8_t)Id;
+	Step[2]=DLC & FUZZ_FORMAT_DLC;
+	memcpy(&Step[3],Data,(DLC<8U) ? DLC : 8U);
+	Fuzz_Corpus_Put(Step,3U+((DLC<8U) ? DLC : 8U));
+}
+
+static void Fuzz_Corpus_Sensor(uint32_t Time_ms, uint8_t Channel, float Temperature)
+{
+	uint8_t Step[2];
+
+	Fuzz_Corpus_Wait_Until(Time_ms);
+	Step[0]=FUZZ_STEP_SENSOR | Channel;
+	Step[1]=(uint8_t)((Temperature-FUZZ_SENSOR_MIN)/FUZZ_SENSOR_LSB);
+	Fuzz_Corpus_Put(Step,2);
+}
+
+static BoolTypeDef Fuzz_Corpus_Save(const char* Directory, const char* Name)
+{
+	char Path[4096];
+	FILE* File;
+
+	snprintf(Path,sizeof(Path),"%s/%s",Directory,Name);
+	File=fopen(Path,"wb");
+	if(File==NULL || fwrite(Fuzz_Corpus_Seed.Data,1,Fuzz_Corpus_Seed.Size,File)!=Fuzz_Corpus_Seed.Size)
+	{
+		printf("%s: not written\n",Path);
+		if(File!=NULL)
+		{
+			fclose(File);
+		}
+		return FALSE;
+	}
+	fclose(File);
+	printf("%s: %zu bytes, %u ms\n",Path,Fuzz_Corpus_Seed.Size,Fuzz_Corpus_Seed.Time_ms);
+	return TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Bus Traffic                   ***************	
+********************************************************************************
+*******************************************************************************/
+static BoolTypeDef Fuzz_Corpus_Node_Pending(void* Context, Host_CAN_Frame_TypeDef* Frame)
+{
+	return ((const Node_Image_TypeDef*)Context)->Pending(Frame);
+}
+
+static void Fuzz_Corpus_Node_Transmitted(void* Context)
+{
+	((const Node_Image_TypeDef*)Context)->Transmitted();
+}
+
+static void Fuzz_Corpus_Node_Receive(void* Context, const Host_CAN_Frame_TypeDef* Frame)
+{
+	((const Node_Image_TypeDef*)Context)->Receive(Frame);
+}
+
+static BoolTypeDef Fuzz_Corpus_Load_Images(void)
+{
+	for(uint8_t i=0; i<FUZZ_CORPUS_UNITS; i++)
+	{
+		void* Handle=dlopen(Fuzz_Corpus_Node_Path[i],RTLD_NOW | RTLD_LOCAL);
+		Node_Image_Get_TypeDef Get=(Handle!=NULL) ? (Node_Image_Get_TypeDef)dlsym(Handle,NODE_IMAGE_SYMBOL) : NULL;
+
+		if(Get==NULL)
+		{
+			printf("%s: %s\n",Fuzz_Corpus_Node_Path[i],dlerror());
+			return FALSE;
+		}
+		Fuzz_Corpus_Node[i]=Get();
+	}
+	return TRUE;
+}
+
+/**
+ * @brief The car as the script of the master: the scan chain started every
+ * 500 ms, diagnostic reads, a sensor cancelled and enabled again, the
+ * calibration defaults and balancing. The four units answer and chain their
+ * scans, all of it is what unit 1 receives.
+ */
+static void Fuzz_Corpus_Script(CAN_Bus_Master_TypeDef* Master)
+{
+	const uint8_t Start[1]={0x01};
+	const uint8_t Diagnostics[][3]=
+	{
+		{DIAG_SERVICE_CAN,0,2}, {DIAG_SERVICE_INVARIANTS,0,0}, {DIAG_SERVICE_SCAN_SCHEDULER,0,4},
+		{DIAG_SERVICE_CAPTURE,0,DIAG_CAPTURE_PAGE_COUNT}, {DIAG_SERVICE_SELF_TEST,1,0},
+		{DIAG_SERVICE_CELL_STATS,3,1}, {DIAG_SERVICE_SUM_CHECK,0,0}
+	};
+	const uint8_t Cancel[8]={0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00};
+	const uint8_t Enable[8]={0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00};
+	const uint8_t Calibration[8]={CALIBRATION_DEFAULTS,CALIBRATION_ALL_CHANNELS,0,0,0,0,0,0};
+	const uint8_t Balancing[8]={0x01,0x64,0x00,0x98,0x8A,0x00,0x00,0x00};
+
+	CAN_Bus_Master_Add(Master,100,500,BPCU_INIT_MEASURE_DEF,1,Start);
+	for(uint8_t i=0; i<sizeof(Diagnostics)/sizeof(Diagnostics[0]); i++)
+	{
+		CAN_Bus_Master_Add(Master,150U+100U*i,0,BPCU_DIAG_REQUEST_DEF,3,Diagnostics[i]);
+	}
+	CAN_Bus_Master_Add(Master,1250,0,BPCU_CANCEL_SENSOR_1_DEF,8,Cancel);
+	CAN_Bus_Master_Add(Master,1800,0,BPCU_CANCEL_SENSOR_1_DEF,8,Enable);
+	CAN_Bus_Master_Add(Master,2200,0,BPCU_CALIBRATION_DEF,8,Calibration);
+	CAN_Bus_Master_Add(Master,2600,0,BPCU_BALANCING_COMMAND_DEF,8,Balancing);
+}
+
+static BoolTypeDef Fuzz_Corpus_Bus_Traffic(const char* Directory)
+{
+	CAN_Bus_Simulator_Port_TypeDef Port;
+	uint32_t Index=0;
+	uint32_t Window=0;
+	BoolTypeDef Saved=TRUE;
+
+	if(Fuzz_Corpus_Load_Images()==FALSE)
+	{
+		return FALSE;
+	}
+	CAN_Bus_Simulator_Init(&Fuzz_Corpus_Bus,HOST_CAN1_BITRATE);
+	CAN_Bus_Master_Init(&Fuzz_Corpus_Master,&Fuzz_Corpus_Bus);
+	Port=CAN_Bus_Master_Port(&Fuzz_Corpus_Master,"Master");
+	CAN_Bus_Simulator_Add_Port(&Fuzz_Corpus_Bus,&Port);
+	for(uint8_t i=0; i<FUZZ_CORPUS_UNITS; i++)
+	{
+		CAN_Bus_Simulator_Port_TypeDef Unit=
+		{
+			.Name="Unit",
+			.Context=(void*)Fuzz_Corpus_Node[i],
+			.Pending=Fuzz_Corpus_Node_Pending,
+			.Transmitted=Fuzz_Corpus_Node_Transmitted,
+			.Receive=Fuzz_Corpus_Node_Receive
+		};
+		CAN_Bus_Simulator_Add_Port(&Fuzz_Corpus_Bus,&Unit);
+		Fuzz_Corpus_Node[i]->Boot();
+		Fuzz_Corpus_Node[i]->Set_Temperatures(20.0f+5.0f*(float)Fuzz_Corpus_Node[i]->Unit);
+	}
+	Fuzz_Corpus_Script(&Fuzz_Corpus_Master);
+
+	// The log is read every ms, each window of it is one seed from the boot on
+	Fuzz_Corpus_Start();
+	for(uint32_t ms=1; ms<=FUZZ_CORPUS_BUS_MS; ms++)
+	{
+		CAN_Bus_Master_Update(&Fuzz_Corpus_Master);
+		for(uint8_t i=0; i<FUZZ_CORPUS_UNITS; i++)
+		{
+			Fuzz_Corpus_Node[i]->Run_Until((uint64_t)ms*1000U);
+		}
+		CAN_Bus_Simulator_Run(&Fuzz_Corpus_Bus,(uint64_t)ms*1000U);
+
+		for(const CAN_Bus_Simulator_Record_TypeDef* Record; (Record=CAN_Bus_Simulator_Record(&Fuzz_Corpus_Bus,Index))!=NULL; Index++)
+		{
+			if(Record->Port!=1U)
+			{
+				Fuzz_Corpus_Frame((uint32_t)(Record->Time_us/1000U)-Window*FUZZ_CORPUS_WINDOW_MS,Record->Frame.Id,Record->Frame.DLC,Record->Frame.Data);
+			}
+		}
+		if(ms%FUZZ_CORPUS_WINDOW_MS==0U)
+		{
+			char Name[32];
+
+			Fuzz_Corpus_Wait_Until(FUZZ_CORPUS_WINDOW_MS);
+			snprintf(Name,sizeof(Name),"bus-%u",Window);
+			Saved=(Fuzz_Corpus_Save(Directory,Name)==TRUE) ? Saved : FALSE;
+			Fuzz_Corpus_Start();
+			Window++;
+		}
+	}
+	return Saved;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Sensors                       ***************	
+********************************************************************************
+*******************************************************************************/
+// A channel heating up to the fail modes and an open channel, with the scan
+// chain started like the master does
+static BoolTypeDef Fuzz_Corpus_Sensors(const char* Directory)
+{
+	const uint8_t Start[1]={0x01};
+	BoolTypeDef Saved;
+
+	Fuzz_Corpus_Start();
+	for(uint32_t Time=100; Time<=3000U; Time+=100U)
+	{
+		if(Time%250U==0U)
+		{
+			Fuzz_Corpus_Sensor(Time,5,25.0f+5.0f*(float)(Time/250U));
+		}
+		Fuzz_Corpus_Frame(Time,BPCU_INIT_MEASURE_DEF,1,Start);
+	}
+	Fuzz_Corpus_Wait_Until(3500);
+	Saved=Fuzz_Corpus_Save(Directory,"sensor-hot");
+
+	Fuzz_Corpus_Start();
+	Fuzz_Corpus_Wait_Until(200);
+	uint8_t Open[2]={FUZZ_STEP_SENSOR | 14U, FUZZ_SENSOR_OPEN};
+	Fuzz_Corpus_Put(Open,2);
+	for(uint32_t Time=300; Time<=2000U; Time+=100U)
+	{
+		Fuzz_Corpus_Frame(Time,BPCU_INIT_MEASURE_DEF,1,Start);
+	}
+	Fuzz_Corpus_Wait_Until(2500);
+	return (Fuzz_Corpus_Save(Directory,"sensor-open")==TRUE) ? Saved : FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Captures                      ***************	
+********************************************************************************
+*******************************************************************************/
+// The frames a unit received, from a capture read over CAN or saved by the
+// replayer, at their time from the first record
+static BoolTypeDef Fuzz_Corpus_Capture_Frames(const char* Directory, const char* Path)
+{
+	uint32_t Count=Capture_Replayer_Load(Path,Fuzz_Corpus_Capture,FUZZ_CORPUS_RECORDS);
+	const char* Name=strrchr(Path,'/');
+	char Seed_Name[256];
+
+	if(Count==0U)
+	{
+		printf("%s: no records\n",Path);
+		return FALSE;
+	}
+	Fuzz_Corpus_Start();
+	for(uint32_t i=0; i<Count; i++)
+	{
+		const Capture_Record_TypeDef* Record=&Fuzz_Corpus_Capture[i];
+
+		if(Record->Source==CAPTURE_CAN_RX)
+		{
+			Fuzz_Corpus_Frame(Record->Timestamp-Fuzz_Corpus_Capture[0].Timestamp,Record->Id,Record->Flags,Record->Data);
+		}
+	}
+	snprintf(Seed_Name,sizeof(Seed_Name),"capture-%s",(Name!=NULL) ? Name+1 : Path);
+	return Fuzz_Corpus_Save(Directory,Seed_Name);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(int argc, char** argv)
+{
+	BoolTypeDef Saved;
+
+	if(argc<2)
+	{
+		printf("Fuzz_Corpus DIRECTORY [CAPTURE...]\n");
+		printf("  Writes the seeds of Fuzz_CAN_Dispatch: the traffic of the four units and\n");
+		printf("  the master on the simulated bus, sensor changes, and the frames received\n");
+		printf("  in each capture.\n");
+		return 2;
+	}
+	Saved=Fuzz_Corpus_Bus_Traffic(argv[1]);
+	Saved=(Fuzz_Corpus_Sensors(argv[1])==TRUE) ? Saved : FALSE;
+	for(int i=2; i<argc; i++)
+	{
+		Saved=(Fuzz_Corpus_Capture_Frames(argv[1],argv[i])==TRUE) ? Saved : FALSE;
+	}
+	return (Saved==TRUE) ? 0 : 1;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Fuzz_Corpus.c
+  * @brief          : Seed inputs of the CAN fuzz harness from bus traffic and captures
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
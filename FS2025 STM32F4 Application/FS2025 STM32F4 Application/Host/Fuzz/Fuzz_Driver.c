@@ -0,0 +1,749 @@
+/**
+  ******************************************************************************
+  * @file           : Fuzz_Driver.c
+  * @brief          : Coverage guided fuzz engine for toolchains without libFuzzer
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Fuzz_CAN_Dispatch.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__SANITIZE_ADDRESS__)
+#include <sanitizer/common_interface_defs.h>
+#endif
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+/*
+ * The same command line as a libFuzzer binary for the options below, the
+ * first corpus directory gets the new inputs:
+ *
+ *   Fuzz_CAN_Dispatch [-runs=N] [-max_total_time=S] [-seed=N] [-max_len=N]
+ *                     [-timeout=S] [-artifact_prefix=P] DIR... | FILE...
+ *
+ * Files only run each one once, to reproduce a crash.
+ */
+#define FUZZ_MAP_SIZE				65536U
+#define FUZZ_MUTATIONS			4U				// Most mutations stacked on one input
+#define FUZZ_ERROR_EXIT			77
+#define FUZZ_TIMEOUT_EXIT		70
+
+typedef struct
+{
+	uint8_t*	Data;
+	size_t		Size;
+} Fuzz_Unit_TypeDef;
+
+typedef struct
+{
+	long long		Runs;							// -1 no limit
+	uint32_t		Max_Total_Time;		// s, 0 no limit
+	uint32_t		Seed;
+	size_t			Max_Len;
+	uint32_t		Timeout;					// s per input, 0 no limit
+	const char*	Artifact_Prefix;
+} Fuzz_Options_TypeDef;
+
+static Fuzz_Options_TypeDef Fuzz_Options={-1, 0, 0, FUZZ_MAX_LENGTH, 10, ""};
+
+// Hit counts of the edges in the run, written by the instrumented firmware,
+// and the AFL count classes (1, 2, 3, 4-7, 8-15, 16-31, 32-127, 128+) seen
+static uint8_t		Fuzz_Map[FUZZ_MAP_SIZE] __attribute__((aligned(8)));
+static uint8_t		Fuzz_Seen[FUZZ_MAP_SIZE];
+static uint8_t		Fuzz_Class[256];
+static uintptr_t	Fuzz_Previous;
+static uint32_t		Fuzz_Features;
+
+static Fuzz_Unit_TypeDef*	Fuzz_Corpus;
+static size_t							Fuzz_Corpus_Size;
+static size_t							Fuzz_Corpus_Capacity;
+static const char*				Fuzz_Output;
+
+// The input running, saved when it crashes
+static const uint8_t* volatile	Fuzz_Current;
+static volatile size_t					Fuzz_Current_Size;
+
+static long long	Fuzz_Runs;
+static size_t			Fuzz_New_Units;
+static uint64_t		Fuzz_Random_State=0x9E3779B97F4A7C15ULL;
+static struct timespec Fuzz_Start;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Coverage                      ***************	
+********************************************************************************
+*******************************************************************************/
+// Called by -fsanitize-coverage=trace-pc at every edge of the firmware, the
+// pair of the last two locations gives the counter like AFL
+void __sanitizer_cov_trace_pc(void)
+{
+	uintptr_t Location=(uintptr_t)__builtin_return_address(0);
+
+	Location=(Location^(Location>>15))*0x2C1B3C6DU;
+	Location^=Location>>12;
+	Fuzz_Map[(Location^Fuzz_Previous) & (FUZZ_MAP_SIZE-1U)]++;
+	Fuzz_Previous=Location>>1;
+}
+
+static void Fuzz_Coverage_Init(void)
+{
+	for(uint32_t Count=1; Count<256U; Count++)
+	{
+		uint8_t Class=(Count<=3U) ? (uint8_t)(Count-1U) : (Count<8U) ? 3U : (Count<16U) ? 4U :
+			(Count<32U) ? 5U : (Count<128U) ? 6U : 7U;
+		Fuzz_Class[Count]=(uint8_t)(1U<<Class);
+	}
+}
+
+// Number of count classes the run reached for the first time
+static uint32_t Fuzz_Coverage_Update(void)
+{
+	const uint64_t* Words=(const uint64_t*)Fuzz_Map;
+	uint32_t New=0;
+
+	for(uint32_t Word=0; Word<FUZZ_MAP_SIZE/8U; Word++)
+	{
+		if(Words[Word]==0U)
+		{
+			continue;
+		}
+		for(uint32_t i=Word*8U; i<Word*8U+8U; i++)
+		{
+			uint8_t Class=Fuzz_Class[Fuzz_Map[i]];
+
+			if((Class & ~Fuzz_Seen[i])!=0U)
+			{
+				New+=(uint32_t)__builtin_popcount(Class & ~Fuzz_Seen[i]);
+				Fuzz_Seen[i]|=Class;
+			}
+		}
+	}
+	Fuzz_Features+=New;
+	return New;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Helpers                       ***************	
+********************************************************************************
+*******************************************************************************/
+static uint32_t Fuzz_Random(uint32_t Range)
+{
+	Fuzz_Random_State^=Fuzz_Random_State>>12;
+	Fuzz_Random_State^=Fuzz_Random_State<<25;
+	Fuzz_Random_State^=Fuzz_Random_State>>27;
+	return (uint32_t)((Fuzz_Random_State*0x2545F4914F6CDD1DULL)>>32)%Range;
+}
+
+static uint64_t Fuzz_Hash(const uint8_t* Data, size_t Size)
+{
+	uint64_t Hash=0xCBF29CE484222325ULL;
+
+	for(size_t i=0; i<Size; i++)
+	{
+		Hash=(Hash^Data[i])*0x100000001B3ULL;
+	}
+	return Hash;
+}
+
+static double Fuzz_Elapsed_s(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC,&Now);
+	return (double)(Now.tv_sec-Fuzz_Start.tv_sec)+1e-9*(double)(Now.tv_nsec-Fuzz_Start.tv_nsec);
+}
+
+static uint32_t Fuzz_Exec_Per_s(void)
+{
+	double Elapsed=Fuzz_Elapsed_s();
+
+	return (Elapsed>0.0) ? (uint32_t)((double)Fuzz_Runs/Elapsed) : 0U;
+}
+
+static uint32_t Fuzz_RSS_MB(void)
+{
+	struct rusage Usage;
+
+	getrusage(RUSAGE_SELF,&Usage);
+	return (uint32_t)(Usage.ru_maxrss/1024);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Files                         ***************	
+********************************************************************************
+*******************************************************************************/
+// Path of an input named after its hash, built without stdio so the signal
+// handlers can use it
+static void Fuzz_Path(char* Path, size_t Length, const char* Directory, const char* Kind, const uint8_t* Data, size_t Size)
+{
+	static const char Hex[]="0123456789abcdef";
+	uint64_t Hash=Fuzz_Hash(Data,Size);
+	size_t Used=0;
+
+	for(const char* Part=Directory; *Part!='\0' && Used+1U<Length; Part++)
+	{
+		Path[Used++]=*Part;
+	}
+	for(const char* Part=Kind; *Part!='\0' && Used+1U<Length; Part++)
+	{
+		Path[Used++]=*Part;
+	}
+	for(int Shift=60; Shift>=0 && Used+1U<Length; Shift-=4)
+	{
+		Path[Used++]=Hex[(Hash>>Shift) & 0x0FU];
+	}
+	Path[Used]='\0';
+}
+
+static void Fuzz_Write(const char* Path, const uint8_t* Data, size_t Size)
+{
+	int File=open(Path,O_WRONLY | O_CREAT | O_TRUNC,0644);
+
+	if(File>=0)
+	{
+		ssize_t Written=write(File,Data,Size);
+		(void)Written;
+		close(File);
+	}
+}
+
+// The running input as an artifact, from the crash and timeout handlers
+static void Fuzz_Save_Current(const char* Kind)
+{
+	char Path[4096];
+
+	if(Fuzz_Current==NULL)
+	{
+		return;
+	}
+	Fuzz_Path(Path,sizeof(Path),Fuzz_Options.Artifact_Prefix,Kind,Fuzz_Current,Fuzz_Current_Size);
+	Fuzz_Write(Path,Fuzz_Current,Fuzz_Current_Size);
+	const char Message[]="==fuzz== Test unit written to ";
+	ssize_t Written=write(STDERR_FILENO,Message,sizeof(Message)-1U);
+	Written=write(STDERR_FILENO,Path,strlen(Path));
+	Written=write(STDERR_FILENO,"\n",1);
+	(void)Written;
+}
+
+static int Fuzz_Read(const char* Path, Fuzz_Unit_TypeDef* Unit)
+{
+	FILE* File=fopen(Path,"rb");
+	long Size;
+
+	if(File==NULL || fseek(File,0,SEEK_END)!=0 || (Size=ftell(File))<0 || fseek(File,0,SEEK_SET)!=0)
+	{
+		if(File!=NULL)
+		{
+			fclose(File);
+		}
+		return -1;
+	}
+	if((size_t)Size>Fuzz_Options.Max_Len)
+	{
+		Size=(long)Fuzz_Options.Max_Len;
+	}
+	Unit->Size=(size_t)Size;
+	Unit->Data=malloc((Size>0) ? (size_t)Size : 1U);
+	if(Unit->Data==NULL || fread(Unit->Data,1,Unit->Size,File)!=Unit->Size)
+	{
+		free(Unit->Data);
+		fclose(File);
+		return -1;
+	}
+	fclose(File);
+	return 0;
+}
+
+static void Fuzz_Corpus_Add(const uint8_t* Data, size_t Size)
+{
+	if(Fuzz_Corpus_Size==Fuzz_Corpus_Capacity)
+	{
+		Fuzz_Corpus_Capacity=(Fuzz_Corpus_Capacity==0U) ? 256U : 2U*Fuzz_Corpus_Capacity;
+		Fuzz_Corpus=realloc(Fuzz_Corpus,Fuzz_Corpus_Capacity*sizeof(Fuzz_Unit_TypeDef));
+		if(Fuzz_Corpus==NULL)
+		{
+			fprintf(stderr,"out of memory\n");
+			exit(1);
+		}
+	}
+	Fuzz_Unit_TypeDef* Unit=&Fuzz_Corpus[Fuzz_Corpus_Size++];
+	Unit->Size=Size;
+	Unit->Data=malloc((Size>0U) ? Size : 1U);
+	memcpy(Unit->Data,Data,Size);
+}
+
+static int Fuzz_Compare_Names(const void* A, const void* B)
+{
+	return strcmp(*(char* const*)A,*(char* const*)B);
+}
+
+// Files of the directory in name order, so a seed gives the same run
+static size_t Fuzz_Load_Directory(const char* Directory, Fuzz_Unit_TypeDef** Units, size_t Count)
+{
+	DIR* Handle=opendir(Directory);
+	struct dirent* Entry;
+	char** Names=NULL;
+	size_t Found=0;
+
+	if(Handle==NULL)
+	{
+		return Count;
+	}
+	while((Entry=readdir(Handle))!=NULL)
+	{
+		if(Entry->d_name[0]!='.')
+		{
+			Names=realloc(Names,(Found+1U)*sizeof(char*));
+			Names[Found++]=strdup(Entry->d_name);
+		}
+	}
+	closedir(Handle);
+	if(Found>0U)
+	{
+		qsort(Names,Found,sizeof(char*),Fuzz_Compare_Names);
+	}
+
+	for(size_t i=0; i<Found; i++)
+	{
+		char Path[4096];
+		struct stat Status;
+
+		snprintf(Path,sizeof(Path),"%s/%s",Directory,Names[i]);
+		if(stat(Path,&Status)==0 && S_ISREG(Status.st_mode))
+		{
+			*Units=realloc(*Units,(Count+1U)*sizeof(Fuzz_Unit_TypeDef));
+			if(Fuzz_Read(Path,&(*Units)[Count])==0)
+			{
+				Count++;
+			}
+		}
+		free(Names[i]);
+	}
+	free(Names);
+	return Count;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Crashes                       ***************	
+********************************************************************************
+*******************************************************************************/
+static void Fuzz_Crash_Signal(int Signal)
+{
+	Fuzz_Save_Current("crash-");
+	signal(Signal,SIG_DFL);
+	raise(Signal);
+}
+
+static void Fuzz_Timeout_Signal(int Signal)
+{
+	(void)Signal;
+	const char Message[]="==fuzz== ERROR: timeout\n";
+	ssize_t Written=write(STDERR_FILENO,Message,sizeof(Message)-1U);
+	(void)Written;
+	Fuzz_Save_Current("timeout-");
+	_exit(FUZZ_TIMEOUT_EXIT);
+}
+
+#if defined(__SANITIZE_ADDRESS__)
+// The sanitizers print their report first, then the input is kept
+static void Fuzz_Sanitizer_Death(void)
+{
+	Fuzz_Save_Current("crash-");
+}
+#endif
+
+static void Fuzz_Crash_Handlers(void)
+{
+	signal(SIGABRT,Fuzz_Crash_Signal);
+	signal(SIGALRM,Fuzz_Timeout_Signal);
+#if defined(__SANITIZE_ADDRESS__)
+	// ASan handles the faults itself and calls back before it exits
+	__sanitizer_set_death_callback(Fuzz_Sanitizer_Death);
+#else
+	signal(SIGSEGV,Fuzz_Crash_Signal);
+	signal(SIGBUS,Fuzz_Crash_Signal);
+	signal(SIGFPE,Fuzz_Crash_Signal);
+	signal(SIGILL,Fuzz_Crash_Signal);
+#endif
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Execution                     ***************	
+********************************************************************************
+*******************************************************************************/
+// One input in a buffer of its own size, so reading past it is caught.
+// Returns the count classes it reached for the first time.
+static uint32_t Fuzz_Execute(const uint8_t* Data, size_t Size)
+{
+	uint8_t* Copy=malloc((Size>0U) ? Size : 1U);
+
+	memcpy(Copy,Data,Size);
+	memset(Fuzz_Map,0,sizeof(Fuzz_Map));
+	Fuzz_Previous=0;
+	Fuzz_Current_Size=Size;
+	Fuzz_Current=Copy;
+	alarm(Fuzz_Options.Timeout);
+
+	LLVMFuzzerTestOneInput(Copy,Size);
+
+	alarm(0);
+	Fuzz_Current=NULL;
+	free(Copy);
+	Fuzz_Runs++;
+	return Fuzz_Coverage_Update();
+}
+
+static void Fuzz_Report(const char* Event, size_t Length)
+{
+	printf("#%lld\t%s cov: %u corp: %zu exec/s: %u rss: %uMb",
+		Fuzz_Runs,Event,Fuzz_Features,Fuzz_Corpus_Size,Fuzz_Exec_Per_s(),Fuzz_RSS_MB());
+	if(Length>0U)
+	{
+		printf(" L: %zu",Length);
+	}
+	printf("\n");
+	fflush(stdout);
+}
+
+// Each file once, nothing is kept
+static int Fuzz_Run_Files(int Count, char** Paths)
+{
+	for(int i=0; i<Count; i++)
+	{
+		Fuzz_Unit_TypeDef Unit;
+
+		if(Fuzz_Read(Paths[i],&Unit)!=0)
+		{
+			fprintf(stderr,"%s: cannot read\n",Paths[i]);
+			return 1;
+		}
+		printf("Running: %s\n",Paths[i]);
+		double Start=Fuzz_Elapsed_s();
+		Fuzz_Execute(Unit.Data,Unit.Size);
+		printf("Executed %s in %.0f ms\n",Paths[i],1000.0*(Fuzz_Elapsed_s()-Start));
+		free(Unit.Data);
+	}
+	return 0;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Mutations                     ***************	
+********************************************************************************
+*******************************************************************************/
+static const uint8_t Fuzz_Interesting[]=
+{
+	0x00, 0x01, 0x02, 0x03, 0x07, 0x08, 0x09, 0x0F, 0x10, 0x20, 0x3F, 0x40, 0x7F, 0x80, 0xC0, 0xFF
+};
+
+/**
+ * @brief The generic mutations of libFuzzer the harness falls back on: bits,
+ * bytes and interesting values, inserts, erases, copies inside the input and
+ * pieces of other corpus inputs.
+ */
+size_t LLVMFuzzerMutate(uint8_t* Data, size_t Size, size_t Max_Size)
+{
+	size_t Position=(Size>0U) ? Fuzz_Random((uint32_t)Size) : 0U;
+
+	switch((Size>0U) ? Fuzz_Random(8) : 3U)
+	{
+		case 0:
+			Data[Position]^=(uint8_t)(1U<<Fuzz_Random(8));
+		break;
+
+		case 1:
+			Data[Position]=(uint8_t)Fuzz_Random(256);
+		break;
+
+		case 2:
+			Data[Position]=Fuzz_Interesting[Fuzz_Random(sizeof(Fuzz_Interesting))];
+		break;
+
+		case 3:
+		{
+			size_t Length=1U+Fuzz_Random(8);
+
+			if(Size+Length>Max_Size)
+			{
+				break;
+			}
+			memmove(&Data[Position+Length],&Data[Position],Size-Position);
+			for(size_t i=0; i<Length; i++)
+			{
+				Data[Position+i]=(uint8_t)Fuzz_Random(256);
+			}
+			Size+=Length;
+		}
+		break;
+
+		case 4:
+		{
+			size_t Length=1U+Fuzz_Random(16);
+
+			if(Length>Size-Position)
+			{
+				Length=Size-Position;
+			}
+			memmove(&Data[Position],&Data[Position+Length],Size-Position-Length);
+			Size-=Length;
+		}
+		break;
+
+		case 5:
+			Data[Position]=(uint8_t)(Data[Position]+(Fuzz_Random(2)==0U ? 1U : 255U)*(1U+Fuzz_Random(8)));
+		break;
+
+		case 6:
+		{
+			// A piece of the input copied over another place of it
+			size_t From=Fuzz_Random((uint32_t)Size);
+			size_t Length=1U+Fuzz_Random((uint32_t)(Size-((From>Position) ? From : Position)));
+
+			memmove(&Data[Position],&Data[From],Length);
+		}
+		break;
+
+		default:
+		{
+			// A piece of another input inserted, the crossover of libFuzzer
+			const Fuzz_Unit_TypeDef* Other=&Fuzz_Corpus[Fuzz_Random((uint32_t)Fuzz_Corpus_Size)];
+			size_t From;
+			size_t Length;
+
+			if(Other->Size==0U)
+			{
+				break;
+			}
+			From=Fuzz_Random((uint32_t)Other->Size);
+			Length=1U+Fuzz_Random((uint32_t)(Other->Size-From));
+			if(Size+Length>Max_Size)
+			{
+				Length=Max_Size-Size;
+			}
+			memmove(&Data[Position+Length],&Data[Position],Size-Position);
+			memcpy(&Data[Position],&Other->Data[From],Length);
+			Size+=Length;
+		}
+		break;
+	}
+	return Size;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(int argc, char** argv)
+{
+	Fuzz_Unit_TypeDef* Seeds=NULL;
+	size_t Seeds_Count=0;
+	char* Inputs[256];
+	int Inputs_Count=0;
+	int Directories=0;
+
+	clock_gettime(CLOCK_MONOTONIC,&Fuzz_Start);
+	Fuzz_Options.Seed=(uint32_t)time(NULL) ^ (uint32_t)getpid();
+	for(int i=1; i<argc; i++)
+	{
+		const char* Value;
+
+		if(argv[i][0]!='-')
+		{
+			if(Inputs_Count<(int)(sizeof(Inputs)/sizeof(Inputs[0])))
+			{
+				struct stat Status;
+
+				Inputs[Inputs_Count++]=argv[i];
+				Directories+=(stat(argv[i],&Status)==0 && S_ISDIR(Status.st_mode)) ? 1 : 0;
+			}
+		}
+		else if((Value=strchr(argv[i],'='))==NULL)
+		{
+			fprintf(stderr,"WARNING: unknown flag %s\n",argv[i]);
+		}
+		else if(strncmp(argv[i],"-runs=",6)==0)
+		{
+			Fuzz_Options.Runs=atoll(Value+1);
+		}
+		else if(strncmp(argv[i],"-max_total_time=",16)==0)
+		{
+			Fuzz_Options.Max_Total_Time=(uint32_t)strtoul(Value+1,NULL,10);
+		}
+		else if(strncmp(argv[i],"-seed=",6)==0)
+		{
+			Fuzz_Options.Seed=(uint32_t)strtoul(Value+1,NULL,10);
+		}
+		else if(strncmp(argv[i],"-max_len=",9)==0)
+		{
+			Fuzz_Options.Max_Len=(size_t)strtoul(Value+1,NULL,10);
+		}
+		else if(strncmp(argv[i],"-timeout=",9)==0)
+		{
+			Fuzz_Options.Timeout=(uint32_t)strtoul(Value+1,NULL,10);
+		}
+		else if(strncmp(argv[i],"-artifact_prefix=",17)==0)
+		{
+			Fuzz_Options.Artifact_Prefix=Value+1;
+		}
+		else
+		{
+			fprintf(stderr,"WARNING: unknown flag %s\n",argv[i]);
+		}
+	}
+	if(Fuzz_Options.Max_Len==0U)
+	{
+		Fuzz_Options.Max_Len=FUZZ_MAX_LENGTH;
+	}
+
+	Fuzz_Coverage_Init();
+	Fuzz_Crash_Handlers();
+	LLVMFuzzerInitialize(&argc,&argv);
+	printf("INFO: Seed: %u\n",Fuzz_Options.Seed);
+	Fuzz_Random_State^=(uint64_t)Fuzz_Options.Seed<<1;
+
+	if(Inputs_Count>0 && Directories==0)
+	{
+		return Fuzz_Run_Files(Inputs_Count,Inputs);
+	}
+
+	// Every seed runs, the ones that reach something new make the corpus
+	for(int i=0; i<Inputs_Count; i++)
+	{
+		Seeds_Count=Fuzz_Load_Directory(Inputs[i],&Seeds,Seeds_Count);
+	}
+	Fuzz_Output=(Inputs_Count>0) ? Inputs[0] : NULL;
+	printf("INFO: %zu files found in the corpus directories\n",Seeds_Count);
+	for(size_t i=0; i<Seeds_Count; i++)
+	{
+		if(Fuzz_Execute(Seeds[i].Data,Seeds[i].Size)>0U)
+		{
+			Fuzz_Corpus_Add(Seeds[i].Data,Seeds[i].Size);
+		}
+		free(Seeds[i].Data);
+	}
+	free(Seeds);
+	if(Fuzz_Corpus_Size==0U)
+	{
+		static const uint8_t Empty[1];
+
+		Fuzz_Execute(Empty,0);
+		Fuzz_Corpus_Add(Empty,0);
+	}
+	Fuzz_Report("INITED",0);
+
+	uint8_t* Buffer=malloc(Fuzz_Options.Max_Len);
+	long long Next_Pulse=1;
+	while((Fuzz_Options.Runs<0 || Fuzz_Runs<Fuzz_Options.Runs) &&
+		(Fuzz_Options.Max_Total_Time==0U || Fuzz_Elapsed_s()<(double)Fuzz_Options.Max_Total_Time))
+	{
+		const Fuzz_Unit_TypeDef* Unit=&Fuzz_Corpus[Fuzz_Random((uint32_t)Fuzz_Corpus_Size)];
+		size_t Size=(Unit->Size<Fuzz_Options.Max_Len) ? Unit->Size : Fuzz_Options.Max_Len;
+		uint32_t Mutations=1U+Fuzz_Random(FUZZ_MUTATIONS);
+
+		memcpy(Buffer,Unit->Data,Size);
+		for(uint32_t i=0; i<Mutations; i++)
+		{
+			Size=LLVMFuzzerCustomMutator(Buffer,Size,Fuzz_Options.Max_Len,(unsigned int)Fuzz_Random(UINT32_MAX));
+		}
+
+		if(Fuzz_Execute(Buffer,Size)>0U)
+		{
+			Fuzz_Corpus_Add(Buffer,Size);
+			Fuzz_New_Units++;
+			if(Fuzz_Output!=NULL)
+			{
+				char Path[4096];
+
+				Fuzz_Path(Path,sizeof(Path),Fuzz_Output,"/",Buffer,Size);
+				Fuzz_Write(Path,Buffer,Size);
+			}
+			Fuzz_Report("NEW   ",Size);
+		}
+		else if(Fuzz_Runs>=Next_Pulse)
+		{
+			Fuzz_Report("pulse ",0);
+			Next_Pulse*=2;
+		}
+	}
+	free(Buffer);
+
+	printf("Done %lld runs in %.0f second(s)\n",Fuzz_Runs,Fuzz_Elapsed_s());
+	printf("stat::number_of_executed_units: %lld\n",Fuzz_Runs);
+	printf("stat::average_exec_per_sec:     %u\n",Fuzz_Exec_Per_s());
+	printf("stat::new_units_added:          %zu\n",Fuzz_New_Units);
+	printf("stat::peak_rss_mb:              %u\n",Fuzz_RSS_MB());
+	return 0;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Fuzz_Driver.c
+  * @brief          : Coverage guided fuzz engine for toolchains without libFuzzer
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
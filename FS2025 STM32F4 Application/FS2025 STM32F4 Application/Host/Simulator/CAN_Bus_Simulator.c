@@ -0,0 +1,401 @@
+/**
+  ******************************************************************************
+  * @file           : CAN_Bus_Simulator.c
+  * @brief          : Bit timed CAN bus with ID arbitration between simulated nodes
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "CAN_Bus_Simulator.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Constants                     ***************	
+********************************************************************************
+*******************************************************************************/
+#define SIM_CRC15_POLY				0x4599U
+// SOF, identifier, RTR, IDE, r0, DLC, 8 data bytes and the CRC
+#define SIM_STUFFED_BITS_MAX	(19U+64U+15U)
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Frames                        ***************	
+********************************************************************************
+*******************************************************************************/
+static uint32_t CAN_Bus_Simulator_Put(uint8_t* Bits, uint32_t Count, uint32_t Value, uint8_t Width)
+{
+	while(Width>0U)
+	{
+		Width--;
+		Bits[Count++]=(uint8_t)((Value>>Width) & 1U);
+	}
+	return Count;
+}
+
+/**
+ * @brief Bits of the standard data frame as sent: the CRC is computed and
+ * the stuff bits counted over SOF to the end of the CRC, the delimiters, ACK,
+ * EOF and the intermission are added as they are. The units account the
+ * worst case instead (CAN1_Frame_Bits), this is the exact count.
+ */
+uint32_t CAN_Bus_Simulator_Frame_Bits(const Host_CAN_Frame_TypeDef* Frame, uint32_t* Stuff_Bits)
+{
+	uint8_t Bits[SIM_STUFFED_BITS_MAX];
+	uint8_t DLC=(Frame->DLC>8U) ? 8U : Frame->DLC;
+	uint32_t Count=0;
+	uint16_t CRC=0;
+
+	Count=CAN_Bus_Simulator_Put(Bits,Count,0U,1U);
+	Count=CAN_Bus_Simulator_Put(Bits,Count,Frame->Id & 0x7FFU,11U);
+	Count=CAN_Bus_Simulator_Put(Bits,Count,0U,3U);
+	Count=CAN_Bus_Simulator_Put(Bits,Count,DLC,4U);
+	for(uint8_t i=0; i<DLC; i++)
+	{
+		Count=CAN_Bus_Simulator_Put(Bits,Count,Frame->Data[i],8U);
+	}
+
+	for(uint32_t i=0; i<Count; i++)
+	{
+		uint16_t Next=(uint16_t)(Bits[i] ^ ((CRC>>14) & 1U));
+		CRC=(uint16_t)((CRC<<1) & 0x7FFFU);
+		if(Next!=0U)
+		{
+			CRC^=SIM_CRC15_POLY;
+		}
+	}
+	Count=CAN_Bus_Simulator_Put(Bits,Count,CRC,15U);
+
+	// After five equal bits the complement is inserted, and counts as the
+	// first of the next run
+	uint32_t Stuff=0;
+	uint32_t Run=1;
+	uint8_t Last=Bits[0];
+	for(uint32_t i=1; i<Count; i++)
+	{
+		if(Bits[i]==Last)
+		{
+			Run++;
+		}
+		else
+		{
+			Last=Bits[i];
+			Run=1;
+		}
+		if(Run==5U)
+		{
+			Stuff++;
+			Last^=1U;
+			Run=1;
+		}
+	}
+
+	if(Stuff_Bits!=NULL)
+	{
+		*Stuff_Bits=Stuff;
+	}
+	return Count+Stuff+CAN_BUS_SIMULATOR_FIXED_BITS;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Bus                           ***************	
+********************************************************************************
+*******************************************************************************/
+void CAN_Bus_Simulator_Init(CAN_Bus_Simulator_TypeDef* Bus, uint32_t Bitrate)
+{
+	memset(Bus,0,sizeof(CAN_Bus_Simulator_TypeDef));
+	Bus->Bitrate=Bitrate;
+}
+
+uint8_t CAN_Bus_Simulator_Add_Port(CAN_Bus_Simulator_TypeDef* Bus, const CAN_Bus_Simulator_Port_TypeDef* Port)
+{
+	if(Bus->Ports==CAN_BUS_SIMULATOR_PORTS)
+	{
+		return CAN_BUS_SIMULATOR_PORTS;
+	}
+	Bus->Port[Bus->Ports]=*Port;
+	return Bus->Ports++;
+}
+
+// Load of every window the bus time went past, a frame counts whole in the
+// window it starts in
+static void CAN_Bus_Simulator_Close_Windows(CAN_Bus_Simulator_TypeDef* Bus)
+{
+	while(Bus->Time_us>=Bus->Window_Start_us+CAN_BUS_SIMULATOR_WINDOW_US)
+	{
+		uint64_t Load=(Bus->Window_Busy_us*1000U)/CAN_BUS_SIMULATOR_WINDOW_US;
+
+		Bus->Statistics.Load=(Load>1000U) ? 1000U : (uint16_t)Load;
+		if(Bus->Statistics.Load>Bus->Statistics.Peak_Load)
+		{
+			Bus->Statistics.Peak_Load=Bus->Statistics.Load;
+		}
+		Bus->Window_Busy_us=0;
+		Bus->Window_Start_us+=CAN_BUS_SIMULATOR_WINDOW_US;
+	}
+}
+
+/**
+ * @brief Sends frames until the bus time reaches End_us. Whenever the bus is
+ * idle every port offers its next frame and the lowest identifier wins, the
+ * others lose the arbitration and offer again after the frame. The frame
+ * reaches all the other ports at its end of frame. A frame started before
+ * End_us ends after it, the next call goes on from there.
+ */
+void CAN_Bus_Simulator_Run(CAN_Bus_Simulator_TypeDef* Bus, uint64_t End_us)
+{
+	Host_CAN_Frame_TypeDef Frame[CAN_BUS_SIMULATOR_PORTS];
+	BoolTypeDef Offered[CAN_BUS_SIMULATOR_PORTS];
+
+	while(Bus->Time_us<End_us)
+	{
+		int32_t Winner=-1;
+
+		for(uint8_t i=0; i<Bus->Ports; i++)
+		{
+			CAN_Bus_Simulator_Port_Statistics_TypeDef* Port=&Bus->Port_Statistics[i];
+
+			Offered[i]=Bus->Port[i].Pending(Bus->Port[i].Context,&Frame[i]);
+			if(Offered[i]==FALSE)
+			{
+				continue;
+			}
+			if(Port->Waiting==FALSE)
+			{
+				Port->Waiting=TRUE;
+				Port->Waiting_Since=Bus->Time_us;
+			}
+			if(Winner<0 || Frame[i].Id<Frame[Winner].Id)
+			{
+				Winner=i;
+			}
+			else if(Frame[i].Id==Frame[Winner].Id)
+			{
+				// Both would win the arbitration and corrupt each other on the
+				// data, the model lets the first port through and counts it
+				Bus->Statistics.Identifier_Clashes++;
+			}
+		}
+
+		if(Winner<0)
+		{
+			Bus->Time_us=End_us;
+			CAN_Bus_Simulator_Close_Windows(Bus);
+			break;
+		}
+
+		for(uint8_t i=0; i<Bus->Ports; i++)
+		{
+			if(Offered[i]==TRUE && i!=Winner)
+			{
+				Bus->Port_Statistics[i].Arbitration_Lost++;
+			}
+		}
+
+		uint32_t Stuff;
+		uint32_t Bits=CAN_Bus_Simulator_Frame_Bits(&Frame[Winner],&Stuff);
+		uint32_t Duration=(uint32_t)(((uint64_t)Bits*1000000U+Bus->Bitrate-1U)/Bus->Bitrate);
+		CAN_Bus_Simulator_Port_Statistics_TypeDef* Port=&Bus->Port_Statistics[Winner];
+		uint32_t Latency=(uint32_t)(Bus->Time_us-Port->Waiting_Since);
+
+		Port->Waiting=FALSE;
+		Port->Tx_Frames++;
+		Port->Tx_Bits+=Bits;
+		Port->Total_Latency_us+=Latency;
+		if(Latency>Port->Max_Latency_us)
+		{
+			Port->Max_Latency_us=Latency;
+		}
+
+		CAN_Bus_Simulator_Record_TypeDef* Record=&Bus->Log[Bus->Log_Count%CAN_BUS_SIMULATOR_LOG_SIZE];
+		Record->Time_us=Bus->Time_us;
+		Record->Duration_us=Duration;
+		Record->Bits=(uint16_t)Bits;
+		Record->Port=(uint8_t)Winner;
+		Record->Frame=Frame[Winner];
+		Bus->Log_Count++;
+
+		Bus->Statistics.Frames++;
+		Bus->Statistics.Bits+=Bits;
+		Bus->Statistics.Stuff_Bits+=Stuff;
+		Bus->Statistics.Busy_us+=Duration;
+		Bus->Window_Busy_us+=Duration;
+
+		Bus->Port[Winner].Transmitted(Bus->Port[Winner].Context);
+		Bus->Time_us+=Duration;
+		for(uint8_t i=0; i<Bus->Ports; i++)
+		{
+			if(i!=Winner)
+			{
+				Bus->Port_Statistics[i].Rx_Frames++;
+				Bus->Port[i].Receive(Bus->Port[i].Context,&Frame[Winner]);
+			}
+		}
+		CAN_Bus_Simulator_Close_Windows(Bus);
+	}
+}
+
+// Index counts from the first frame ever sent, NULL once overwritten or not
+// sent yet
+const CAN_Bus_Simulator_Record_TypeDef* CAN_Bus_Simulator_Record(const CAN_Bus_Simulator_TypeDef* Bus, uint32_t Index)
+{
+	if(Index>=Bus->Log_Count || Bus->Log_Count-Index>CAN_BUS_SIMULATOR_LOG_SIZE)
+	{
+		return NULL;
+	}
+	return &Bus->Log[Index%CAN_BUS_SIMULATOR_LOG_SIZE];
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Scripted master               ***************	
+********************************************************************************
+*******************************************************************************/
+void CAN_Bus_Master_Init(CAN_Bus_Master_TypeDef* Master, const CAN_Bus_Simulator_TypeDef* Bus)
+{
+	memset(Master,0,sizeof(CAN_Bus_Master_TypeDef));
+	Master->Bus=Bus;
+}
+
+void CAN_Bus_Master_Add(CAN_Bus_Master_TypeDef* Master, uint32_t Time_ms, uint32_t Period_ms, uint32_t Id, uint8_t DLC, const uint8_t* Data)
+{
+	if(Master->Steps==CAN_BUS_MASTER_STEPS)
+	{
+		return;
+	}
+	CAN_Bus_Master_Step_TypeDef* Step=&Master->Script[Master->Steps++];
+
+	memset(Step,0,sizeof(CAN_Bus_Master_Step_TypeDef));
+	Step->Time_ms=Time_ms;
+	Step->Period_ms=Period_ms;
+	Step->Id=Id & 0x7FFU;
+	Step->DLC=(DLC>8U) ? 8U : DLC;
+	if(Data!=NULL)
+	{
+		memcpy(Step->Data,Data,Step->DLC);
+	}
+	Step->Next_us=(uint64_t)Time_ms*1000U;
+}
+
+// Queues the frames of the script that are due at the bus time
+void CAN_Bus_Master_Update(CAN_Bus_Master_TypeDef* Master)
+{
+	for(uint8_t i=0; i<Master->Steps; i++)
+	{
+		CAN_Bus_Master_Step_TypeDef* Step=&Master->Script[i];
+
+		if(Step->Next_us>Master->Bus->Time_us)
+		{
+			continue;
+		}
+		if(Master->Queue_Count==CAN_BUS_MASTER_QUEUE)
+		{
+			Master->Queue_Dropped++;
+		}
+		else
+		{
+			Host_CAN_Frame_TypeDef* Frame=&Master->Queue[(Master->Queue_Head+Master->Queue_Count)%CAN_BUS_MASTER_QUEUE];
+
+			memset(Frame,0,sizeof(Host_CAN_Frame_TypeDef));
+			Frame->Id=Step->Id;
+			Frame->DLC=Step->DLC;
+			memcpy(Frame->Data,Step->Data,8);
+			Master->Queue_Count++;
+		}
+		Step->Next_us=(Step->Period_ms>0U) ? Step->Next_us+(uint64_t)Step->Period_ms*1000U : UINT64_MAX;
+	}
+}
+
+static BoolTypeDef CAN_Bus_Master_Pending(void* Context, Host_CAN_Frame_TypeDef* Frame)
+{
+	CAN_Bus_Master_TypeDef* Master=(CAN_Bus_Master_TypeDef*)Context;
+
+	if(Master->Queue_Count==0U)
+	{
+		return FALSE;
+	}
+	*Frame=Master->Queue[Master->Queue_Head];
+	return TRUE;
+}
+
+static void CAN_Bus_Master_Transmitted(void* Context)
+{
+	CAN_Bus_Master_TypeDef* Master=(CAN_Bus_Master_TypeDef*)Context;
+
+	Master->Queue_Head=(uint8_t)((Master->Queue_Head+1U)%CAN_BUS_MASTER_QUEUE);
+	Master->Queue_Count--;
+}
+
+static void CAN_Bus_Master_Receive(void* Context, const Host_CAN_Frame_TypeDef* Frame)
+{
+	CAN_Bus_Master_TypeDef* Master=(CAN_Bus_Master_TypeDef*)Context;
+
+	Master->Received[Frame->Id & 0x7FFU]++;
+	Master->Last_Received_us[Frame->Id & 0x7FFU]=Master->Bus->Time_us;
+}
+
+CAN_Bus_Simulator_Port_TypeDef CAN_Bus_Master_Port(CAN_Bus_Master_TypeDef* Master, const char* Name)
+{
+	CAN_Bus_Simulator_Port_TypeDef Port=
+	{
+		.Name=Name,
+		.Context=Master,
+		.Pending=CAN_Bus_Master_Pending,
+		.Transmitted=CAN_Bus_Master_Transmitted,
+		.Receive=CAN_Bus_Master_Receive
+	};
+	return Port;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : CAN_Bus_Simulator.c
+  * @brief          : Bit timed CAN bus with ID arbitration between simulated nodes
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
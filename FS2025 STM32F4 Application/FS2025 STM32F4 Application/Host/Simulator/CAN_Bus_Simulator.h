@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file           : CAN_Bus_Simulator.h
+  * @brief          : Bit timed CAN bus with ID arbitration between simulated nodes
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef CAN_BUS_SIMULATOR_H
+#define CAN_BUS_SIMULATOR_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Host.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Bus                           ***************	
+********************************************************************************
+*******************************************************************************/
+#define CAN_BUS_SIMULATOR_PORTS					8U
+#define CAN_BUS_SIMULATOR_LOG_SIZE			1024U
+// Load window, the same second the units use for their own estimate
+#define CAN_BUS_SIMULATOR_WINDOW_US			1000000U
+
+// CRC delimiter, ACK slot and delimiter, EOF and intermission: never stuffed
+#define CAN_BUS_SIMULATOR_FIXED_BITS		13U
+
+// A node on the bus. Pending offers the frame the node wants to send next,
+// Transmitted tells it that frame won the arbitration and is on the wire,
+// Receive hands it every frame sent by the other nodes.
+typedef struct
+{
+	const char*	Name;
+	void*				Context;
+	BoolTypeDef	(*Pending)			(void* Context, Host_CAN_Frame_TypeDef* Frame);
+	void				(*Transmitted)	(void* Context);
+	void				(*Receive)			(void* Context, const Host_CAN_Frame_TypeDef* Frame);
+} CAN_Bus_Simulator_Port_TypeDef;
+
+typedef struct
+{
+	uint32_t		Tx_Frames;
+	uint64_t		Tx_Bits;
+	uint32_t		Rx_Frames;
+	uint32_t		Arbitration_Lost;
+	uint32_t		Max_Latency_us;				// From the frame offered to its start of frame
+	uint64_t		Total_Latency_us;
+	BoolTypeDef	Waiting;
+	uint64_t		Waiting_Since;
+} CAN_Bus_Simulator_Port_Statistics_TypeDef;
+
+typedef struct
+{
+	uint32_t	Frames;
+	uint64_t	Bits;
+	uint64_t	Stuff_Bits;
+	uint64_t	Busy_us;
+	uint32_t	Identifier_Clashes;					// Two nodes sending the same ID at once
+	uint16_t	Load;												// per mille, last window
+	uint16_t	Peak_Load;									// per mille
+} CAN_Bus_Simulator_Statistics_TypeDef;
+
+typedef struct
+{
+	uint64_t								Time_us;			// Start of frame
+	uint32_t								Duration_us;
+	uint16_t								Bits;
+	uint8_t									Port;
+	Host_CAN_Frame_TypeDef	Frame;
+} CAN_Bus_Simulator_Record_TypeDef;
+
+typedef struct
+{
+	uint32_t	Bitrate;
+	uint64_t	Time_us;								// The bus is idle from here
+	uint8_t		Ports;
+	CAN_Bus_Simulator_Port_TypeDef							Port[CAN_BUS_SIMULATOR_PORTS];
+	CAN_Bus_Simulator_Port_Statistics_TypeDef		Port_Statistics[CAN_BUS_SIMULATOR_PORTS];
+	CAN_Bus_Simulator_Statistics_TypeDef				Statistics;
+
+	uint64_t	Window_Start_us;
+	uint64_t	Window_Busy_us;
+
+	// Last frames on the bus, the oldest are overwritten
+	CAN_Bus_Simulator_Record_TypeDef	Log[CAN_BUS_SIMULATOR_LOG_SIZE];
+	uint32_t	Log_Count;								// Total, Log_Count-1 is the newest
+} CAN_Bus_Simulator_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Scripted master               ***************	
+********************************************************************************
+*******************************************************************************/
+#define CAN_BUS_MASTER_STEPS						16U
+#define CAN_BUS_MASTER_QUEUE						16U
+#define CAN_BUS_MASTER_IDS							0x800U
+
+// A frame sent once at Time_ms, or every Period_ms from Time_ms when not 0
+typedef struct
+{
+	uint32_t	Time_ms;
+	uint32_t	Period_ms;
+	uint32_t	Id;
+	uint8_t		DLC;
+	uint8_t		Data[8];
+	uint64_t	Next_us;
+} CAN_Bus_Master_Step_TypeDef;
+
+// The rest of the car as a script: sends in order, one frame at a time, and
+// keeps what it receives per identifier
+typedef struct
+{
+	const CAN_Bus_Simulator_TypeDef*	Bus;
+	CAN_Bus_Master_Step_TypeDef				Script[CAN_BUS_MASTER_STEPS];
+	uint8_t														Steps;
+	Host_CAN_Frame_TypeDef						Queue[CAN_BUS_MASTER_QUEUE];
+	uint8_t														Queue_Head;
+	uint8_t														Queue_Count;
+	uint32_t													Queue_Dropped;
+	uint32_t													Received[CAN_BUS_MASTER_IDS];
+	uint64_t													Last_Received_us[CAN_BUS_MASTER_IDS];
+} CAN_Bus_Master_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Functions                     ***************	
+********************************************************************************
+*******************************************************************************/
+uint32_t	CAN_Bus_Simulator_Frame_Bits	(const Host_CAN_Frame_TypeDef* Frame, uint32_t* Stuff_Bits);
+
+void 			CAN_Bus_Simulator_Init				(CAN_Bus_Simulator_TypeDef* Bus, uint32_t Bitrate);
+uint8_t		CAN_Bus_Simulator_Add_Port		(CAN_Bus_Simulator_TypeDef* Bus, const CAN_Bus_Simulator_Port_TypeDef* Port);
+void 			CAN_Bus_Simulator_Run					(CAN_Bus_Simulator_TypeDef* Bus, uint64_t End_us);
+const CAN_Bus_Simulator_Record_TypeDef* CAN_Bus_Simulator_Record	(const CAN_Bus_Simulator_TypeDef* Bus, uint32_t Index);
+
+void 			CAN_Bus_Master_Init						(CAN_Bus_Master_TypeDef* Master, const CAN_Bus_Simulator_TypeDef* Bus);
+void 			CAN_Bus_Master_Add						(CAN_Bus_Master_TypeDef* Master, uint32_t Time_ms, uint32_t Period_ms, uint32_t Id, uint8_t DLC, const uint8_t* Data);
+void 			CAN_Bus_Master_Update					(CAN_Bus_Master_TypeDef* Master);
+CAN_Bus_Simulator_Port_TypeDef CAN_Bus_Master_Port	(CAN_Bus_Master_TypeDef* Master, const char* Name);
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : CAN_Bus_Simulator.h
+  * @brief          : Bit timed CAN bus with ID arbitration between simulated nodes
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
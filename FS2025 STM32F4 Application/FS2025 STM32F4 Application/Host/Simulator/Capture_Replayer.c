@@ -0,0 +1,473 @@
+/**
+  ******************************************************************************
+  * @file           : Capture_Replayer.c
+  * @brief          : Replays a Capture ring through the unmodified firmware
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Capture_Replayer.h"
+#include <stdio.h>
+#include <time.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Constants                     ***************	
+********************************************************************************
+*******************************************************************************/
+#define SIM_FNV_OFFSET				0xCBF29CE484222325ULL
+#define SIM_FNV_PRIME					0x00000100000001B3ULL
+
+// Command and command PEC, the reply starts after them
+#define SIM_COMMAND_BYTES			4U
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Trace                         ***************	
+********************************************************************************
+*******************************************************************************/
+void Capture_Replayer_Trace_Init(Capture_Replayer_Trace_TypeDef* Trace, Capture_Record_TypeDef* Records, uint32_t Max_Records)
+{
+	memset(Trace,0,sizeof(Capture_Replayer_Trace_TypeDef));
+	Trace->Digest=SIM_FNV_OFFSET;
+	Trace->Records=Records;
+	Trace->Max_Records=Max_Records;
+}
+
+void Capture_Replayer_Trace_Readings(Capture_Replayer_Trace_TypeDef* Trace, float (*Readings)[BPCU_CHANNELS], uint32_t Max_Readings)
+{
+	Trace->Readings=Readings;
+	Trace->Max_Readings=Max_Readings;
+	Trace->Reading_Count=0;
+	Trace->Readings_Lost=0;
+}
+
+static uint64_t Capture_Replayer_Hash(uint64_t Hash, const void* Data, size_t Length)
+{
+	const uint8_t* Bytes=(const uint8_t*)Data;
+
+	for(size_t i=0; i<Length; i++)
+	{
+		Hash=(Hash ^ Bytes[i])*SIM_FNV_PRIME;
+	}
+	return Hash;
+}
+
+// Records the ring got since the last call, the ring keeps CAPTURE_RECORDS
+static void Capture_Replayer_Drain(Capture_Replayer_Trace_TypeDef* Trace)
+{
+	uint32_t New=Capture_Total()-Trace->Seen;
+	uint32_t Held=Capture_Count();
+
+	if(New>Held)
+	{
+		Trace->Records_Lost+=New-Held;
+		New=Held;
+	}
+	for(uint32_t i=Held-New; i<Held; i++)
+	{
+		if(Trace->Record_Count<Trace->Max_Records)
+		{
+			Trace->Records[Trace->Record_Count++]=*Capture_Get(i);
+		}
+		else
+		{
+			Trace->Records_Lost++;
+		}
+	}
+	Trace->Seen=Capture_Total();
+}
+
+// Rows the filter engine added to its history since the last call, one per
+// scan. The trace starts with the engine, at the first row
+static void Capture_Replayer_Keep_Readings(Capture_Replayer_Trace_TypeDef* Trace, const Filter_Engine_TypeDef* Engine)
+{
+	if(Trace->Readings==NULL)
+	{
+		return;
+	}
+	while(Trace->History_Head!=Engine->History_Head)
+	{
+		if(Trace->Reading_Count<Trace->Max_Readings)
+		{
+			memcpy(Trace->Readings[Trace->Reading_Count++],Engine->History[Trace->History_Head],sizeof(Engine->History[0]));
+		}
+		else
+		{
+			Trace->Readings_Lost++;
+		}
+		Trace->History_Head=(uint8_t)((Trace->History_Head+1U)%FILTER_HISTORY_LENGTH);
+	}
+}
+
+/**
+ * @brief After every main loop pass: adds the pass to the digest, keeps the
+ * state changes, drains the capture ring and keeps the new filter engine
+ * readings.
+ */
+void Capture_Replayer_Trace_Update(Capture_Replayer_Trace_TypeDef* Trace, const Control_Unit_TypeDef* Control_Unit)
+{
+	const Temperatures_Typedef* Temperatures=&Control_Unit->Status.Temperatures;
+	uint32_t Tick=MCU_Get_Tick();
+	uint8_t State=(uint8_t)Control_Unit->State;
+
+	Trace->Digest=Capture_Replayer_Hash(Trace->Digest,&Tick,sizeof(Tick));
+	Trace->Digest=Capture_Replayer_Hash(Trace->Digest,&State,sizeof(State));
+	Trace->Digest=Capture_Replayer_Hash(Trace->Digest,Temperatures->Readed_Value,sizeof(Temperatures->Readed_Value));
+	Trace->Digest=Capture_Replayer_Hash(Trace->Digest,Temperatures->Actual_Value,sizeof(Temperatures->Actual_Value));
+	Trace->Digest=Capture_Replayer_Hash(Trace->Digest,Control_Unit->Status.Voltages,sizeof(Control_Unit->Status.Voltages));
+	Trace->Passes++;
+
+	if(Trace->Steps==0U || Trace->Last.State!=State || Trace->Last.Hot!=Temperatures->Hot || Trace->Last.Failed!=Temperatures->Failed)
+	{
+		Trace->Last.Tick=Tick;
+		Trace->Last.State=State;
+		Trace->Last.Hot=Temperatures->Hot;
+		Trace->Last.Failed=Temperatures->Failed;
+		if(Trace->Steps<CAPTURE_REPLAYER_STEPS)
+		{
+			Trace->Step[Trace->Steps]=Trace->Last;
+		}
+		Trace->Steps++;
+	}
+
+	Capture_Replayer_Drain(Trace);
+	Capture_Replayer_Keep_Readings(Trace,&Control_Unit->Filter_Engine);
+}
+
+/**
+ * @brief Index of the first record that differs, CAPTURE_REPLAYER_NONE when
+ * the shorter stream is the start of the other one.
+ */
+uint32_t Capture_Replayer_Compare(const Capture_Record_TypeDef* A, uint32_t A_Count, const Capture_Record_TypeDef* B, uint32_t B_Count)
+{
+	uint32_t Count=(A_Count<B_Count) ? A_Count : B_Count;
+
+	for(uint32_t i=0; i<Count; i++)
+	{
+		if(A[i].Timestamp!=B[i].Timestamp || A[i].Source!=B[i].Source || A[i].Flags!=B[i].Flags ||
+			 A[i].Id!=B[i].Id || memcmp(A[i].Data,B[i].Data,sizeof(A[i].Data))!=0)
+		{
+			return i;
+		}
+	}
+	return CAPTURE_REPLAYER_NONE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 SPI devices                   ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief The record of the next transaction with the command on this bus.
+ * The records passed over are counted, a field capture taken mid run starts
+ * in the middle of a scan and the boot of the replay has its own traffic.
+ */
+static void Capture_Replayer_Resolve(Capture_Replayer_Bus_TypeDef* Bus)
+{
+	Capture_Replayer_TypeDef* Replayer=(Capture_Replayer_TypeDef*)Bus->Replayer;
+	uint16_t Command=(uint16_t)((Bus->Command[0]<<8) | Bus->Command[1]);
+	uint32_t Skipped=0;
+
+	Bus->Resolved=TRUE;
+	Bus->Match=CAPTURE_REPLAYER_NONE;
+	for(uint32_t i=Bus->Cursor; i<Replayer->Count; i++)
+	{
+		const Capture_Record_TypeDef* Record=&Replayer->Records[i];
+
+		if(Record->Source!=Bus->Source)
+		{
+			continue;
+		}
+		if(Record->Id==Command)
+		{
+			Bus->Match=i;
+			Bus->Cursor=i+1U;
+			Replayer->Statistics.Matched++;
+			Replayer->Statistics.Skipped+=Skipped;
+			if((Record->Flags & CAPTURE_FLAG_TRANSFER_OK)==0U)
+			{
+				Replayer->Statistics.Failed_Transfers++;
+			}
+			return;
+		}
+		Skipped++;
+	}
+	Replayer->Statistics.Unmatched++;
+}
+
+static void Capture_Replayer_Select(void* Context, BoolTypeDef Selected)
+{
+	Capture_Replayer_Bus_TypeDef* Bus=(Capture_Replayer_Bus_TypeDef*)Context;
+
+	if(Selected==TRUE)
+	{
+		Bus->Count=0;
+		Bus->Resolved=FALSE;
+		Bus->Command[0]=0;
+		Bus->Command[1]=0;
+	}
+	else if(Bus->Count>0U && Bus->Resolved==FALSE)
+	{
+		Capture_Replayer_Resolve(Bus);
+	}
+}
+
+// Reads answer with the recorded response, anything else reads the idle bus
+static uint8_t Capture_Replayer_Exchange(void* Context, uint8_t Byte)
+{
+	Capture_Replayer_Bus_TypeDef* Bus=(Capture_Replayer_Bus_TypeDef*)Context;
+	Capture_Replayer_TypeDef* Replayer=(Capture_Replayer_TypeDef*)Bus->Replayer;
+	uint8_t Reply=0xFF;
+
+	if(Bus->Count<2U)
+	{
+		Bus->Command[Bus->Count]=Byte;
+	}
+	else if(Bus->Count>=SIM_COMMAND_BYTES)
+	{
+		if(Bus->Resolved==FALSE)
+		{
+			Capture_Replayer_Resolve(Bus);
+		}
+		uint16_t Index=Bus->Count-SIM_COMMAND_BYTES;
+		if(Bus->Match!=CAPTURE_REPLAYER_NONE && (Replayer->Records[Bus->Match].Flags & CAPTURE_FLAG_READ) && Index<8U)
+		{
+			Reply=Replayer->Records[Bus->Match].Data[Index];
+		}
+	}
+	if(Bus->Count<UINT16_MAX)
+	{
+		Bus->Count++;
+	}
+	return Reply;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Replay                        ***************	
+********************************************************************************
+*******************************************************************************/
+void Capture_Replayer_Init(Capture_Replayer_TypeDef* Replayer, const Capture_Record_TypeDef* Records, uint32_t Count,
+													 Capture_Record_TypeDef* Output, uint32_t Max_Output)
+{
+	memset(Replayer,0,sizeof(Capture_Replayer_TypeDef));
+	Replayer->Records=Records;
+	Replayer->Count=Count;
+	Replayer->Diverged_At=CAPTURE_REPLAYER_NONE;
+	Replayer->Bus[0].Source=CAPTURE_SPI_1;
+	Replayer->Bus[1].Source=CAPTURE_SPI_2;
+	for(uint8_t i=0; i<2U; i++)
+	{
+		Replayer->Bus[i].Replayer=Replayer;
+		Replayer->Bus[i].Match=CAPTURE_REPLAYER_NONE;
+	}
+	Capture_Replayer_Trace_Init(&Replayer->Trace,Output,Max_Output);
+}
+
+// Frames the unit received up to the tick, in the order it received them
+static void Capture_Replayer_Inject(Capture_Replayer_TypeDef* Replayer, uint32_t Tick)
+{
+	for(; Replayer->CAN_Cursor<Replayer->Count; Replayer->CAN_Cursor++)
+	{
+		const Capture_Record_TypeDef* Record=&Replayer->Records[Replayer->CAN_Cursor];
+
+		if(Record->Source!=CAPTURE_CAN_RX)
+		{
+			continue;
+		}
+		if(Record->Timestamp>Tick)
+		{
+			return;
+		}
+		if(Host_CAN1_Inject(Record->Id,Record->Flags,Record->Data)==TRUE)
+		{
+			Replayer->Statistics.CAN_Injected++;
+		}
+		else
+		{
+			Replayer->Statistics.CAN_Overruns++;
+		}
+	}
+}
+
+/**
+ * @brief Boots the unit on the simulated board with the capture as both
+ * LTC6811 and as the rest of the bus, and runs it for the time, one main loop
+ * pass at a time. The received frames are injected at their tick, before the
+ * pass. The capture of the replay is compared with the one replayed, so a
+ * replay that reproduces the run has no divergence. Wall_ms times the run.
+ */
+void Capture_Replayer_Run(Capture_Replayer_TypeDef* Replayer, uint32_t Time_ms)
+{
+	struct timespec Start;
+	struct timespec Stop;
+
+	for(uint8_t i=0; i<2U; i++)
+	{
+		Host_SPI_Device_TypeDef Device=
+		{
+			.Context=&Replayer->Bus[i],
+			.Select=Capture_Replayer_Select,
+			.Exchange=Capture_Replayer_Exchange
+		};
+		Host_SPI_Attach((i==0U) ? HOST_SPI_1 : HOST_SPI_2,&Device);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC,&Start);
+	Host_Reset();
+	memset((void*)&CONTROL_UNIT,0,sizeof(CONTROL_UNIT));
+	Control_Unit_MCU_Init();
+	Control_Unit_Init();
+	while(MCU_Get_Tick()<Time_ms && Host_Halted()==FALSE)
+	{
+		Capture_Replayer_Inject(Replayer,MCU_Get_Tick());
+		Host_Run_ms(1);
+		Capture_Replayer_Trace_Update(&Replayer->Trace,&CONTROL_UNIT);
+	}
+	clock_gettime(CLOCK_MONOTONIC,&Stop);
+
+	Replayer->Wall_ms=(double)(Stop.tv_sec-Start.tv_sec)*1e3+(double)(Stop.tv_nsec-Start.tv_nsec)/1e6;
+	Replayer->Diverged_At=Capture_Replayer_Compare(Replayer->Records,Replayer->Count,Replayer->Trace.Records,Replayer->Trace.Record_Count);
+}
+
+// Up to the tick after the last record
+uint32_t Capture_Replayer_Duration_ms(const Capture_Record_TypeDef* Records, uint32_t Count)
+{
+	uint32_t Last=0;
+
+	for(uint32_t i=0; i<Count; i++)
+	{
+		if(Records[i].Timestamp>Last)
+		{
+			Last=Records[i].Timestamp;
+		}
+	}
+	return (Count>0U) ? Last+1U : 0U;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Files                         ***************	
+********************************************************************************
+*******************************************************************************/
+static void Capture_Replayer_Put(uint8_t* Bytes, uint32_t Value)
+{
+	Bytes[0]=(uint8_t)Value;
+	Bytes[1]=(uint8_t)(Value>>8);
+	Bytes[2]=(uint8_t)(Value>>16);
+	Bytes[3]=(uint8_t)(Value>>24);
+}
+
+static uint32_t Capture_Replayer_Get(const uint8_t* Bytes)
+{
+	return Bytes[0] | ((uint32_t)Bytes[1]<<8) | ((uint32_t)Bytes[2]<<16) | ((uint32_t)Bytes[3]<<24);
+}
+
+/**
+ * @brief Records as the diagnostics capture pages dump them: timestamp,
+ * source | flags<<8 | id<<16, then the data in two words. Returns the records
+ * read, a partial record at the end is left out.
+ */
+uint32_t Capture_Replayer_Load(const char* Path, Capture_Record_TypeDef* Records, uint32_t Max_Records)
+{
+	FILE* File=fopen(Path,"rb");
+	uint8_t Bytes[CAPTURE_REPLAYER_RECORD_SIZE];
+	uint32_t Count=0;
+
+	if(File==NULL)
+	{
+		return 0;
+	}
+	while(Count<Max_Records && fread(Bytes,1,sizeof(Bytes),File)==sizeof(Bytes))
+	{
+		Capture_Record_TypeDef* Record=&Records[Count++];
+		uint32_t Header=Capture_Replayer_Get(&Bytes[4]);
+
+		Record->Timestamp=Capture_Replayer_Get(&Bytes[0]);
+		Record->Source=(uint8_t)Header;
+		Record->Flags=(uint8_t)(Header>>8);
+		Record->Id=(uint16_t)(Header>>16);
+		memcpy(Record->Data,&Bytes[8],8);
+	}
+	fclose(File);
+	return Count;
+}
+
+BoolTypeDef Capture_Replayer_Save(const char* Path, const Capture_Record_TypeDef* Records, uint32_t Count)
+{
+	FILE* File=fopen(Path,"wb");
+	uint8_t Bytes[CAPTURE_REPLAYER_RECORD_SIZE];
+	BoolTypeDef Written=TRUE;
+
+	if(File==NULL)
+	{
+		return FALSE;
+	}
+	for(uint32_t i=0; i<Count && Written==TRUE; i++)
+	{
+		Capture_Replayer_Put(&Bytes[0],Records[i].Timestamp);
+		Capture_Replayer_Put(&Bytes[4],Records[i].Source | ((uint32_t)Records[i].Flags<<8) | ((uint32_t)Records[i].Id<<16));
+		memcpy(&Bytes[8],Records[i].Data,8);
+		Written=(fwrite(Bytes,1,sizeof(Bytes),File)==sizeof(Bytes)) ? TRUE : FALSE;
+	}
+	if(fclose(File)!=0)
+	{
+		Written=FALSE;
+	}
+	return Written;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Capture_Replayer.c
+  * @brief          : Replays a Capture ring through the unmodified firmware
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file           : Capture_Replayer.h
+  * @brief          : Replays a Capture ring through the unmodified firmware
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef CAPTURE_REPLAYER_H
+#define CAPTURE_REPLAYER_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Control_Unit.h"
+#include "Capture.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Trace                         ***************	
+********************************************************************************
+*******************************************************************************/
+#define CAPTURE_REPLAYER_STEPS					256U
+// Bytes of a record in the files, the four words of the diagnostics capture
+// pages in little endian
+#define CAPTURE_REPLAYER_RECORD_SIZE		16U
+#define CAPTURE_REPLAYER_NONE						UINT32_MAX
+
+// A state change of the unit, the tick is the one of the pass that made it
+typedef struct
+{
+	uint32_t	Tick;
+	uint8_t		State;
+	uint32_t	Hot;
+	uint32_t	Failed;
+} Capture_Replayer_Step_TypeDef;
+
+// What a unit did over a run: its state changes, a digest of the readings,
+// filtered values and state after every pass, and its own capture records
+// drained from the ring after every pass. The raw temperatures of every
+// filter engine pass are kept too when a buffer is given
+typedef struct
+{
+	Capture_Replayer_Step_TypeDef	Step[CAPTURE_REPLAYER_STEPS];
+	uint32_t											Steps;				// All the changes, the first ones are kept
+	Capture_Replayer_Step_TypeDef	Last;
+	uint32_t											Passes;
+	uint64_t											Digest;
+
+	Capture_Record_TypeDef*				Records;
+	uint32_t											Max_Records;
+	uint32_t											Record_Count;
+	uint32_t											Records_Lost;	// Overwritten in the ring or no room left
+	uint32_t											Seen;					// Capture_Total already drained
+
+	float													(*Readings)[BPCU_CHANNELS];
+	uint32_t											Max_Readings;
+	uint32_t											Reading_Count;
+	uint32_t											Readings_Lost;
+	uint8_t												History_Head;	// Next filter engine history row to keep
+} Capture_Replayer_Trace_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Replayer                      ***************	
+********************************************************************************
+*******************************************************************************/
+// One chip select frame on one of the buses
+typedef struct
+{
+	void*				Replayer;
+	uint8_t			Source;
+	uint8_t			Command[2];
+	uint16_t		Count;
+	BoolTypeDef	Resolved;
+	uint32_t		Match;								// Record answering the frame, CAPTURE_REPLAYER_NONE if none
+	uint32_t		Cursor;								// Next record of this bus
+} Capture_Replayer_Bus_TypeDef;
+
+typedef struct
+{
+	uint32_t	Matched;
+	uint32_t	Skipped;									// Records passed over to find the next command
+	uint32_t	Unmatched;								// Commands the capture has no record of, the bus reads 0xFF
+	uint32_t	Failed_Transfers;					// Matched records of failed transfers, replayed as good ones
+	uint32_t	CAN_Injected;
+	uint32_t	CAN_Overruns;
+} Capture_Replayer_Statistics_TypeDef;
+
+typedef struct
+{
+	const Capture_Record_TypeDef*				Records;
+	uint32_t														Count;
+	Capture_Replayer_Bus_TypeDef				Bus[2];
+	uint32_t														CAN_Cursor;
+	Capture_Replayer_Statistics_TypeDef	Statistics;
+	Capture_Replayer_Trace_TypeDef			Trace;
+	uint32_t														Diverged_At;		// First own record that differs from the capture
+	double															Wall_ms;
+} Capture_Replayer_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Functions                     ***************	
+********************************************************************************
+*******************************************************************************/
+void 			Capture_Replayer_Trace_Init		(Capture_Replayer_Trace_TypeDef* Trace, Capture_Record_TypeDef* Records, uint32_t Max_Records);
+void 			Capture_Replayer_Trace_Readings	(Capture_Replayer_Trace_TypeDef* Trace, float (*Readings)[BPCU_CHANNELS], uint32_t Max_Readings);
+void 			Capture_Replayer_Trace_Update	(Capture_Replayer_Trace_TypeDef* Trace, const Control_Unit_TypeDef* Control_Unit);
+uint32_t	Capture_Replayer_Compare			(const Capture_Record_TypeDef* A, uint32_t A_Count, const Capture_Record_TypeDef* B, uint32_t B_Count);
+
+void 			Capture_Replayer_Init					(Capture_Replayer_TypeDef* Replayer, const Capture_Record_TypeDef* Records, uint32_t Count,
+																				 Capture_Record_TypeDef* Output, uint32_t Max_Output);
+void 			Capture_Replayer_Run					(Capture_Replayer_TypeDef* Replayer, uint32_t Time_ms);
+uint32_t	Capture_Replayer_Duration_ms	(const Capture_Record_TypeDef* Records, uint32_t Count);
+
+uint32_t	Capture_Replayer_Load					(const char* Path, Capture_Record_TypeDef* Records, uint32_t Max_Records);
+BoolTypeDef Capture_Replayer_Save				(const char* Path, const Capture_Record_TypeDef* Records, uint32_t Count);
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Capture_Replayer.h
+  * @brief          : Replays a Capture ring through the unmodified firmware
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,162 @@
+/**
+  ******************************************************************************
+  * @file           : Filter_Comparison.c
+  * @brief          : Compares the filter types on recorded temperatures
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Filter_Comparison.h"
+#include <math.h>
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Engine                        ***************	
+********************************************************************************
+*******************************************************************************/
+// NVM words giving every channel the type, with the IIR, median and Kalman
+// settings of the unit
+static void Filter_Comparison_Init(Filter_Engine_TypeDef* Engine, const Filter_Engine_TypeDef* Settings, uint8_t Type)
+{
+	uint32_t Config[FILTER_CONFIG_WORDS];
+
+	for(uint8_t i=0; i<FILTER_CONFIG_TYPE_WORDS; i++)
+	{
+		Config[i]=Type*0x01010101UL;
+	}
+	Config[FILTER_CONFIG_IIR_ALPHA]=Settings->IIR_Alpha;
+	Config[FILTER_CONFIG_MEDIAN_LENGTH]=Settings->Median_Length;
+	memcpy(&Config[FILTER_CONFIG_KALMAN_Q],&Settings->Kalman_Q,sizeof(uint32_t));
+	memcpy(&Config[FILTER_CONFIG_KALMAN_R],&Settings->Kalman_R,sizeof(uint32_t));
+
+	memset(Engine,0,sizeof(Filter_Engine_TypeDef));
+	Filter_Engine_Init(Engine,Config);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Comparison                    ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Latency: scans until the output reaches 90% of a step, after the
+ * median window is filled at 0 degC. Noise: mean absolute change of the
+ * output per scan over the readings, oldest first, of the channels in
+ * Channels. The readings are the raw temperatures the engine of the unit was
+ * fed, one row per scan.
+ */
+void Filter_Comparison_Run(const Filter_Engine_TypeDef* Settings, const float (*Readings)[BPCU_CHANNELS], uint32_t Scans,
+													 uint32_t Channels, Filter_Comparison_TypeDef* Comparison)
+{
+	Filter_Engine_TypeDef Engine;
+	float Input[BPCU_CHANNELS];
+	float Value[BPCU_CHANNELS];
+	float Previous[BPCU_CHANNELS];
+
+	memset(Comparison,0,sizeof(Filter_Comparison_TypeDef));
+	Channels&=BPCU_CHANNEL_MASK;
+	Comparison->Scans=Scans;
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Comparison->Channels+=(Channels>>i) & 1U;
+	}
+
+	for(uint8_t Type=0; Type<FILTER_TYPES; Type++)
+	{
+		// Step response
+		Filter_Comparison_Init(&Engine,Settings,Type);
+		memset(Input,0,sizeof(Input));
+		memset(Value,0,sizeof(Value));
+		for(uint8_t Scan=0; Scan<FILTER_MEDIAN_MAX; Scan++)
+		{
+			Filter_Engine_Run(&Engine,Input,Value,0);
+		}
+		for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+		{
+			Input[i]=FILTER_COMPARISON_STEP;
+		}
+		Comparison->Latency[Type]=FILTER_COMPARISON_SCANS;
+		for(uint32_t Scan=1; Scan<=FILTER_COMPARISON_SCANS; Scan++)
+		{
+			Filter_Engine_Run(&Engine,Input,Value,0);
+			if(Value[0]>=0.9f*FILTER_COMPARISON_STEP)
+			{
+				Comparison->Latency[Type]=Scan;
+				break;
+			}
+		}
+
+		// Recorded readings
+		if(Scans<2U || Comparison->Channels==0U)
+		{
+			continue;
+		}
+		Filter_Comparison_Init(&Engine,Settings,Type);
+		memcpy(Value,Readings[0],sizeof(Value));
+		double Noise=0.0;
+		for(uint32_t Scan=0; Scan<Scans; Scan++)
+		{
+			Filter_Engine_Run(&Engine,Readings[Scan],Value,~Channels & BPCU_CHANNEL_MASK);
+			for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+			{
+				if(Scan>0U && ((Channels>>i) & 1U))
+				{
+					Noise+=fabsf(Value[i]-Previous[i]);
+				}
+				Previous[i]=Value[i];
+			}
+		}
+		Comparison->Noise[Type]=Noise*1000.0/((double)(Scans-1U)*Comparison->Channels);
+	}
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Filter_Comparison.c
+  * @brief          : Compares the filter types on recorded temperatures
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file           : Filter_Comparison.h
+  * @brief          : Compares the filter types on recorded temperatures header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef FILTER_COMPARISON_H
+#define FILTER_COMPARISON_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Filter_Engine.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Comparison                    ***************	
+********************************************************************************
+*******************************************************************************/
+#define FILTER_COMPARISON_STEP				10.0f		// degC
+#define FILTER_COMPARISON_SCANS				32U			// Latency reported when 90% is never reached
+
+// Every filter type run on the same readings with the settings of a unit
+typedef struct
+{
+	uint32_t	Latency[FILTER_TYPES];				// Scans to reach 90% of a FILTER_COMPARISON_STEP step
+	double		Noise[FILTER_TYPES];					// Mean change of the output per scan and channel, mdegC
+	uint32_t	Scans;
+	uint8_t		Channels;
+} Filter_Comparison_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Functions                     ***************	
+********************************************************************************
+*******************************************************************************/
+void Filter_Comparison_Run(const Filter_Engine_TypeDef* Settings, const float (*Readings)[BPCU_CHANNELS], uint32_t Scans,
+													 uint32_t Channels, Filter_Comparison_TypeDef* Comparison);
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Filter_Comparison.h
+  * @brief          : Compares the filter types on recorded temperatures header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
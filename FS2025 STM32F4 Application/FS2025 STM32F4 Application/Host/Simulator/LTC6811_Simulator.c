@@ -0,0 +1,841 @@
+/**
+  ******************************************************************************
+  * @file           : LTC6811_Simulator.c
+  * @brief          : Behavioural LTC6811 model behind the host SPI shim
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "LTC6811_Simulator.h"
+#include "LTC6811.h"
+#include <math.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Constants                     ***************	
+********************************************************************************
+*******************************************************************************/
+#define SIM_CMD_WRCFG				0x0001U
+#define SIM_CMD_RDCFG				0x0002U
+#define SIM_CMD_RDCVA				0x0004U
+#define SIM_CMD_RDCVD				0x000AU
+#define SIM_CMD_RDAUXA			0x000CU
+#define SIM_CMD_RDAUXB			0x000EU
+#define SIM_CMD_RDSTATA			0x0010U
+#define SIM_CMD_RDSTATB			0x0012U
+#define SIM_CMD_CLRCELL			0x0711U
+#define SIM_CMD_CLRAUX			0x0712U
+#define SIM_CMD_CLRSTAT			0x0713U
+#define SIM_CMD_PLADC				0x0714U
+#define SIM_CMD_DIAGN				0x0715U
+
+// Fixed bits of the conversion commands, MD, DCP, PUP, ST and the channel
+// fields are cleared by the mask. Bits 15:11 stay in it, only broadcast
+// commands are decoded
+#define SIM_ADCVSC(c)				(((c) & 0xFE6FU)==0x0467U)
+#define SIM_CVST(c)					(((c) & 0xFE1FU)==0x0207U)
+#define SIM_AXST(c)					(((c) & 0xFE1FU)==0x0407U)
+#define SIM_ADCV(c)					(((c) & 0xFE68U)==0x0260U)
+#define SIM_ADOW(c)					(((c) & 0xFE28U)==0x0228U)
+#define SIM_ADSTAT(c)				(((c) & 0xFE78U)==0x0468U)
+#define SIM_ADAX(c)					(((c) & 0xFE78U)==0x0460U)
+
+// Registers a conversion writes: CV 0..11, AUX 12..17, STAT 18..23
+#define SIM_CV(i)						(1UL<<(i))
+#define SIM_CV_ALL					0x00000FFFUL
+#define SIM_AUX(i)					(1UL<<(12+(i)))
+#define SIM_AUX_ALL					0x0003F000UL
+#define SIM_STAT(i)					(1UL<<(18+(i)))
+
+#define SIM_LSB							0.0001f
+#define SIM_SC_LSB					0.002f
+#define SIM_REFERENCE				3.0f
+#define SIM_PI							3.14159265358979
+
+// All cell conversion time by ADCOPT and MD, us
+static const uint32_t LTC6811_Simulator_Conversion_Time[2][4]=
+{
+	{12807U, 1113U, 2335U, 201317U},		// 422 Hz, 27 kHz, 7 kHz, 26 Hz
+	{ 6229U, 1288U, 3033U,   4407U}			// 1 kHz, 14 kHz, 3 kHz, 2 kHz
+};
+
+// Digital filter self-test codes by ST, for 27 kHz, 14 kHz and the rest
+static const uint16_t LTC6811_Simulator_Self_Test_Code[2][3]=
+{
+	{0x9565U, 0x9553U, 0x9555U},
+	{0x6A9AU, 0x6AACU, 0x6AAAU}
+};
+
+// DCTO codes in seconds, 0 disables the discharge timer
+static const uint32_t LTC6811_Simulator_Discharge_Time_s[16]=
+{
+	0U, 30U, 60U, 120U, 180U, 240U, 300U, 600U, 900U, 1200U, 1800U, 2400U, 3600U, 4500U, 5400U, 7200U
+};
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 PEC                           ***************	
+********************************************************************************
+*******************************************************************************/
+// The chip's own PEC15, so a wrong one in the driver does not go unnoticed
+static uint16_t LTC6811_Simulator_PEC(const uint8_t* Data, uint8_t Length)
+{
+	uint16_t Remainder=16;
+
+	for(uint8_t i=0; i<Length; i++)
+	{
+		for(uint8_t Bit=0; Bit<8; Bit++)
+		{
+			uint16_t In=(uint16_t)(((Data[i]>>(7-Bit)) & 1U) ^ ((Remainder>>14) & 1U));
+			Remainder=(uint16_t)((Remainder<<1) & 0x7FFF);
+			if(In!=0)
+			{
+				Remainder^=0x4599;
+			}
+		}
+	}
+	return (uint16_t)(Remainder<<1);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Waveforms                     ***************	
+********************************************************************************
+*******************************************************************************/
+LTC6811_Simulator_Waveform_TypeDef LTC6811_Simulator_Constant(float Value)
+{
+	LTC6811_Simulator_Waveform_TypeDef Waveform={LTC6811_SIMULATOR_CONSTANT, Value, 0.0f, 0U, 0U};
+	return Waveform;
+}
+
+LTC6811_Simulator_Waveform_TypeDef LTC6811_Simulator_Ramp(float From, float To, uint32_t Start_ms, uint32_t Duration_ms)
+{
+	LTC6811_Simulator_Waveform_TypeDef Waveform={LTC6811_SIMULATOR_RAMP, From, To-From, Start_ms, Duration_ms};
+	return Waveform;
+}
+
+LTC6811_Simulator_Waveform_TypeDef LTC6811_Simulator_Sine(float Offset, float Amplitude, uint32_t Period_ms)
+{
+	LTC6811_Simulator_Waveform_TypeDef Waveform={LTC6811_SIMULATOR_SINE, Offset, Amplitude, 0U, Period_ms};
+	return Waveform;
+}
+
+float LTC6811_Simulator_Value(const LTC6811_Simulator_Waveform_TypeDef* Waveform, uint64_t Time_us)
+{
+	double Time_ms=(double)Time_us/1000.0;
+	double Elapsed=Time_ms-(double)Waveform->Start_ms;
+
+	if(Waveform->Shape==LTC6811_SIMULATOR_CONSTANT || Elapsed<0.0)
+	{
+		return Waveform->Offset;
+	}
+	if(Waveform->Shape==LTC6811_SIMULATOR_RAMP)
+	{
+		if(Waveform->Period_ms==0U || Elapsed>=(double)Waveform->Period_ms)
+		{
+			return Waveform->Offset+Waveform->Amplitude;
+		}
+		return Waveform->Offset+(float)(Waveform->Amplitude*Elapsed/Waveform->Period_ms);
+	}
+	if(Waveform->Period_ms==0U)
+	{
+		return Waveform->Offset;
+	}
+	return Waveform->Offset+Waveform->Amplitude*(float)sin(2.0*SIM_PI*Elapsed/Waveform->Period_ms);
+}
+
+/**
+ * @brief Sensor output for a temperature, on the same sensor curve as the
+ * firmware table, so a script in degC reads back as that temperature.
+ */
+float LTC6811_Simulator_Sensor_Voltage(float Temperature)
+{
+	float Low=1.30f;
+	float High=2.44f;
+
+	// The output falls with the temperature
+	for(uint8_t i=0; i<32; i++)
+	{
+		float Middle=0.5f*(Low+High);
+		if(LTC_Voltage_to_Temperature(Middle)>Temperature)
+		{
+			Low=Middle;
+		}
+		else
+		{
+			High=Middle;
+		}
+	}
+	return 0.5f*(Low+High);
+}
+
+void LTC6811_Simulator_Set_Cells(LTC6811_Simulator_TypeDef* Chip, float Voltage)
+{
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Chip->Cell[i]=LTC6811_Simulator_Constant(Voltage);
+	}
+}
+
+void LTC6811_Simulator_Set_Temperatures(LTC6811_Simulator_TypeDef* Chip, float Temperature)
+{
+	float Voltage=LTC6811_Simulator_Sensor_Voltage(Temperature);
+
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Chip->Sensor[i]=LTC6811_Simulator_Constant(Voltage);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Chip State                    ***************	
+********************************************************************************
+*******************************************************************************/
+static void LTC6811_Simulator_Clear(uint16_t* Registers, uint8_t Count)
+{
+	for(uint8_t i=0; i<Count; i++)
+	{
+		Registers[i]=0xFFFF;
+	}
+}
+
+// Register contents of a core that just powered up, STBR5 keeps no flag
+static void LTC6811_Simulator_Reset_Registers(LTC6811_Simulator_TypeDef* Chip)
+{
+	LTC6811_Simulator_Clear(Chip->CV,LTC6811_SIMULATOR_INPUTS);
+	LTC6811_Simulator_Clear(Chip->AUX,6);
+	LTC6811_Simulator_Clear(Chip->STAT,6);
+	Chip->STAT[5]=0x00FFU;
+}
+
+static uint16_t LTC6811_Simulator_Code(float Voltage, float LSB)
+{
+	float Code=Voltage/LSB+0.5f;
+	return (Code<0.0f) ? 0 : (Code>65535.0f) ? 0xFFFF : (uint16_t)Code;
+}
+
+uint16_t LTC6811_Simulator_Discharge(const LTC6811_Simulator_TypeDef* Chip)
+{
+	return (uint16_t)(Chip->CFGR[4] | ((Chip->CFGR[5] & 0x0FU)<<8));
+}
+
+/**
+ * @brief Brings the chip to the current virtual time: the wake up, the end of
+ * the running conversion, the discharge timer and the watchdog, which sends
+ * the core to sleep after tSLEEP without a valid command. The configuration
+ * is lost then, except the discharge while its timer is running.
+ */
+void LTC6811_Simulator_Update(LTC6811_Simulator_TypeDef* Chip)
+{
+	uint64_t Now=Host_Get_Time_us();
+
+	if(Chip->State==LTC6811_SIMULATOR_WAKING && Now>=Chip->Wake_Time)
+	{
+		Chip->State=LTC6811_SIMULATOR_STANDBY;
+		Chip->Watchdog_Time=Chip->Wake_Time;
+	}
+	if(Chip->Converting==TRUE && Now>=Chip->Conversion_End)
+	{
+		for(uint8_t i=0; i<24; i++)
+		{
+			if((Chip->Next_Mask & (1UL<<i))==0)
+			{
+				continue;
+			}
+			if(i<12)
+			{
+				Chip->CV[i]=Chip->Next_CV[i];
+			}
+			else if(i<18)
+			{
+				Chip->AUX[i-12]=Chip->Next_AUX[i-12];
+			}
+			else
+			{
+				Chip->STAT[i-18]=Chip->Next_STAT[i-18];
+			}
+		}
+		Chip->Converting=FALSE;
+		Chip->State=(Chip->CFGR[0] & LTC6811_CFGR0_REFON) ? LTC6811_SIMULATOR_REFUP : LTC6811_SIMULATOR_STANDBY;
+	}
+	if(Chip->Discharge_End!=0 && Now>=Chip->Discharge_End)
+	{
+		Chip->CFGR[4]=0;
+		Chip->CFGR[5]&=0xF0;
+		Chip->Discharge_End=0;
+		Chip->Statistics.Discharge_Timeouts++;
+	}
+	if(Chip->State>=LTC6811_SIMULATOR_STANDBY && Now-Chip->Watchdog_Time>=LTC6811_SIMULATOR_SLEEP_US)
+	{
+		uint8_t CFGR4=Chip->CFGR[4];
+		uint8_t CFGR5=Chip->CFGR[5];
+
+		memset(Chip->CFGR,0,sizeof(Chip->CFGR));
+		Chip->CFGR[0]=LTC6811_SIMULATOR_CFGR0_DEFAULT;
+		if(Chip->Discharge_End!=0)
+		{
+			Chip->CFGR[4]=CFGR4;
+			Chip->CFGR[5]=CFGR5;
+		}
+		LTC6811_Simulator_Reset_Registers(Chip);
+		Chip->Converting=FALSE;
+		Chip->State=LTC6811_SIMULATOR_SLEEP;
+		Chip->Statistics.Sleeps++;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Conversions                   ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief What the inputs read now. The board switches the temperature sensor
+ * onto the input while the DCC bit of the cell is on, whatever DCP says.
+ */
+static void LTC6811_Simulator_Sample(const LTC6811_Simulator_TypeDef* Chip, float* Inputs, uint64_t Now)
+{
+	uint16_t Discharge=LTC6811_Simulator_Discharge(Chip);
+
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Inputs[i]=(Discharge & (1U<<i)) ? LTC6811_Simulator_Value(&Chip->Sensor[i],Now) : LTC6811_Simulator_Value(&Chip->Cell[i],Now);
+	}
+}
+
+// Under and over voltage flags of the cells in the status group B, two bits per cell
+static void LTC6811_Simulator_Cell_Flags(LTC6811_Simulator_TypeDef* Chip)
+{
+	uint32_t Under=((uint32_t)Chip->CFGR[1] | ((uint32_t)(Chip->CFGR[2] & 0x0FU)<<8))+1U;
+	uint32_t Over=((uint32_t)(Chip->CFGR[2]>>4) | ((uint32_t)Chip->CFGR[3]<<4));
+	uint32_t Flags=0;
+
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Flags|=(Chip->Next_CV[i]<=Under*16U) ? 1UL<<(2*i) : 0;
+		Flags|=(Chip->Next_CV[i]>Over*16U) ? 1UL<<(2*i+1) : 0;
+	}
+	Chip->Next_STAT[4]=(uint16_t)Flags;
+	Chip->Next_STAT[5]=(uint16_t)((Chip->STAT[5] & 0xFF00U) | ((Flags>>16) & 0xFFU));
+	Chip->Next_Mask|=SIM_STAT(4) | SIM_STAT(5);
+}
+
+/**
+ * @brief The inputs are sampled when the command arrives and the registers
+ * written when the conversion ends. From standby the reference powers up
+ * first, tREFUP, unless REFON kept it up.
+ */
+static void LTC6811_Simulator_Start(LTC6811_Simulator_TypeDef* Chip, uint32_t Time_us)
+{
+	uint64_t Now=Host_Get_Time_us();
+	uint64_t Start=Now;
+
+	if(Chip->State==LTC6811_SIMULATOR_STANDBY)
+	{
+		Chip->Reference_Time=Now+LTC6811_SIMULATOR_REFUP_US;
+	}
+	if(Chip->Reference_Time>Start)
+	{
+		Start=Chip->Reference_Time;
+	}
+	Chip->Conversion_End=(Chip->Faults.ADC_Stuck==TRUE) ? UINT64_MAX : Start+Time_us;
+	Chip->Converting=TRUE;
+	Chip->State=LTC6811_SIMULATOR_MEASURE;
+	Chip->Statistics.Conversions++;
+}
+
+static uint32_t LTC6811_Simulator_Time(const LTC6811_Simulator_TypeDef* Chip, uint16_t Command, uint32_t Slots)
+{
+	uint8_t MD=(uint8_t)((Command>>7) & 0x03U);
+	return LTC6811_Simulator_Conversion_Time[Chip->CFGR[0] & LTC6811_CFGR0_ADCOPT][MD]*Slots/6U;
+}
+
+static uint16_t LTC6811_Simulator_Self_Test(const LTC6811_Simulator_TypeDef* Chip, uint16_t Command)
+{
+	uint8_t MD=(uint8_t)((Command>>7) & 0x03U);
+	uint8_t ST=(uint8_t)((Command>>5) & 0x03U);
+	uint8_t Rate=(MD!=LTC6811_MD_FAST) ? 2 : (Chip->CFGR[0] & LTC6811_CFGR0_ADCOPT) ? 1 : 0;
+	return LTC6811_Simulator_Self_Test_Code[ST-1][Rate];
+}
+
+// ADCV and ADCVSC: all cells or the pair of CH, and SC as the sum of the inputs
+static void LTC6811_Simulator_Convert_Cells(LTC6811_Simulator_TypeDef* Chip, uint16_t Command, BoolTypeDef Sum_Of_Cells)
+{
+	uint8_t Channel=(Sum_Of_Cells==TRUE) ? 0 : (uint8_t)(Command & 0x07U);
+	float Inputs[LTC6811_SIMULATOR_INPUTS];
+	float Sum=Chip->Faults.Sum_Offset;
+
+	LTC6811_Simulator_Sample(Chip,Inputs,Host_Get_Time_us());
+	Chip->Next_Mask=0;
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Sum+=Inputs[i];
+		if(Channel==0 || i%6==Channel-1)
+		{
+			// A glitch is an error of the cell reading, SC does not see it
+			float Glitch=(Chip->Faults.Glitch_Conversions>0 && Chip->Faults.Glitch_Input==i) ? Chip->Faults.Glitch_Offset : 0.0f;
+			Chip->Next_CV[i]=LTC6811_Simulator_Code(Inputs[i]+Glitch,SIM_LSB);
+			Chip->Next_Mask|=SIM_CV(i);
+		}
+		else
+		{
+			Chip->Next_CV[i]=Chip->CV[i];
+		}
+	}
+	if(Chip->Faults.Glitch_Conversions>0)
+	{
+		Chip->Faults.Glitch_Conversions--;
+	}
+	LTC6811_Simulator_Cell_Flags(Chip);
+	if(Sum_Of_Cells==TRUE)
+	{
+		Chip->Next_STAT[0]=LTC6811_Simulator_Code(Sum,SIM_SC_LSB);
+		Chip->Next_Mask|=SIM_STAT(0);
+	}
+	LTC6811_Simulator_Start(Chip,LTC6811_Simulator_Time(Chip,Command,(Sum_Of_Cells==TRUE) ? 7U : (Channel==0) ? 6U : 1U));
+}
+
+/**
+ * @brief ADOW: an open Cn floats to Cn+1 with the pull-up and to Cn-1 with the
+ * pull-down, so the cell above it reads zero in one and both cells in the
+ * other. An open C0 zeroes cell 1 with the pull-up, an open C12 cell 12 with
+ * the pull-down.
+ */
+static void LTC6811_Simulator_Open_Wire(LTC6811_Simulator_TypeDef* Chip, uint16_t Command)
+{
+	BoolTypeDef Pull_Up=(Command & 0x0040U) ? TRUE : FALSE;
+	float Inputs[LTC6811_SIMULATOR_INPUTS];
+
+	LTC6811_Simulator_Sample(Chip,Inputs,Host_Get_Time_us());
+	if((Chip->Faults.Open_Pins & 0x0001U) && Pull_Up==TRUE)
+	{
+		Inputs[0]=0.0f;
+	}
+	if((Chip->Faults.Open_Pins & 0x1000U) && Pull_Up==FALSE)
+	{
+		Inputs[11]=0.0f;
+	}
+	for(uint8_t n=1; n<12; n++)
+	{
+		if(Chip->Faults.Open_Pins & (1U<<n))
+		{
+			float Both=Inputs[n-1]+Inputs[n];
+			Inputs[n]=(Pull_Up==TRUE) ? 0.0f : Both;
+			Inputs[n-1]=(Pull_Up==TRUE) ? Both : 0.0f;
+		}
+	}
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Chip->Next_CV[i]=LTC6811_Simulator_Code(Inputs[i],SIM_LSB);
+	}
+	Chip->Next_Mask=SIM_CV_ALL;
+	LTC6811_Simulator_Start(Chip,LTC6811_Simulator_Time(Chip,Command,6U));
+}
+
+// ADSTAT: SC, die temperature, analog and digital supplies
+static void LTC6811_Simulator_Convert_Status(LTC6811_Simulator_TypeDef* Chip, uint16_t Command)
+{
+	uint8_t Group=(uint8_t)(Command & 0x07U);
+	float Sum=Chip->Faults.Sum_Offset;
+	float Inputs[LTC6811_SIMULATOR_INPUTS];
+
+	LTC6811_Simulator_Sample(Chip,Inputs,Host_Get_Time_us());
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Sum+=Inputs[i];
+	}
+	Chip->Next_STAT[0]=LTC6811_Simulator_Code(Sum,SIM_SC_LSB);
+	Chip->Next_STAT[1]=LTC6811_Simulator_Code((Chip->Die_Temperature+273.0f)*0.0075f,SIM_LSB);
+	Chip->Next_STAT[2]=LTC6811_Simulator_Code(Chip->Analog_Supply,SIM_LSB);
+	Chip->Next_STAT[3]=LTC6811_Simulator_Code(Chip->Digital_Supply,SIM_LSB);
+	Chip->Next_Mask=(Group==0) ? (SIM_STAT(0) | SIM_STAT(1) | SIM_STAT(2) | SIM_STAT(3)) : SIM_STAT(Group-1);
+	LTC6811_Simulator_Start(Chip,LTC6811_Simulator_Time(Chip,Command,(Group==0) ? 4U : 1U));
+}
+
+// ADAX: GPIO 1 to 5 and the second reference
+static void LTC6811_Simulator_Convert_Aux(LTC6811_Simulator_TypeDef* Chip, uint16_t Command)
+{
+	uint8_t Group=(uint8_t)(Command & 0x07U);
+
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_GPIOS; i++)
+	{
+		Chip->Next_AUX[i]=LTC6811_Simulator_Code(Chip->GPIO[i],SIM_LSB);
+	}
+	Chip->Next_AUX[5]=LTC6811_Simulator_Code(SIM_REFERENCE,SIM_LSB);
+	Chip->Next_Mask=(Group==0) ? SIM_AUX_ALL : SIM_AUX(Group-1);
+	LTC6811_Simulator_Start(Chip,LTC6811_Simulator_Time(Chip,Command,(Group==0) ? 6U : 1U));
+}
+
+static void LTC6811_Simulator_Convert_Self_Test(LTC6811_Simulator_TypeDef* Chip, uint16_t Command, BoolTypeDef Cells)
+{
+	uint16_t Code=LTC6811_Simulator_Self_Test(Chip,Command);
+
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Chip->Next_CV[i]=Code;
+	}
+	for(uint8_t i=0; i<6; i++)
+	{
+		Chip->Next_AUX[i]=Code;
+	}
+	Chip->Next_Mask=(Cells==TRUE) ? SIM_CV_ALL : SIM_AUX_ALL;
+	LTC6811_Simulator_Start(Chip,LTC6811_Simulator_Time(Chip,Command,6U));
+}
+
+static void LTC6811_Simulator_Diagnose(LTC6811_Simulator_TypeDef* Chip)
+{
+	Chip->Next_STAT[5]=(uint16_t)(Chip->STAT[5] & ~(LTC6811_STBR5_MUXFAIL<<8));
+	if(Chip->Faults.Mux_Fail==TRUE)
+	{
+		Chip->Next_STAT[5]|=(uint16_t)(LTC6811_STBR5_MUXFAIL<<8);
+	}
+	Chip->Next_Mask=SIM_STAT(5);
+	LTC6811_Simulator_Start(Chip,LTC6811_SIMULATOR_DIAGN_US);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Registers                     ***************	
+********************************************************************************
+*******************************************************************************/
+static void LTC6811_Simulator_Reply(LTC6811_Simulator_TypeDef* Chip, const uint16_t* Registers)
+{
+	for(uint8_t i=0; i<3; i++)
+	{
+		Chip->Reply[2*i]=(uint8_t)Registers[i];
+		Chip->Reply[2*i+1]=(uint8_t)(Registers[i]>>8);
+	}
+}
+
+static void LTC6811_Simulator_Read(LTC6811_Simulator_TypeDef* Chip, uint16_t Command)
+{
+	uint16_t Status[3];
+
+	if(Command==SIM_CMD_RDCFG)
+	{
+		memcpy(Chip->Reply,Chip->CFGR,6);
+	}
+	else if(Command<=SIM_CMD_RDCVD)
+	{
+		LTC6811_Simulator_Reply(Chip,&Chip->CV[3*((Command-SIM_CMD_RDCVA)/2)]);
+	}
+	else if(Command<=SIM_CMD_RDAUXB)
+	{
+		LTC6811_Simulator_Reply(Chip,&Chip->AUX[3*((Command-SIM_CMD_RDAUXA)/2)]);
+	}
+	else
+	{
+		memcpy(Status,&Chip->STAT[(Command==SIM_CMD_RDSTATA) ? 0 : 3],sizeof(Status));
+		if(Command==SIM_CMD_RDSTATB)
+		{
+			Status[2]=(uint16_t)((Status[2] & 0x0EFFU) | ((uint16_t)(Chip->Revision & 0x0FU)<<12));
+			Status[2]|=(Chip->Faults.Thermal_Shutdown==TRUE) ? (uint16_t)(LTC6811_STBR5_THSD<<8) : 0;
+		}
+		LTC6811_Simulator_Reply(Chip,Status);
+	}
+
+	uint16_t PEC=LTC6811_Simulator_PEC(Chip->Reply,6);
+	Chip->Reply[6]=(uint8_t)(PEC>>8);
+	Chip->Reply[7]=(uint8_t)PEC;
+	if(Chip->Faults.Corrupt_Reads>0)
+	{
+		Chip->Faults.Corrupt_Reads--;
+		Chip->Reply[0]^=0x01;
+		Chip->Statistics.Corrupted_Reads++;
+	}
+	Chip->Statistics.Register_Reads++;
+	Chip->Frame=LTC6811_SIMULATOR_FRAME_READ;
+}
+
+/**
+ * @brief WRCFG data with a valid PEC. A DCTO code starts the discharge timer,
+ * REFON powers the reference up from standby.
+ */
+static void LTC6811_Simulator_Write(LTC6811_Simulator_TypeDef* Chip)
+{
+	uint64_t Now=Host_Get_Time_us();
+
+	if(LTC6811_Simulator_PEC(&Chip->Bytes[4],6)!=(uint16_t)((Chip->Bytes[10]<<8) | Chip->Bytes[11]))
+	{
+		Chip->Statistics.Data_PEC_Errors++;
+		return;
+	}
+	Chip->Statistics.Config_Writes++;
+	if(Chip->Faults.Config_Stuck==TRUE)
+	{
+		return;
+	}
+	memcpy(Chip->CFGR,&Chip->Bytes[4],6);
+
+	uint32_t Timeout=LTC6811_Simulator_Discharge_Time_s[Chip->CFGR[5]>>4];
+	Chip->Discharge_End=(Timeout!=0 && LTC6811_Simulator_Discharge(Chip)!=0) ? Now+(uint64_t)Timeout*1000000U : 0;
+
+	if((Chip->CFGR[0] & LTC6811_CFGR0_REFON) && Chip->State==LTC6811_SIMULATOR_STANDBY)
+	{
+		Chip->State=LTC6811_SIMULATOR_REFUP;
+		Chip->Reference_Time=Now+LTC6811_SIMULATOR_REFUP_US;
+	}
+	else if((Chip->CFGR[0] & LTC6811_CFGR0_REFON)==0 && Chip->State==LTC6811_SIMULATOR_REFUP)
+	{
+		Chip->State=LTC6811_SIMULATOR_STANDBY;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Commands                      ***************	
+********************************************************************************
+*******************************************************************************/
+static void LTC6811_Simulator_Command(LTC6811_Simulator_TypeDef* Chip)
+{
+	uint16_t Command=(uint16_t)((Chip->Bytes[0]<<8) | Chip->Bytes[1]);
+	uint8_t ST=(uint8_t)((Command>>5) & 0x03U);
+
+	if(LTC6811_Simulator_PEC(Chip->Bytes,2)!=(uint16_t)((Chip->Bytes[2]<<8) | Chip->Bytes[3]))
+	{
+		Chip->Statistics.Command_PEC_Errors++;
+		Chip->Frame=LTC6811_SIMULATOR_FRAME_IGNORE;
+		return;
+	}
+	Chip->Statistics.Commands++;
+	Chip->Watchdog_Time=Host_Get_Time_us();
+	Chip->Frame=LTC6811_SIMULATOR_FRAME_IGNORE;
+
+	if(Command==SIM_CMD_WRCFG)
+	{
+		Chip->Frame=LTC6811_SIMULATOR_FRAME_WRITE;
+	}
+	else if(Command==SIM_CMD_RDCFG || (Command>=SIM_CMD_RDCVA && Command<=SIM_CMD_RDSTATB && (Command & 1U)==0))
+	{
+		LTC6811_Simulator_Read(Chip,Command);
+	}
+	else if(Command==SIM_CMD_PLADC)
+	{
+		Chip->Frame=LTC6811_SIMULATOR_FRAME_POLL;
+	}
+	else if(Command==SIM_CMD_DIAGN)
+	{
+		LTC6811_Simulator_Diagnose(Chip);
+	}
+	else if(Command==SIM_CMD_CLRCELL)
+	{
+		LTC6811_Simulator_Clear(Chip->CV,LTC6811_SIMULATOR_INPUTS);
+	}
+	else if(Command==SIM_CMD_CLRAUX)
+	{
+		LTC6811_Simulator_Clear(Chip->AUX,6);
+	}
+	else if(Command==SIM_CMD_CLRSTAT)
+	{
+		LTC6811_Simulator_Clear(Chip->STAT,5);
+		Chip->STAT[5]|=0x00FFU;
+	}
+	else if(SIM_ADCVSC(Command))
+	{
+		LTC6811_Simulator_Convert_Cells(Chip,Command,TRUE);
+	}
+	else if(SIM_CVST(Command) && ST>=1 && ST<=2)
+	{
+		LTC6811_Simulator_Convert_Self_Test(Chip,Command,TRUE);
+	}
+	else if(SIM_AXST(Command) && ST>=1 && ST<=2)
+	{
+		LTC6811_Simulator_Convert_Self_Test(Chip,Command,FALSE);
+	}
+	else if(SIM_ADCV(Command) && (Command & 0x07U)!=7U)
+	{
+		LTC6811_Simulator_Convert_Cells(Chip,Command,FALSE);
+	}
+	else if(SIM_ADOW(Command) && (Command & 0x07U)==0U)
+	{
+		LTC6811_Simulator_Open_Wire(Chip,Command);
+	}
+	else if(SIM_ADSTAT(Command) && (Command & 0x07U)<=4U)
+	{
+		LTC6811_Simulator_Convert_Status(Chip,Command);
+	}
+	else if(SIM_ADAX(Command))
+	{
+		LTC6811_Simulator_Convert_Aux(Chip,Command);
+	}
+	else
+	{
+		Chip->Statistics.Unknown_Commands++;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 SPI Device                    ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief A chip select falling edge wakes a sleeping core, the frame that
+ * woke it and any frame until tWAKE has passed are lost.
+ */
+static void LTC6811_Simulator_Select(void* Context, BoolTypeDef Selected)
+{
+	LTC6811_Simulator_TypeDef* Chip=(LTC6811_Simulator_TypeDef*)Context;
+
+	LTC6811_Simulator_Update(Chip);
+	Chip->Count=0;
+	Chip->Frame=LTC6811_SIMULATOR_FRAME_COMMAND;
+	if(Selected==FALSE)
+	{
+		return;
+	}
+	if(Chip->Faults.Dead==TRUE)
+	{
+		Chip->Frame=LTC6811_SIMULATOR_FRAME_IGNORE;
+		return;
+	}
+	if(Chip->State==LTC6811_SIMULATOR_SLEEP)
+	{
+		Chip->State=LTC6811_SIMULATOR_WAKING;
+		Chip->Wake_Time=Host_Get_Time_us()+LTC6811_SIMULATOR_WAKE_US;
+		Chip->Statistics.Wake_Ups++;
+	}
+	if(Chip->State==LTC6811_SIMULATOR_WAKING)
+	{
+		Chip->Frame=LTC6811_SIMULATOR_FRAME_IGNORE;
+		Chip->Statistics.Ignored_Frames++;
+	}
+}
+
+static uint8_t LTC6811_Simulator_Exchange(void* Context, uint8_t Byte)
+{
+	LTC6811_Simulator_TypeDef* Chip=(LTC6811_Simulator_TypeDef*)Context;
+	uint8_t Index=Chip->Count;
+
+	LTC6811_Simulator_Update(Chip);
+	if(Chip->Count<sizeof(Chip->Bytes))
+	{
+		Chip->Bytes[Chip->Count]=Byte;
+	}
+	if(Chip->Count<UINT8_MAX)
+	{
+		Chip->Count++;
+	}
+
+	switch(Chip->Frame)
+	{
+		case LTC6811_SIMULATOR_FRAME_COMMAND:
+			if(Chip->Count==4)
+			{
+				LTC6811_Simulator_Command(Chip);
+			}
+			return 0xFF;
+
+		case LTC6811_SIMULATOR_FRAME_WRITE:
+			if(Chip->Count==12)
+			{
+				LTC6811_Simulator_Write(Chip);
+			}
+			return 0xFF;
+
+		case LTC6811_SIMULATOR_FRAME_READ:
+			return (Index-4U<sizeof(Chip->Reply)) ? Chip->Reply[Index-4] : 0xFF;
+
+		case LTC6811_SIMULATOR_FRAME_POLL:
+			// SDO held low while converting
+			if(Index==4 && Chip->Converting==TRUE)
+			{
+				Chip->Statistics.Busy_Polls++;
+			}
+			return (Chip->Converting==TRUE) ? 0x00 : 0xFF;
+
+		default:
+			return 0xFF;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief A powered chip, asleep, with every cell at the default voltage and
+ * every sensor at 25 degC and no fault.
+ */
+void LTC6811_Simulator_Init(LTC6811_Simulator_TypeDef* Chip)
+{
+	memset(Chip,0,sizeof(LTC6811_Simulator_TypeDef));
+	LTC6811_Simulator_Set_Cells(Chip,LTC6811_SIMULATOR_DEFAULT_CELL);
+	for(uint8_t i=0; i<LTC6811_SIMULATOR_INPUTS; i++)
+	{
+		Chip->Sensor[i]=LTC6811_Simulator_Constant(LTC6811_SIMULATOR_DEFAULT_SENSOR);
+	}
+	Chip->Die_Temperature=25.0f;
+	Chip->Analog_Supply=5.0f;
+	Chip->Digital_Supply=3.0f;
+	Chip->Revision=1;
+	Chip->State=LTC6811_SIMULATOR_SLEEP;
+	Chip->CFGR[0]=LTC6811_SIMULATOR_CFGR0_DEFAULT;
+	LTC6811_Simulator_Reset_Registers(Chip);
+}
+
+void LTC6811_Simulator_Attach(LTC6811_Simulator_TypeDef* Chip, uint8_t SPI)
+{
+	Host_SPI_Device_TypeDef Device={Chip, LTC6811_Simulator_Select, LTC6811_Simulator_Exchange};
+
+	Host_SPI_Attach(SPI,&Device);
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : LTC6811_Simulator.c
+  * @brief          : Behavioural LTC6811 model behind the host SPI shim
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,222 @@
+/**
+  ******************************************************************************
+  * @file           : LTC6811_Simulator.h
+  * @brief          : Behavioural LTC6811 model behind the host SPI shim
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef LTC6811_SIMULATOR_H
+#define LTC6811_SIMULATOR_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Host.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Timing                        ***************	
+********************************************************************************
+*******************************************************************************/
+#define LTC6811_SIMULATOR_INPUTS					12U
+#define LTC6811_SIMULATOR_GPIOS						5U
+
+// tWAKE, tSLEEP (watchdog) and tREFUP, typical values of the datasheet
+#define LTC6811_SIMULATOR_WAKE_US					300U
+#define LTC6811_SIMULATOR_SLEEP_US				2000000U
+#define LTC6811_SIMULATOR_REFUP_US				3500U
+#define LTC6811_SIMULATOR_DIAGN_US				400U
+
+// Cell voltages and sensors before any script, the sensors read 25 degC
+#define LTC6811_SIMULATOR_DEFAULT_CELL		3.60f
+#define LTC6811_SIMULATOR_DEFAULT_SENSOR	1.86f
+
+// Power up CFGR0: GPIO pull-downs off
+#define LTC6811_SIMULATOR_CFGR0_DEFAULT		0xF8U
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Scripts                       ***************	
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	LTC6811_SIMULATOR_CONSTANT,
+	LTC6811_SIMULATOR_RAMP,				// Offset until Start, Offset+Amplitude after Start+Period
+	LTC6811_SIMULATOR_SINE				// Offset+Amplitude*sin from Start, Period long cycles
+} LTC6811_Simulator_Shape_TypeDef;
+
+// A voltage as a function of the virtual time, in V and ms
+typedef struct
+{
+	LTC6811_Simulator_Shape_TypeDef	Shape;
+	float														Offset;
+	float														Amplitude;
+	uint32_t												Start_ms;
+	uint32_t												Period_ms;
+} LTC6811_Simulator_Waveform_TypeDef;
+
+// Faults the chip or its wiring can show, all off after LTC6811_Simulator_Init
+typedef struct
+{
+	BoolTypeDef	Dead;									// No answer at all, MISO stays high
+	uint32_t		Corrupt_Reads;				// The next register reads leave with a bad PEC
+	BoolTypeDef	ADC_Stuck;						// Conversions never end, PLADC stays busy
+	BoolTypeDef	Config_Stuck;					// WRCFG is accepted but not applied
+	uint16_t		Open_Pins;						// Bit n for an open Cn sense wire
+	BoolTypeDef	Mux_Fail;							// DIAGN sets MUXFAIL
+	BoolTypeDef	Thermal_Shutdown;			// THSD flag set
+	float				Sum_Offset;						// V added to SC, the inputs do not add up
+	uint8_t			Glitch_Input;					// Input 0..11 read with Glitch_Offset...
+	float				Glitch_Offset;
+	uint32_t		Glitch_Conversions;		// ...for this many conversions
+} LTC6811_Simulator_Faults_TypeDef;
+
+typedef struct
+{
+	uint32_t	Commands;
+	uint32_t	Command_PEC_Errors;
+	uint32_t	Data_PEC_Errors;
+	uint32_t	Unknown_Commands;
+	uint32_t	Ignored_Frames;				// Chip select frames while asleep or waking up
+	uint32_t	Wake_Ups;
+	uint32_t	Sleeps;
+	uint32_t	Conversions;
+	uint32_t	Busy_Polls;
+	uint32_t	Register_Reads;
+	uint32_t	Config_Writes;
+	uint32_t	Corrupted_Reads;
+	uint32_t	Discharge_Timeouts;
+} LTC6811_Simulator_Statistics_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Chip                          ***************	
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	LTC6811_SIMULATOR_SLEEP,
+	LTC6811_SIMULATOR_WAKING,
+	LTC6811_SIMULATOR_STANDBY,
+	LTC6811_SIMULATOR_REFUP,
+	LTC6811_SIMULATOR_MEASURE
+} LTC6811_Simulator_State_TypeDef;
+
+typedef enum
+{
+	LTC6811_SIMULATOR_FRAME_COMMAND,
+	LTC6811_SIMULATOR_FRAME_WRITE,
+	LTC6811_SIMULATOR_FRAME_READ,
+	LTC6811_SIMULATOR_FRAME_POLL,
+	LTC6811_SIMULATOR_FRAME_IGNORE
+} LTC6811_Simulator_Frame_TypeDef;
+
+typedef struct
+{
+	// Set by the tests
+	LTC6811_Simulator_Waveform_TypeDef		Cell[LTC6811_SIMULATOR_INPUTS];
+	LTC6811_Simulator_Waveform_TypeDef		Sensor[LTC6811_SIMULATOR_INPUTS];
+	float																	GPIO[LTC6811_SIMULATOR_GPIOS];
+	float																	Die_Temperature;
+	float																	Analog_Supply;
+	float																	Digital_Supply;
+	uint8_t																Revision;
+	LTC6811_Simulator_Faults_TypeDef			Faults;
+	LTC6811_Simulator_Statistics_TypeDef	Statistics;
+
+	// Chip state
+	LTC6811_Simulator_State_TypeDef	State;
+	uint64_t		Wake_Time;
+	uint64_t		Watchdog_Time;
+	uint64_t		Reference_Time;
+	uint64_t		Conversion_End;
+	uint64_t		Discharge_End;
+	BoolTypeDef	Converting;
+	uint8_t			CFGR[6];
+	uint16_t		CV[LTC6811_SIMULATOR_INPUTS];
+	uint16_t		AUX[6];
+	uint16_t		STAT[6];
+	uint16_t		Next_CV[LTC6811_SIMULATOR_INPUTS];
+	uint16_t		Next_AUX[6];
+	uint16_t		Next_STAT[6];
+	uint32_t		Next_Mask;						// Registers the running conversion writes
+
+	// Chip select frame in progress
+	LTC6811_Simulator_Frame_TypeDef	Frame;
+	uint8_t			Bytes[12];
+	uint8_t			Count;
+	uint8_t			Reply[8];
+} LTC6811_Simulator_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Functions                     ***************	
+********************************************************************************
+*******************************************************************************/
+void 	LTC6811_Simulator_Init					(LTC6811_Simulator_TypeDef* Chip);
+void 	LTC6811_Simulator_Attach				(LTC6811_Simulator_TypeDef* Chip, uint8_t SPI);
+void 	LTC6811_Simulator_Update				(LTC6811_Simulator_TypeDef* Chip);
+
+LTC6811_Simulator_Waveform_TypeDef LTC6811_Simulator_Constant	(float Value);
+LTC6811_Simulator_Waveform_TypeDef LTC6811_Simulator_Ramp			(float From, float To, uint32_t Start_ms, uint32_t Duration_ms);
+LTC6811_Simulator_Waveform_TypeDef LTC6811_Simulator_Sine			(float Offset, float Amplitude, uint32_t Period_ms);
+float	LTC6811_Simulator_Value					(const LTC6811_Simulator_Waveform_TypeDef* Waveform, uint64_t Time_us);
+
+float	LTC6811_Simulator_Sensor_Voltage	(float Temperature);
+void 	LTC6811_Simulator_Set_Cells			(LTC6811_Simulator_TypeDef* Chip, float Voltage);
+void 	LTC6811_Simulator_Set_Temperatures	(LTC6811_Simulator_TypeDef* Chip, float Temperature);
+
+uint16_t	LTC6811_Simulator_Discharge		(const LTC6811_Simulator_TypeDef* Chip);
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : LTC6811_Simulator.h
+  * @brief          : Behavioural LTC6811 model behind the host SPI shim
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file           : Node_Image.c
+  * @brief          : One firmware image per pack unit, loaded side by side by the bus tests
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Node_Image.h"
+#include "Can_Bus.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Unit                          ***************	
+********************************************************************************
+*******************************************************************************/
+#if defined(BATTERY_PACK_CONTROL_UNIT_4)
+	#define NODE_IMAGE_UNIT		4U
+#elif defined(BATTERY_PACK_CONTROL_UNIT_3)
+	#define NODE_IMAGE_UNIT		3U
+#elif defined(BATTERY_PACK_CONTROL_UNIT_2)
+	#define NODE_IMAGE_UNIT		2U
+#else
+	#define NODE_IMAGE_UNIT		1U
+#endif
+
+#define NODE_IMAGE_EXPORT		__attribute__((visibility("default")))
+
+// Chip 1 holds the channels 0 to 11, chip 2 the channels 12 to 23
+static LTC6811_Simulator_TypeDef Node_Image_Chip[2];
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Functions                     ***************	
+********************************************************************************
+*******************************************************************************/
+static void Node_Image_Boot(void)
+{
+	LTC6811_Simulator_Init(&Node_Image_Chip[0]);
+	LTC6811_Simulator_Init(&Node_Image_Chip[1]);
+	LTC6811_Simulator_Attach(&Node_Image_Chip[0],HOST_SPI_1);
+	LTC6811_Simulator_Attach(&Node_Image_Chip[1],HOST_SPI_2);
+
+	Host_Reset();
+	Host_CAN1_Hold(TRUE);
+	memset((void*)&CONTROL_UNIT,0,sizeof(CONTROL_UNIT));
+	Control_Unit_MCU_Init();
+	Control_Unit_Init();
+}
+
+/**
+ * @brief Whole main loop passes, so the clock can end up to one pass after
+ * the time. The host transmit log is dropped: the frames are on the bus.
+ */
+static void Node_Image_Run_Until(uint64_t Time_us)
+{
+	uint64_t Now=Host_Get_Time_us();
+	Host_CAN_Frame_TypeDef Frame;
+
+	if(Now<Time_us)
+	{
+		Host_Run_ms((uint32_t)((Time_us-Now+999U)/1000U));
+	}
+	while(Host_CAN1_Take(&Frame)==TRUE)
+	{
+	}
+}
+
+static void Node_Image_Set_Temperatures(float Temperature)
+{
+	LTC6811_Simulator_Set_Temperatures(&Node_Image_Chip[0],Temperature);
+	LTC6811_Simulator_Set_Temperatures(&Node_Image_Chip[1],Temperature);
+}
+
+static BoolTypeDef Node_Image_Receive(const Host_CAN_Frame_TypeDef* Frame)
+{
+	return Host_CAN1_Inject(Frame->Id,Frame->DLC,Frame->Data);
+}
+
+static const Node_Image_TypeDef Node_Image=
+{
+	.Unit=NODE_IMAGE_UNIT,
+	.Init_Measure_Id=BPCU_INIT_MEASURE_DEF,
+	.Finished_Id=BPCU_FINISHED_MEASURE,
+	.Status_Id=BPCU_STATUS_DEF,
+	.Control_Unit=&CONTROL_UNIT,
+	.Chip={&Node_Image_Chip[0],&Node_Image_Chip[1]},
+	.Boot=Node_Image_Boot,
+	.Run_Until=Node_Image_Run_Until,
+	.Get_Time_us=Host_Get_Time_us,
+	.Set_Temperatures=Node_Image_Set_Temperatures,
+	.Pending=Host_CAN1_Pending,
+	.Transmitted=Host_CAN1_Transmitted,
+	.Receive=Node_Image_Receive,
+	.CAN_Statistics=CAN1_Get_Statistics,
+	.Host_Statistics=Host_Get_Statistics,
+	.CAN_Rx_Overflows=CAN1_Rx_Overflows,
+	.Frame_Bits=CAN1_Frame_Bits
+};
+
+NODE_IMAGE_EXPORT const Node_Image_TypeDef* Node_Image_Get(void)
+{
+	return &Node_Image;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Node_Image.c
+  * @brief          : One firmware image per pack unit, loaded side by side by the bus tests
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file           : Node_Image.h
+  * @brief          : One firmware image per pack unit, loaded side by side by the bus tests
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef NODE_IMAGE_H
+#define NODE_IMAGE_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Control_Unit.h"
+#include "LTC6811_Simulator.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Image                         ***************	
+********************************************************************************
+*******************************************************************************/
+// Every image is the whole firmware and the host backend built for one unit
+// (BATTERY_PACK_CONTROL_UNIT_n) as a shared module with its own globals and
+// virtual clock. Only NODE_IMAGE_SYMBOL is exported, everything else is
+// reached through the table it returns.
+#define NODE_IMAGE_SYMBOL		"Node_Image_Get"
+
+typedef struct
+{
+	uint8_t		Unit;
+	uint32_t	Init_Measure_Id;				// Starts the scan of this unit
+	uint32_t	Finished_Id;						// Sent at the end of it
+	uint32_t	Status_Id;
+
+	Control_Unit_TypeDef*					Control_Unit;
+	LTC6811_Simulator_TypeDef*		Chip[2];
+
+	// Board power up with both chips attached, the mailboxes wait for the bus
+	void				(*Boot)							(void);
+	// Main loop passes until the virtual clock reaches the time
+	void				(*Run_Until)				(uint64_t Time_us);
+	uint64_t		(*Get_Time_us)			(void);
+	// Every sensor of both chips at the temperature, degC
+	void				(*Set_Temperatures)	(float Temperature);
+
+	// Bus side of the CAN1 controller
+	BoolTypeDef	(*Pending)					(Host_CAN_Frame_TypeDef* Frame);
+	void				(*Transmitted)			(void);
+	BoolTypeDef	(*Receive)					(const Host_CAN_Frame_TypeDef* Frame);
+
+	const CAN_Bus_Statistics_TypeDef*	(*CAN_Statistics)		(void);
+	const Host_Statistics_TypeDef*		(*Host_Statistics)	(void);
+	uint32_t		(*CAN_Rx_Overflows)	(void);
+	uint32_t		(*Frame_Bits)				(uint8_t DLC);		// Worst case the unit accounts
+} Node_Image_TypeDef;
+
+typedef const Node_Image_TypeDef* (*Node_Image_Get_TypeDef)(void);
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Node_Image.h
+  * @brief          : One firmware image per pack unit, loaded side by side by the bus tests
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
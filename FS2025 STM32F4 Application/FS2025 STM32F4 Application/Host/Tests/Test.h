@@ -0,0 +1,135 @@
+/**
+  ******************************************************************************
+  * @file           : Test.h
+  * @brief          : Minimal check macros and boot helpers of the host tests
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef TEST_H
+#define TEST_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Control_Unit.h"
+#include <stdio.h>
+#include <math.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Checks                        ***************	
+********************************************************************************
+*******************************************************************************/
+// Each test program is one ctest case, it fails if any check failed
+static unsigned int Test_Checks;
+static unsigned int Test_Failures;
+
+#define TEST_CHECK(Condition) \
+	do { \
+		Test_Checks++; \
+		if(!(Condition)) \
+		{ \
+			Test_Failures++; \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+		} \
+	} while(0)
+
+#define TEST_CHECK_NEAR(Value, Expected, Tolerance) \
+	TEST_CHECK(fabs((double)(Value)-(double)(Expected))<=(double)(Tolerance))
+
+#define TEST_RUN(Test) \
+	do { \
+		unsigned int Failures=Test_Failures; \
+		Test(); \
+		printf("%s %s\n", (Test_Failures==Failures) ? "[  OK  ]" : "[ FAIL ]", #Test); \
+	} while(0)
+
+#define TEST_RESULT() \
+	(printf("%u checks, %u failed\n", Test_Checks, Test_Failures), (Test_Failures==0U) ? 0 : 1)
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Helpers                       ***************	
+********************************************************************************
+*******************************************************************************/
+// Power up of the simulated board and the same init as main(), the control
+// unit starts from zero like the .bss after the startup code
+static inline void Test_Boot(void)
+{
+	Host_Reset();
+	memset((void*)&CONTROL_UNIT,0,sizeof(CONTROL_UNIT));
+	Control_Unit_MCU_Init();
+	Control_Unit_Init();
+}
+
+// Takes the sent frames until one with the identifier, FALSE if none was sent
+static inline BoolTypeDef Test_CAN1_Find(uint32_t Id, Host_CAN_Frame_TypeDef* Frame)
+{
+	while(Host_CAN1_Take(Frame)==TRUE)
+	{
+		if(Frame->Id==Id)
+		{
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+static inline void Test_CAN1_Flush(void)
+{
+	Host_CAN_Frame_TypeDef Frame;
+
+	while(Host_CAN1_Take(&Frame)==TRUE)
+	{
+	}
+}
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test.h
+  * @brief          : Minimal check macros and boot helpers of the host tests
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,471 @@
+/**
+  ******************************************************************************
+  * @file           : Test_Acquisition.c
+  * @brief          : Measurement chain on two simulated LTC6811, scripted faults
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include "LTC6811_Simulator.h"
+#include "Open_Wire.h"
+#include "Scan_Scheduler.h"
+#include "Self_Test.h"
+#include <time.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+// Chip 1 holds the channels 0 to 11, chip 2 the channels 12 to 23
+static LTC6811_Simulator_TypeDef Chip_1;
+static LTC6811_Simulator_TypeDef Chip_2;
+
+#define TEST_SETTLE_MS		3000U
+
+// Both phases with their settle times, about 34 ms with the default timing,
+// plus one main loop pass per register group read, 1 ms each on the host
+#define TEST_SCAN_LIMIT_MS	60U
+
+// One register group read of 12 bytes with its chip select guards
+#define TEST_READ_STEP_US	(12U*HOST_SPI_BYTE_US+2U*LTC6811_CS_GUARD_US+50U)
+
+// Both chips as the board powers up, the unit booted and scanning
+static void Test_Start(void)
+{
+	LTC6811_Simulator_Init(&Chip_1);
+	LTC6811_Simulator_Init(&Chip_2);
+	Test_Boot();
+	Host_Run_ms(TEST_SETTLE_MS);
+}
+
+static BoolTypeDef Test_Run_Until_State(Control_Unit_State_Typdef State, uint32_t Limit_ms)
+{
+	for(uint32_t Time=0; Time<Limit_ms && CONTROL_UNIT.State!=State; Time+=10U)
+	{
+		Host_Run_ms(10);
+	}
+	return (CONTROL_UNIT.State==State) ? TRUE : FALSE;
+}
+
+// Enabled with the default threshold and minimum voltage
+static void Test_Balancing_Enable(void)
+{
+	const uint8_t Enable[8]={0x01,0,0,0,0,0,0,0};
+
+	Host_CAN1_Inject(BPCU_BALANCING_COMMAND_DEF,8,Enable);
+	Host_Run_ms(2);
+}
+
+// Until the unit published that many more scans and wrote the last selection
+static void Test_Balancing_Scans(uint32_t Scans)
+{
+	for(uint32_t Scan=0; Scan<Scans; Scan++)
+	{
+		uint32_t Sequence=CONTROL_UNIT.Snapshot.Sequence;
+		for(uint32_t Time=0; Time<2U*SCAN_PERIOD_SLOW_MS && CONTROL_UNIT.Snapshot.Sequence==Sequence; Time++)
+		{
+			Host_Run_ms(1);
+		}
+	}
+	Host_Run_ms(LTC6811_WAKE_TIME_MS+5U);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_Normal_Readings(void)
+{
+	LTC6811_Simulator_Init(&Chip_1);
+	LTC6811_Simulator_Init(&Chip_2);
+	LTC6811_Simulator_Set_Cells(&Chip_2,3.75f);
+	LTC6811_Simulator_Set_Temperatures(&Chip_2,35.0f);
+	Test_Boot();
+
+	TEST_CHECK(Test_Run_Until_State(NORMAL_OPERATION,100)==TRUE);
+	TEST_CHECK(CONTROL_UNIT.Startup.Attempts==1U);
+	Host_Run_ms(TEST_SETTLE_MS);
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		TEST_CHECK_NEAR(CONTROL_UNIT.Status.Voltages[i],(i<12) ? 3.60f : 3.75f,0.0002f);
+		TEST_CHECK_NEAR(CONTROL_UNIT.Status.Temperatures.Actual_Value[i],(i<12) ? 25.0f : 35.0f,0.2f);
+	}
+	TEST_CHECK(CONTROL_UNIT.Status.Temperatures.Hot==0U && CONTROL_UNIT.Status.Temperatures.Failed==0U);
+	TEST_CHECK(CONTROL_UNIT.Acquisition.Timeouts==0U);
+	TEST_CHECK(CONTROL_UNIT.Sum_Check.Checks>0U && CONTROL_UNIT.Sum_Check.Mismatches==0U);
+	TEST_CHECK(Chip_1.Statistics.Command_PEC_Errors==0U && Chip_1.Statistics.Data_PEC_Errors==0U);
+	TEST_CHECK(Chip_1.Statistics.Unknown_Commands==0U && Chip_2.Statistics.Unknown_Commands==0U);
+	// Only the pulses that wake the cores are lost
+	TEST_CHECK(Chip_1.Statistics.Ignored_Frames==Chip_1.Statistics.Wake_Ups);
+}
+
+// One sensor heats up to 80 degC in 30 s: fast scans, then the hot fail mode
+static void Test_Thermal_Runaway(void)
+{
+	const uint8_t Channel=15;
+	uint32_t Start;
+	uint32_t Crossing;
+
+	Test_Start();
+	Start=MCU_Get_Tick();
+	Chip_2.Sensor[Channel-12]=LTC6811_Simulator_Ramp(LTC6811_Simulator_Sensor_Voltage(25.0f),
+		LTC6811_Simulator_Sensor_Voltage(80.0f),Start,30000U);
+
+	// The ramp is linear in volts, the sensor curve is not
+	for(Crossing=Start; Crossing<Start+30000U; Crossing++)
+	{
+		if(LTC_Voltage_to_Temperature(LTC6811_Simulator_Value(&Chip_2.Sensor[Channel-12],(uint64_t)Crossing*1000U))>60.0f)
+		{
+			break;
+		}
+	}
+
+	TEST_CHECK(Test_Run_Until_State(TEMP_PLUS_60_FAIL_MODE,40000)==TRUE);
+	TEST_CHECK(MCU_Get_Tick()>=Crossing);
+	TEST_CHECK(MCU_Get_Tick()<=Crossing+1000U);
+	TEST_CHECK(CONTROL_UNIT.Status.Temperatures.Hot==1UL<<Channel);
+	TEST_CHECK(CONTROL_UNIT.Status.Temperatures.Failed==0U);
+	TEST_CHECK(CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_FAST]>0U);
+	printf("  60 degC crossed at %u ms, hot mode at %u ms, %u fast scans\n",
+		Crossing-Start,MCU_Get_Tick()-Start,CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_FAST]);
+}
+
+// A chip that stops answering fails the unit, the recovery brings it back
+static void Test_Dead_Chip(void)
+{
+	Test_Start();
+	Chip_2.Faults.Dead=TRUE;
+	TEST_CHECK(Test_Run_Until_State(LTC6811_FAIL_MODE,SCAN_PERIOD_SLOW_MS+100U)==TRUE);
+	TEST_CHECK(CONTROL_UNIT.Status.LTC6811_1.Fail==FALSE);
+	TEST_CHECK(CONTROL_UNIT.Status.LTC6811_2.Fail==TRUE);
+
+	// Still failed while dead
+	Host_Run_ms(5U*BPCU_RECOVERY_BACKOFF_MS);
+	TEST_CHECK(CONTROL_UNIT.State==LTC6811_FAIL_MODE);
+
+	Chip_2.Faults.Dead=FALSE;
+	TEST_CHECK(Test_Run_Until_State(NORMAL_OPERATION,3U*BPCU_RECOVERY_BACKOFF_MS)==TRUE);
+	TEST_CHECK(CONTROL_UNIT.Recovery.Recoveries==1U);
+	TEST_CHECK(CONTROL_UNIT.Status.LTC6811_2.Fail==FALSE);
+}
+
+// A corrupted read is retried or recovered, the unit never stays failed
+static void Test_Corrupted_Reads(void)
+{
+	const uint32_t Injections=20;
+
+	Test_Start();
+	for(uint32_t i=0; i<Injections; i++)
+	{
+		Chip_1.Faults.Corrupt_Reads=1;
+		while(Chip_1.Faults.Corrupt_Reads>0U)
+		{
+			Host_Run_ms(10);
+		}
+		Host_Run_ms(700);
+	}
+	Host_Run_ms(5U*BPCU_RECOVERY_BACKOFF_MS);
+	TEST_CHECK(Chip_1.Statistics.Corrupted_Reads==Injections);
+	TEST_CHECK(CONTROL_UNIT.State==NORMAL_OPERATION);
+	TEST_CHECK(CONTROL_UNIT.Recovery.Recoveries<=Injections);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Status.Voltages[0],LTC6811_SIMULATOR_DEFAULT_CELL,0.0002f);
+	printf("  %u corrupted reads, %u recoveries\n",Injections,CONTROL_UNIT.Recovery.Recoveries);
+}
+
+// A cell reading off by 300 mV in one conversion: SC disagrees, the phase is voted
+static void Test_Sum_Check_Vote(void)
+{
+	Test_Start();
+	Chip_1.Faults.Glitch_Input=4;
+	Chip_1.Faults.Glitch_Offset=0.3f;
+	Chip_1.Faults.Glitch_Conversions=1;
+	Host_Run_ms(SCAN_PERIOD_SLOW_MS+100U);
+
+	TEST_CHECK(Chip_1.Faults.Glitch_Conversions==0U);
+	TEST_CHECK(CONTROL_UNIT.Sum_Check.Mismatches==1U);
+	TEST_CHECK(CONTROL_UNIT.Sum_Check.Voted==1U);
+	TEST_CHECK(CONTROL_UNIT.Acquisition.Timeouts==0U);
+	TEST_CHECK(CONTROL_UNIT.State==NORMAL_OPERATION);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Status.Voltages[4],LTC6811_SIMULATOR_DEFAULT_CELL,0.0002f);
+}
+
+// An open C5 sense wire: cells 5 and 6 are suspect in one check and open in two
+static void Test_Open_Wire_Detection(void)
+{
+	Test_Start();
+	Chip_1.Faults.Open_Pins=1U<<5;
+	Host_Run_ms(OPEN_WIRE_DEFAULT_PERIOD_S*1000U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Checks==1U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Suspect==0x30U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Open==0U);
+
+	Host_Run_ms(OPEN_WIRE_DEFAULT_PERIOD_S*1000U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Checks==2U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Open==0x30U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Timeouts==0U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Last_Duration<OPEN_WIRE_WINDOW_MS);
+}
+
+// Cell 2 over the others: discharged with the chip timeout, until it is
+// within Threshold-Hysteresis. A cell read at 2 V does not drag the lowest one
+static void Test_Balancing_Selection(void)
+{
+	Test_Start();
+	Chip_1.Cell[2]=LTC6811_Simulator_Constant(3.650f);
+	Chip_1.Cell[3]=LTC6811_Simulator_Constant(3.608f);
+	Chip_1.Cell[7]=LTC6811_Simulator_Constant(2.000f);
+	Test_Balancing_Enable();
+	Test_Balancing_Scans(2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==1UL<<2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Active==1UL<<2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Step==BALANCING_ON);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip_1)==1U<<2);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip_2)==0U);
+	TEST_CHECK((Chip_1.CFGR[5]>>4)==BALANCING_TIMEOUT);
+
+	// A scan takes the switches, the discharge so far is counted
+	uint32_t Discharge_Time=CONTROL_UNIT.Balancing.Discharge_Time[2];
+	for(uint32_t Time=0; Time<2U*SCAN_PERIOD_SLOW_MS && CONTROL_UNIT.Status.Read_Temperatures!=READING; Time++)
+	{
+		Host_Run_ms(1);
+	}
+	TEST_CHECK(CONTROL_UNIT.Balancing.Active==0U);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Step==BALANCING_IDLE);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Discharge_Time[2]>Discharge_Time);
+
+	// 7 mV over: kept while discharging, not started on cell 3 at 8 mV
+	Chip_1.Cell[2]=LTC6811_Simulator_Constant(3.607f);
+	Test_Balancing_Scans(2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==1UL<<2);
+
+	Chip_1.Cell[2]=LTC6811_Simulator_Constant(3.604f);
+	Test_Balancing_Scans(2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==0U);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip_1)==0U);
+}
+
+// A hot resistor stops its cell until it cools below the release temperature
+static void Test_Balancing_Thermal_Inhibit(void)
+{
+	Test_Start();
+	Chip_1.Cell[2]=LTC6811_Simulator_Constant(3.650f);
+	Test_Balancing_Enable();
+	Test_Balancing_Scans(2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==1UL<<2);
+
+	Chip_1.Sensor[2]=LTC6811_Simulator_Constant(LTC6811_Simulator_Sensor_Voltage(55.0f));
+	Test_Balancing_Scans(6);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Inhibited==1UL<<2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==0U);
+
+	// Between the release and the limit it stays off
+	Chip_1.Sensor[2]=LTC6811_Simulator_Constant(LTC6811_Simulator_Sensor_Voltage(47.0f));
+	Test_Balancing_Scans(6);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Inhibited==1UL<<2);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==0U);
+
+	Chip_1.Sensor[2]=LTC6811_Simulator_Constant(LTC6811_Simulator_Sensor_Voltage(40.0f));
+	Test_Balancing_Scans(6);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Inhibited==0U);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==1UL<<2);
+}
+
+// An open C5 wire: cells 4 and 5 are left out while suspect, an open wire stops it all
+static void Test_Balancing_Open_Wire(void)
+{
+	Test_Start();
+	Chip_1.Cell[2]=LTC6811_Simulator_Constant(3.650f);
+	Chip_1.Cell[4]=LTC6811_Simulator_Constant(3.700f);
+	Chip_1.Cell[5]=LTC6811_Simulator_Constant(3.000f);
+	Chip_1.Faults.Open_Pins=1U<<5;
+	Test_Balancing_Enable();
+	Host_Run_ms(OPEN_WIRE_DEFAULT_PERIOD_S*1000U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Suspect==0x30U && CONTROL_UNIT.Open_Wire.Open==0U);
+	Test_Balancing_Scans(1);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==1UL<<2);
+
+	Host_Run_ms(OPEN_WIRE_DEFAULT_PERIOD_S*1000U);
+	TEST_CHECK(CONTROL_UNIT.Open_Wire.Open==0x30U);
+	Test_Balancing_Scans(1);
+	TEST_CHECK(CONTROL_UNIT.Balancing.Target==0U);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip_1)==0U);
+}
+
+// DIAGN runs every fourth self-test, a multiplexer fault is reported on two in a row
+static void Test_Self_Test_Faults(void)
+{
+	Test_Start();
+	Host_Run_ms(4U*SELF_TEST_INTERVAL_MS);
+	TEST_CHECK(CONTROL_UNIT.Self_Test.Runs>=4U);
+	TEST_CHECK(CONTROL_UNIT.Self_Test.Faults[0]==0U && CONTROL_UNIT.Self_Test.Faults[1]==0U);
+	TEST_CHECK(CONTROL_UNIT.Self_Test.Timeouts==0U);
+	TEST_CHECK(CONTROL_UNIT.Self_Test.Revision[1]==Chip_2.Revision);
+
+	Chip_2.Faults.Mux_Fail=TRUE;
+	Host_Run_ms(9U*SELF_TEST_INTERVAL_MS);
+	TEST_CHECK(CONTROL_UNIT.Self_Test.Faults[0]==0U);
+	TEST_CHECK(CONTROL_UNIT.Self_Test.Faults[1]==1U<<SELF_TEST_MUX);
+}
+
+// The main loop passes of the read step, each one a single register group
+static void Test_Read_Steps(void)
+{
+	uint32_t Steps=0;
+	uint32_t Longest=0;
+
+	Test_Start();
+	for(uint32_t Pass=0; Pass<2U*SCAN_PERIOD_SLOW_MS; Pass++)
+	{
+		BoolTypeDef Reading=(CONTROL_UNIT.Acquisition.Step==ACQUISITION_READ) ? TRUE : FALSE;
+		uint64_t Start=Host_Get_Time_us();
+
+		Control_Unit_Main_Task();
+		uint32_t Length=(uint32_t)(Host_Get_Time_us()-Start);
+		if(Reading==TRUE)
+		{
+			Steps++;
+			Longest=(Length>Longest) ? Length : Longest;
+		}
+		Host_Step_us(HOST_MAIN_PASS_US);
+	}
+
+	// Four cell groups and the status group per chip and phase, one scan at least
+	TEST_CHECK(Steps>=2U*2U*(LTC6811_CELL_GROUPS+1U));
+	TEST_CHECK(Longest<=TEST_READ_STEP_US);
+	printf("  %u read passes, the longest %u us\n",Steps,Longest);
+}
+
+// Scan periods written in NVM: a cold pack scans at the configured slow rate
+static void Test_Configured_Periods(void)
+{
+	const uint32_t Period[2]={2000,200};
+
+	Host_Flash_Load(Address_APP_BPCU_Scan_Period_Slow,Period,sizeof(Period));
+	Test_Start();
+	uint32_t Scans=CONTROL_UNIT.Scan_Scheduler.Local_Scans;
+	Host_Run_ms(20000);
+	Scans=CONTROL_UNIT.Scan_Scheduler.Local_Scans-Scans;
+
+	TEST_CHECK(CONTROL_UNIT.Scan_Scheduler.Band==SCAN_BAND_SLOW);
+	TEST_CHECK(CONTROL_UNIT.Scan_Scheduler.Period[SCAN_BAND_FAST]==200U);
+	TEST_CHECK(Scans>=9U && Scans<=10U);
+	printf("  %u local scans in 20 s with a %u ms slow period\n",Scans,Period[0]);
+	Host_Flash_Erase_All();
+}
+
+// A minute of the default schedule, what the chips and the bus did
+static void Test_Throughput(void)
+{
+	const uint32_t Minute=60000;
+	uint32_t Scans;
+	clock_t Wall;
+
+	Test_Start();
+	LTC6811_Simulator_Statistics_TypeDef Before=Chip_1.Statistics;
+	uint32_t Transfers=Host_Get_Statistics()->SPI_Transfers[HOST_SPI_1];
+	uint32_t Scans_Before=CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_SLOW]+CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_NORMAL]+
+		CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_FAST];
+
+	Wall=clock();
+	Host_Run_ms(Minute);
+	Wall=clock()-Wall;
+
+	Scans=CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_SLOW]+CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_NORMAL]+
+		CONTROL_UNIT.Scan_Scheduler.Scans[SCAN_BAND_FAST]-Scans_Before;
+	uint32_t Commands=Chip_1.Statistics.Commands-Before.Commands;
+	uint32_t Conversions=Chip_1.Statistics.Conversions-Before.Conversions;
+	uint32_t Busy=Chip_1.Statistics.Busy_Polls-Before.Busy_Polls;
+	uint32_t Frames=Host_Get_Statistics()->SPI_Transfers[HOST_SPI_1]-Transfers;
+
+	// The period runs from the end of the last scan
+	TEST_CHECK(Scans>=Minute/(SCAN_PERIOD_SLOW_MS+TEST_SCAN_LIMIT_MS));
+	TEST_CHECK(CONTROL_UNIT.State==NORMAL_OPERATION);
+	TEST_CHECK(CONTROL_UNIT.Acquisition.Last_Duration<=TEST_SCAN_LIMIT_MS);
+	TEST_CHECK(Chip_1.Statistics.Command_PEC_Errors==Before.Command_PEC_Errors);
+	TEST_CHECK(Chip_1.Statistics.Sleeps==Before.Sleeps);
+
+	printf("  %u scans/min, scan %u ms, %u conversions, %u commands, %u transfers, %u busy polls on chip 1\n",
+		Scans,CONTROL_UNIT.Acquisition.Last_Duration,Conversions,Commands,Frames,Busy);
+	printf("  %u virtual ms in %.1f ms\n",Minute,1000.0*(double)Wall/CLOCKS_PER_SEC);
+}
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	LTC6811_Simulator_Attach(&Chip_1,HOST_SPI_1);
+	LTC6811_Simulator_Attach(&Chip_2,HOST_SPI_2);
+
+	TEST_RUN(Test_Normal_Readings);
+	TEST_RUN(Test_Thermal_Runaway);
+	TEST_RUN(Test_Dead_Chip);
+	TEST_RUN(Test_Corrupted_Reads);
+	TEST_RUN(Test_Sum_Check_Vote);
+	TEST_RUN(Test_Open_Wire_Detection);
+	TEST_RUN(Test_Balancing_Selection);
+	TEST_RUN(Test_Balancing_Thermal_Inhibit);
+	TEST_RUN(Test_Balancing_Open_Wire);
+	TEST_RUN(Test_Self_Test_Faults);
+	TEST_RUN(Test_Read_Steps);
+	TEST_RUN(Test_Configured_Periods);
+
+	TEST_RUN(Test_Throughput);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_Acquisition.c
+  * @brief          : Measurement chain on two simulated LTC6811, scripted faults
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,414 @@
+/**
+  ******************************************************************************
+  * @file           : Test_CAN_Bus.c
+  * @brief          : Four unit images and a scripted master on the simulated CAN bus
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include "Node_Image.h"
+#include "CAN_Bus_Simulator.h"
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+#define TEST_UNITS				4U
+#define TEST_SETTLE_MS		3000U
+
+static const char* const Test_Node_Path[TEST_UNITS]={TEST_NODE_1,TEST_NODE_2,TEST_NODE_3,TEST_NODE_4};
+static const Node_Image_TypeDef* Node[TEST_UNITS];
+
+// Port 0 is the master, port n the unit n
+static CAN_Bus_Simulator_TypeDef Bus;
+static CAN_Bus_Master_TypeDef Master;
+static uint64_t Test_Time_us;
+
+static BoolTypeDef Test_Node_Pending(void* Context, Host_CAN_Frame_TypeDef* Frame)
+{
+	return ((const Node_Image_TypeDef*)Context)->Pending(Frame);
+}
+
+static void Test_Node_Transmitted(void* Context)
+{
+	((const Node_Image_TypeDef*)Context)->Transmitted();
+}
+
+// A full FIFO loses the frame, the image counts it as an overrun
+static void Test_Node_Receive(void* Context, const Host_CAN_Frame_TypeDef* Frame)
+{
+	((const Node_Image_TypeDef*)Context)->Receive(Frame);
+}
+
+static BoolTypeDef Test_Load_Images(void)
+{
+	for(uint8_t i=0; i<TEST_UNITS; i++)
+	{
+		void* Handle=dlopen(Test_Node_Path[i],RTLD_NOW | RTLD_LOCAL);
+		Node_Image_Get_TypeDef Get=(Handle!=NULL) ? (Node_Image_Get_TypeDef)dlsym(Handle,NODE_IMAGE_SYMBOL) : NULL;
+
+		if(Get==NULL)
+		{
+			printf("%s: %s\n",Test_Node_Path[i],dlerror());
+			return FALSE;
+		}
+		Node[i]=Get();
+	}
+	return TRUE;
+}
+
+// The master and the four units on one bus, every unit booted with its own
+// temperature
+static void Test_Start(void)
+{
+	CAN_Bus_Simulator_Init(&Bus,HOST_CAN1_BITRATE);
+	CAN_Bus_Master_Init(&Master,&Bus);
+	CAN_Bus_Simulator_Port_TypeDef Port=CAN_Bus_Master_Port(&Master,"Master");
+	CAN_Bus_Simulator_Add_Port(&Bus,&Port);
+	Test_Time_us=0;
+
+	for(uint8_t i=0; i<TEST_UNITS; i++)
+	{
+		CAN_Bus_Simulator_Port_TypeDef Unit=
+		{
+			.Name="Unit",
+			.Context=(void*)Node[i],
+			.Pending=Test_Node_Pending,
+			.Transmitted=Test_Node_Transmitted,
+			.Receive=Test_Node_Receive
+		};
+		CAN_Bus_Simulator_Add_Port(&Bus,&Unit);
+		Node[i]->Boot();
+		Node[i]->Set_Temperatures(20.0f+5.0f*(float)Node[i]->Unit);
+	}
+}
+
+/**
+ * @brief Virtual time in 1 ms steps: the script queues its frames, the units
+ * run one main loop pass and the bus sends what they left in the mailboxes.
+ * Frames are timed to the bit on the bus and to the pass in the units.
+ */
+static void Test_Run_ms(uint32_t Time_ms)
+{
+	for(uint32_t ms=0; ms<Time_ms; ms++)
+	{
+		Test_Time_us+=1000U;
+		CAN_Bus_Master_Update(&Master);
+		for(uint8_t i=0; i<TEST_UNITS; i++)
+		{
+			Node[i]->Run_Until(Test_Time_us);
+		}
+		CAN_Bus_Simulator_Run(&Bus,Test_Time_us);
+	}
+}
+
+// First record with the identifier from Index on, NULL if none
+static const CAN_Bus_Simulator_Record_TypeDef* Test_Find(uint32_t Id, uint32_t* Index)
+{
+	for(; *Index<Bus.Log_Count; (*Index)++)
+	{
+		const CAN_Bus_Simulator_Record_TypeDef* Record=CAN_Bus_Simulator_Record(&Bus,*Index);
+
+		if(Record!=NULL && Record->Frame.Id==Id)
+		{
+			return Record;
+		}
+	}
+	return NULL;
+}
+
+static uint32_t Test_Scans(const Node_Image_TypeDef* Image)
+{
+	const Scan_Scheduler_TypeDef* Scheduler=&Image->Control_Unit->Scan_Scheduler;
+
+	return Scheduler->Scans[SCAN_BAND_SLOW]+Scheduler->Scans[SCAN_BAND_NORMAL]+Scheduler->Scans[SCAN_BAND_FAST];
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+// Exact bits against hand counted frames and the worst case of the units
+static void Test_Frame_Bits(void)
+{
+	Host_CAN_Frame_TypeDef Frame;
+	uint32_t Stuff;
+
+	// 34 dominant bits up to the CRC, one stuff bit after every five
+	memset(&Frame,0,sizeof(Frame));
+	TEST_CHECK(CAN_Bus_Simulator_Frame_Bits(&Frame,&Stuff)==53U);
+	TEST_CHECK(Stuff==6U);
+
+	srand(33);
+	uint32_t Over_Worst=0;
+	uint32_t Under_Plain=0;
+	for(uint32_t n=0; n<10000U; n++)
+	{
+		Frame.Id=(uint32_t)rand() & 0x7FFU;
+		Frame.DLC=(uint8_t)(rand()%9);
+		for(uint8_t i=0; i<8U; i++)
+		{
+			Frame.Data[i]=(uint8_t)rand();
+		}
+		uint32_t Bits=CAN_Bus_Simulator_Frame_Bits(&Frame,&Stuff);
+		Over_Worst+=(Bits>Node[0]->Frame_Bits(Frame.DLC)) ? 1U : 0U;
+		Under_Plain+=(Bits!=47U+8U*Frame.DLC+Stuff) ? 1U : 0U;
+	}
+	TEST_CHECK(Over_Worst==0U);
+	TEST_CHECK(Under_Plain==0U);
+}
+
+// Scripted ports only: lowest identifier first, back to back, losers counted
+static void Test_Arbitration(void)
+{
+	static CAN_Bus_Master_TypeDef Scripted[4];
+	const uint32_t Id[4]={0x300,0x100,0x200,0x200};
+	const uint8_t Data[8]={0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA};
+
+	CAN_Bus_Simulator_Init(&Bus,HOST_CAN1_BITRATE);
+	for(uint8_t i=0; i<4U; i++)
+	{
+		CAN_Bus_Master_Init(&Scripted[i],&Bus);
+		CAN_Bus_Master_Add(&Scripted[i],0,0,Id[i],8,Data);
+		CAN_Bus_Simulator_Port_TypeDef Port=CAN_Bus_Master_Port(&Scripted[i],"Scripted");
+		CAN_Bus_Simulator_Add_Port(&Bus,&Port);
+		CAN_Bus_Master_Update(&Scripted[i]);
+	}
+	CAN_Bus_Simulator_Run(&Bus,2000);
+
+	TEST_CHECK(Bus.Log_Count==4U);
+	TEST_CHECK(Bus.Log[0].Frame.Id==0x100U && Bus.Log[0].Port==1U);
+	TEST_CHECK(Bus.Log[1].Frame.Id==0x200U && Bus.Log[1].Port==2U);
+	TEST_CHECK(Bus.Log[2].Frame.Id==0x200U && Bus.Log[2].Port==3U);
+	TEST_CHECK(Bus.Log[3].Frame.Id==0x300U && Bus.Log[3].Port==0U);
+	TEST_CHECK(Bus.Statistics.Identifier_Clashes==1U);
+	for(uint8_t i=1; i<4U; i++)
+	{
+		TEST_CHECK(Bus.Log[i].Time_us==Bus.Log[i-1].Time_us+Bus.Log[i-1].Duration_us);
+	}
+	// 2 us per bit at 500 kbit/s
+	TEST_CHECK(Bus.Log[0].Duration_us==2U*Bus.Log[0].Bits);
+	TEST_CHECK(Bus.Port_Statistics[0].Arbitration_Lost==3U);
+	TEST_CHECK(Bus.Port_Statistics[1].Arbitration_Lost==0U);
+	TEST_CHECK(Bus.Port_Statistics[3].Arbitration_Lost==2U);
+	TEST_CHECK(Bus.Port_Statistics[0].Max_Latency_us==Bus.Log[3].Time_us);
+	TEST_CHECK(Bus.Statistics.Busy_us==Bus.Log[3].Time_us+Bus.Log[3].Duration_us);
+	TEST_CHECK(Bus.Time_us==2000U);
+	for(uint8_t i=0; i<4U; i++)
+	{
+		TEST_CHECK(Bus.Port_Statistics[i].Rx_Frames==3U);
+		TEST_CHECK(Scripted[i].Received[0x100]==((i==1U) ? 0U : 1U));
+	}
+}
+
+// Four images side by side: each has its own globals, clock and readings
+static void Test_Four_Units(void)
+{
+	Test_Start();
+	Test_Run_ms(TEST_SETTLE_MS);
+
+	for(uint8_t i=0; i<TEST_UNITS; i++)
+	{
+		const Control_Unit_TypeDef* Unit=Node[i]->Control_Unit;
+
+		TEST_CHECK(Node[i]->Unit==i+1U);
+		TEST_CHECK(Node[i]->Status_Id==0x100U+i);
+		TEST_CHECK(Unit->State==NORMAL_OPERATION);
+		TEST_CHECK(Node[i]->Get_Time_us()>=Test_Time_us);
+		TEST_CHECK(Node[i]->Get_Time_us()<Test_Time_us+1000U);
+		TEST_CHECK(Master.Received[Node[i]->Status_Id]>0U);
+		TEST_CHECK_NEAR(Unit->Status.Temperatures.Actual_Value[0],20.0f+5.0f*(float)(i+1U),0.2f);
+		TEST_CHECK_NEAR(Unit->Status.Temperatures.Actual_Value[23],20.0f+5.0f*(float)(i+1U),0.2f);
+		for(uint8_t j=0; j<i; j++)
+		{
+			TEST_CHECK(Node[j]->Control_Unit!=Unit);
+		}
+	}
+	TEST_CHECK(Bus.Statistics.Identifier_Clashes==0U);
+}
+
+/**
+ * @brief One Init Measure of unit 1 scans the whole pack: the Finished
+ * Measure of unit n has the identifier of the Init Measure of unit n+1. The
+ * master cannot ask one unit alone, unit 4 ends the chain with 0x90.
+ */
+static void Test_Chained_Scan(void)
+{
+	const uint8_t Start[1]={0x01};
+
+	Test_Start();
+	Test_Run_ms(TEST_SETTLE_MS);
+	uint32_t Index=Bus.Log_Count;
+	uint32_t Finished[TEST_UNITS];
+	for(uint8_t i=0; i<TEST_UNITS; i++)
+	{
+		Finished[i]=Master.Received[Node[i]->Finished_Id];
+	}
+
+	CAN_Bus_Master_Add(&Master,(uint32_t)(Test_Time_us/1000U),0,Node[0]->Init_Measure_Id,1,Start);
+	Test_Run_ms(500);
+
+	const CAN_Bus_Simulator_Record_TypeDef* Request=Test_Find(Node[0]->Init_Measure_Id,&Index);
+	TEST_CHECK(Request!=NULL && Request->Port==0U);
+	if(Request==NULL)
+	{
+		return;
+	}
+	uint64_t Previous=Request->Time_us;
+	for(uint8_t i=0; i<TEST_UNITS; i++)
+	{
+		const CAN_Bus_Simulator_Record_TypeDef* Done=Test_Find(Node[i]->Finished_Id,&Index);
+
+		TEST_CHECK(Done!=NULL && Done->Port==i+1U);
+		TEST_CHECK(Master.Received[Node[i]->Finished_Id]==Finished[i]+1U);
+		if(Done==NULL)
+		{
+			return;
+		}
+		TEST_CHECK(Done->Time_us-Previous<=50000U);
+		printf("  unit %u scanned in %.1f ms, finished 0x%03X\n",Node[i]->Unit,(double)(Done->Time_us-Previous)/1000.0,Done->Frame.Id);
+		Previous=Done->Time_us;
+	}
+	printf("  pack scanned in %.1f ms\n",(double)(Previous-Request->Time_us)/1000.0);
+}
+
+/**
+ * @brief A minute of pack scans at two master periods, faster than real
+ * time: exact bus load against the worst case estimate of the units, nothing
+ * lost on the way.
+ */
+static void Test_Bus_Load(void)
+{
+	const uint32_t Period_ms[2]={500,200};
+	const uint32_t Minute=60000;
+	const uint8_t Start[1]={0x01};
+
+	for(uint8_t p=0; p<2U; p++)
+	{
+		Test_Start();
+		Test_Run_ms(TEST_SETTLE_MS);
+		uint32_t Scans_Before[TEST_UNITS];
+		uint64_t Bits_Before[TEST_UNITS];
+		for(uint8_t i=0; i<TEST_UNITS; i++)
+		{
+			const CAN_Bus_Statistics_TypeDef* CAN=Node[i]->CAN_Statistics();
+
+			Scans_Before[i]=Test_Scans(Node[i]);
+			Bits_Before[i]=(uint64_t)CAN->Tx_Bits+CAN->Rx_Bits;
+		}
+		CAN_Bus_Simulator_Statistics_TypeDef Before=Bus.Statistics;
+		uint32_t Chains=Master.Received[Node[TEST_UNITS-1U]->Finished_Id];
+
+		CAN_Bus_Master_Add(&Master,(uint32_t)(Test_Time_us/1000U),Period_ms[p],Node[0]->Init_Measure_Id,1,Start);
+		clock_t Wall=clock();
+		Test_Run_ms(Minute);
+		Wall=clock()-Wall;
+
+		uint64_t Bits=Bus.Statistics.Bits-Before.Bits;
+		uint64_t Busy=Bus.Statistics.Busy_us-Before.Busy_us;
+		Chains=Master.Received[Node[TEST_UNITS-1U]->Finished_Id]-Chains;
+
+		// A chain takes about four scans, the next request may find it running
+		TEST_CHECK(Chains>=Minute/Period_ms[p]-2U);
+		TEST_CHECK(Master.Queue_Dropped==0U);
+		TEST_CHECK(Bus.Statistics.Identifier_Clashes==0U);
+		printf("  master every %u ms: %u pack scans, %llu frames, load %.1f %% (peak %.1f %%), %.1f %% stuff bits\n",
+			Period_ms[p],Chains,(unsigned long long)(Bus.Statistics.Frames-Before.Frames),100.0*(double)Busy/(1000.0*Minute),
+			Bus.Statistics.Peak_Load/10.0,100.0*(double)(Bus.Statistics.Stuff_Bits-Before.Stuff_Bits)/(double)Bits);
+
+		for(uint8_t i=0; i<TEST_UNITS; i++)
+		{
+			const CAN_Bus_Statistics_TypeDef* CAN=Node[i]->CAN_Statistics();
+			const CAN_Bus_Simulator_Port_Statistics_TypeDef* Port=&Bus.Port_Statistics[i+1U];
+			uint64_t Estimate=(uint64_t)CAN->Tx_Bits+CAN->Rx_Bits-Bits_Before[i];
+
+			// Every unit sees every frame, its worst case may not be under the bus
+			TEST_CHECK(Estimate>=Bits);
+			TEST_CHECK(CAN->Tx_Dropped==0U);
+			TEST_CHECK(Node[i]->CAN_Rx_Overflows()==0U);
+			TEST_CHECK(Node[i]->Host_Statistics()->CAN1_Rx_Overruns==0U);
+			TEST_CHECK(Node[i]->Control_Unit->State==NORMAL_OPERATION);
+			printf("    unit %u: %u frames, %u lost arbitrations, latency max %u us, %u scans, estimate +%.1f %%, unit load %.1f %%\n",
+				Node[i]->Unit,Port->Tx_Frames,Port->Arbitration_Lost,Port->Max_Latency_us,Test_Scans(Node[i])-Scans_Before[i],
+				100.0*(double)(Estimate-Bits)/(double)Bits,CAN->Load/10.0);
+		}
+		printf("    %u virtual ms in %.1f ms\n",Minute,1000.0*(double)Wall/CLOCKS_PER_SEC);
+		TEST_CHECK((double)Wall/CLOCKS_PER_SEC<Minute/1000.0);
+	}
+}
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	if(Test_Load_Images()==FALSE)
+	{
+		return 1;
+	}
+
+	TEST_RUN(Test_Frame_Bits);
+	TEST_RUN(Test_Arbitration);
+	TEST_RUN(Test_Four_Units);
+	TEST_RUN(Test_Chained_Scan);
+	TEST_RUN(Test_Bus_Load);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_CAN_Bus.c
+  * @brief          : Four unit images and a scripted master on the simulated CAN bus
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file           : Test_CAN_Tx_Queue.c
+  * @brief          : CAN transmit queue behind busy mailboxes
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_Queue_Behind_Held_Mailboxes(void)
+{
+	CAN_Tx_Message_TypeDef Message={0};
+	Host_CAN_Frame_TypeDef Frame;
+	const CAN_Bus_Statistics_TypeDef* Statistics=CAN1_Get_Statistics();
+
+	Test_Boot();
+	Host_CAN1_Hold(TRUE);
+	uint32_t Tx_Frames=Statistics->Tx_Frames;
+
+	// Three frames fill the mailboxes, the queue keeps 15 more, the rest are dropped
+	for(uint32_t i=0; i<20; i++)
+	{
+		Message.ID=(uint16_t)(0x700+i);
+		Message.DLC=8;
+		Message.Data[0]=(uint8_t)i;
+		CAN1_Send(&Message);
+	}
+	TEST_CHECK(Statistics->Tx_Frames==Tx_Frames+3U);
+	TEST_CHECK(Statistics->Tx_Dropped==2U);
+	TEST_CHECK(Statistics->Tx_Queue_Peak==CAN_TX_QUEUE_SIZE-1U);
+	TEST_CHECK(Host_Halted()==FALSE);
+
+	// Once acknowledged the main loop drains the queue in order
+	Host_CAN1_Hold(FALSE);
+	Host_Run_ms(20);
+	for(uint32_t i=0; i<18; i++)
+	{
+		TEST_CHECK(Test_CAN1_Find(0x700+i,&Frame)==TRUE && Frame.Data[0]==i);
+	}
+	TEST_CHECK(Statistics->Tx_Frames==Tx_Frames+18U);
+	TEST_CHECK(Host_CAN1_Mailboxes_Busy()==0U);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_Queue_Behind_Held_Mailboxes);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_CAN_Tx_Queue.c
+  * @brief          : CAN transmit queue behind busy mailboxes
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,297 @@
+/**
+  ******************************************************************************
+  * @file           : Test_Capture_Replay.c
+  * @brief          : Capture of a run replayed through the firmware, exact and altered
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include "Capture_Replayer.h"
+#include "Filter_Comparison.h"
+#include "LTC6811_Simulator.h"
+#include "LTC6811.h"
+#include "Can_Bus.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+static LTC6811_Simulator_TypeDef Chip_1;
+static LTC6811_Simulator_TypeDef Chip_2;
+
+#define TEST_RECORDS			16384U
+#define TEST_SCANS				256U
+#define TEST_RUN_MS				8000U
+#define TEST_REQUEST_MS		3000U
+#define TEST_CAPTURE_FILE	"Test_Capture_Replay.bin"
+
+static Capture_Record_TypeDef Original[TEST_RECORDS];
+static Capture_Record_TypeDef Loaded[TEST_RECORDS];
+static Capture_Record_TypeDef Replayed[TEST_RECORDS];
+static uint32_t Original_Count;
+static Capture_Replayer_Trace_TypeDef Original_Trace;
+static Capture_Replayer_TypeDef Replayer;
+static float Original_Readings[TEST_SCANS][BPCU_CHANNELS];
+static float Replayed_Readings[TEST_SCANS][BPCU_CHANNELS];
+
+/**
+ * @brief The run that gets captured: channel 15 heats past 60 degC from 2 s
+ * and the master asks for a scan at 3 s. The whole capture is drained from
+ * the ring after every pass, as a dump over CAN would read it.
+ */
+static void Test_Record(void)
+{
+	const uint8_t Start[1]={0x01};
+	BoolTypeDef Requested=FALSE;
+
+	LTC6811_Simulator_Init(&Chip_1);
+	LTC6811_Simulator_Init(&Chip_2);
+	LTC6811_Simulator_Attach(&Chip_1,HOST_SPI_1);
+	LTC6811_Simulator_Attach(&Chip_2,HOST_SPI_2);
+	LTC6811_Simulator_Set_Temperatures(&Chip_1,30.0f);
+	LTC6811_Simulator_Set_Temperatures(&Chip_2,30.0f);
+	Chip_2.Sensor[3]=LTC6811_Simulator_Ramp(LTC6811_Simulator_Sensor_Voltage(30.0f),
+		LTC6811_Simulator_Sensor_Voltage(75.0f),2000,2000);
+
+	Test_Boot();
+	Capture_Replayer_Trace_Init(&Original_Trace,Original,TEST_RECORDS);
+	Capture_Replayer_Trace_Readings(&Original_Trace,Original_Readings,TEST_SCANS);
+	while(MCU_Get_Tick()<TEST_RUN_MS)
+	{
+		if(Requested==FALSE && MCU_Get_Tick()>=TEST_REQUEST_MS)
+		{
+			Host_CAN1_Inject(BPCU_INIT_MEASURE_DEF,1,Start);
+			Requested=TRUE;
+		}
+		Host_Run_ms(1);
+		Capture_Replayer_Trace_Update(&Original_Trace,&CONTROL_UNIT);
+	}
+	Original_Count=Original_Trace.Record_Count;
+}
+
+static BoolTypeDef Test_Same_Steps(const Capture_Replayer_Trace_TypeDef* A, const Capture_Replayer_Trace_TypeDef* B)
+{
+	if(A->Steps!=B->Steps)
+	{
+		return FALSE;
+	}
+	for(uint32_t i=0; i<A->Steps && i<CAPTURE_REPLAYER_STEPS; i++)
+	{
+		if(A->Step[i].Tick!=B->Step[i].Tick || A->Step[i].State!=B->Step[i].State ||
+			 A->Step[i].Hot!=B->Step[i].Hot || A->Step[i].Failed!=B->Step[i].Failed)
+		{
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+// The dump format keeps every field
+static void Test_File_Round_Trip(void)
+{
+	TEST_CHECK(Original_Trace.Records_Lost==0U);
+	TEST_CHECK(Original_Count>1000U);
+	TEST_CHECK(Capture_Replayer_Save(TEST_CAPTURE_FILE,Original,Original_Count)==TRUE);
+	TEST_CHECK(Capture_Replayer_Load(TEST_CAPTURE_FILE,Loaded,TEST_RECORDS)==Original_Count);
+	TEST_CHECK(Capture_Replayer_Compare(Original,Original_Count,Loaded,Original_Count)==CAPTURE_REPLAYER_NONE);
+	remove(TEST_CAPTURE_FILE);
+}
+
+// Without the chips, the capture alone gives the same passes, states and traffic
+static void Test_Exact_Replay(void)
+{
+	Capture_Replayer_Init(&Replayer,Loaded,Original_Count,Replayed,TEST_RECORDS);
+	Capture_Replayer_Trace_Readings(&Replayer.Trace,Replayed_Readings,TEST_SCANS);
+	Capture_Replayer_Run(&Replayer,TEST_RUN_MS);
+
+	TEST_CHECK(Replayer.Diverged_At==CAPTURE_REPLAYER_NONE);
+	TEST_CHECK(Replayer.Trace.Record_Count==Original_Count);
+	TEST_CHECK(Replayer.Statistics.Skipped==0U);
+	TEST_CHECK(Replayer.Statistics.Unmatched==0U);
+	TEST_CHECK(Replayer.Statistics.CAN_Injected==1U);
+	TEST_CHECK(Replayer.Trace.Passes==Original_Trace.Passes);
+	TEST_CHECK(Replayer.Trace.Digest==Original_Trace.Digest);
+	TEST_CHECK(Test_Same_Steps(&Replayer.Trace,&Original_Trace)==TRUE);
+	TEST_CHECK(Original_Trace.Last.State==TEMP_PLUS_60_FAIL_MODE);
+	TEST_CHECK(Original_Trace.Last.Hot==(1UL<<15));
+
+	for(uint32_t i=0; i<Replayer.Trace.Steps && i<CAPTURE_REPLAYER_STEPS; i++)
+	{
+		printf("  %5u ms: state %u, hot 0x%06X, failed 0x%06X\n",Replayer.Trace.Step[i].Tick,Replayer.Trace.Step[i].State,
+			Replayer.Trace.Step[i].Hot,Replayer.Trace.Step[i].Failed);
+	}
+	printf("  %u records, %u virtual ms replayed in %.1f ms, %.0f records/s\n",Original_Count,TEST_RUN_MS,Replayer.Wall_ms,
+		1000.0*Original_Count/Replayer.Wall_ms);
+}
+
+/**
+ * @brief The replay feeds the filter engine the readings of the run, scan by
+ * scan, and every filter type runs on them. The raw readings follow a step at
+ * once and the IIR after the median, which never moves more than its input.
+ */
+static void Test_Filter_Comparison(void)
+{
+	static const char* const Names[FILTER_TYPES]={"DEFAULT", "IIR", "MEDIAN", "KALMAN", "RAW"};
+	Filter_Comparison_TypeDef Comparison;
+	uint32_t Scans=Replayer.Trace.Reading_Count;
+
+	TEST_CHECK(Scans>=8U);
+	TEST_CHECK(Replayer.Trace.Readings_Lost==0U);
+	TEST_CHECK(Scans==Original_Trace.Reading_Count);
+	TEST_CHECK(memcmp(Replayed_Readings,Original_Readings,Scans*sizeof(Replayed_Readings[0]))==0);
+
+	Filter_Comparison_Run(&CONTROL_UNIT.Filter_Engine,(const float (*)[BPCU_CHANNELS])Replayed_Readings,Scans,
+		BPCU_CHANNEL_MASK,&Comparison);
+	TEST_CHECK(Comparison.Channels==BPCU_CHANNELS);
+	TEST_CHECK(Comparison.Latency[FILTER_RAW]==1U);
+	TEST_CHECK(Comparison.Latency[FILTER_DEFAULT]==1U);
+	TEST_CHECK(Comparison.Latency[FILTER_MEDIAN]==2U);
+	TEST_CHECK(Comparison.Latency[FILTER_IIR]>Comparison.Latency[FILTER_MEDIAN]);
+	TEST_CHECK(Comparison.Noise[FILTER_RAW]>0.0);
+	TEST_CHECK(Comparison.Noise[FILTER_IIR]<=Comparison.Noise[FILTER_RAW]+1e-3);
+
+	for(uint8_t Type=0; Type<FILTER_TYPES; Type++)
+	{
+		printf("  %-8s latency %2u scans, noise %7.1f mdegC/scan\n",Names[Type],Comparison.Latency[Type],Comparison.Noise[Type]);
+	}
+}
+/**
+ * @brief One register read of chip 2 rewritten with a good PEC: the second
+ * input is a temperature sensor, 0.1 V lower reads a few degC hotter. The
+ * replay takes it as read, the readings change from there and a later frame
+ * of the unit no longer matches the capture.
+ */
+static void Test_Altered_Capture(void)
+{
+	uint32_t Index=CAPTURE_REPLAYER_NONE;
+
+	// The self-test reads the same register with the test pattern on every input
+	memcpy(Loaded,Original,Original_Count*sizeof(Capture_Record_TypeDef));
+	for(uint32_t i=0; i<Original_Count; i++)
+	{
+		uint16_t Sensor=(uint16_t)(Loaded[i].Data[2] | (Loaded[i].Data[3]<<8));
+
+		if(Loaded[i].Source==CAPTURE_SPI_2 && Loaded[i].Id==LTC6811_CMD_RDCVA && Loaded[i].Timestamp>=2000U &&
+			 (Loaded[i].Flags & CAPTURE_FLAG_PEC_OK) && Sensor<25000U)
+		{
+			Index=i;
+			break;
+		}
+	}
+	TEST_CHECK(Index!=CAPTURE_REPLAYER_NONE);
+	if(Index==CAPTURE_REPLAYER_NONE)
+	{
+		return;
+	}
+
+	uint16_t Code=(uint16_t)(Loaded[Index].Data[2] | (Loaded[Index].Data[3]<<8))-1000U;
+	Loaded[Index].Data[2]=(uint8_t)Code;
+	Loaded[Index].Data[3]=(uint8_t)(Code>>8);
+	uint16_t PEC=LTC6811_PEC15_Calc(Loaded[Index].Data,LTC6811_REG_GROUP_SIZE);
+	Loaded[Index].Data[6]=(uint8_t)(PEC>>8);
+	Loaded[Index].Data[7]=(uint8_t)PEC;
+
+	Capture_Replayer_Init(&Replayer,Loaded,Original_Count,Replayed,TEST_RECORDS);
+	Capture_Replayer_Run(&Replayer,TEST_RUN_MS);
+
+	TEST_CHECK(Replayer.Diverged_At!=CAPTURE_REPLAYER_NONE);
+	TEST_CHECK(Replayer.Diverged_At>Index);
+	TEST_CHECK(Replayer.Trace.Digest!=Original_Trace.Digest);
+	TEST_CHECK(Replayer.Statistics.Unmatched==0U);
+	if(Replayer.Diverged_At!=CAPTURE_REPLAYER_NONE)
+	{
+		printf("  record %u altered, diverged at %u (source %u, id 0x%03X, %u ms)\n",Index,Replayer.Diverged_At,
+			Loaded[Replayer.Diverged_At].Source,Loaded[Replayer.Diverged_At].Id,Loaded[Replayer.Diverged_At].Timestamp);
+	}
+}
+
+// A capture that starts mid run: the boot traffic finds no records, the
+// replay says so instead of passing for exact
+static void Test_Partial_Capture(void)
+{
+	uint32_t Skip=Original_Count/2U;
+
+	Capture_Replayer_Init(&Replayer,&Original[Skip],Original_Count-Skip,Replayed,TEST_RECORDS);
+	Capture_Replayer_Run(&Replayer,Capture_Replayer_Duration_ms(&Original[Skip],Original_Count-Skip));
+
+	TEST_CHECK(Replayer.Statistics.Skipped+Replayer.Statistics.Unmatched>0U);
+	TEST_CHECK(Replayer.Diverged_At!=CAPTURE_REPLAYER_NONE);
+	TEST_CHECK(Host_Halted()==FALSE);
+	printf("  %u matched, %u skipped, %u unmatched\n",Replayer.Statistics.Matched,Replayer.Statistics.Skipped,
+		Replayer.Statistics.Unmatched);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	Test_Record();
+
+	TEST_RUN(Test_File_Round_Trip);
+	TEST_RUN(Test_Exact_Replay);
+	TEST_RUN(Test_Filter_Comparison);
+	TEST_RUN(Test_Altered_Capture);
+	TEST_RUN(Test_Partial_Capture);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_Capture_Replay.c
+  * @brief          : Capture of a run replayed through the firmware, exact and altered
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,329 @@
+/**
+  ******************************************************************************
+  * @file           : Test_Host_Platform.c
+  * @brief          : Host MCU backend: flash, CAN, SPI, interrupts and time base
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include "Profiler.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Flash                         ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_Flash_Program_And_Erase(void)
+{
+	Host_Reset();
+	Host_Flash_Erase_All();
+
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA)==0xFFFFFFFFU);
+	MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA,0x12345678U);
+	MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA_BKUP,0xCAFEF00DU);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA)==0x12345678U);
+	TEST_CHECK(MCU_Flash_Read_Byte(MCU_ADDRESS_BOOTLOADER_DATA)==0x78U);
+
+	// Programming only clears bits, setting one is counted as an error
+	MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA,0x12340000U);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA)==0x12340000U);
+	TEST_CHECK(Host_Get_Statistics()->Flash_Program_Errors==0U);
+	MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA,0xFFFF0001U);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA)==0x12340000U);
+	TEST_CHECK(Host_Get_Statistics()->Flash_Program_Errors==1U);
+
+	// The erase only touches its own sector
+	MCU_Flash_Erase_Sector(MCU_SECTOR_BOOTLOADER_DATA);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA)==0xFFFFFFFFU);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA+0x3FFCU)==0xFFFFFFFFU);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA_BKUP)==0xCAFEF00DU);
+	TEST_CHECK(Host_Halted()==FALSE);
+}
+
+static void Test_Flash_Power_Cut(void)
+{
+	Host_Reset();
+	Host_Flash_Erase_All();
+
+	Host_Flash_Power_Cut(2);
+	MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA,0x11111111U);
+	MCU_Flash_Erase_Sector(MCU_SECTOR_BOOTLOADER_DATA_BKUP);
+	MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA+4,0x22222222U);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA)==0x11111111U);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA+4)==0xFFFFFFFFU);
+
+	// Power comes back with the reset
+	Host_Reset();
+	MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA+4,0x22222222U);
+	TEST_CHECK(MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA+4)==0x22222222U);
+}
+
+static void Test_Flash_Unique_ID_And_Faults(void)
+{
+	const uint8_t Unique_ID[4]={0x01,0x02,0x03,0x04};
+
+	Host_Reset();
+	Host_Flash_Load(Address_Unique_ID_B0,Unique_ID,sizeof(Unique_ID));
+	TEST_CHECK(MCU_Flash_Read_Byte(Address_Unique_ID_B3)==0x04U);
+
+	// The system memory cannot be programmed, out of memory accesses stop the core
+	MCU_Flash_Program_Byte(Address_Unique_ID_B0,0x00);
+	TEST_CHECK(MCU_Flash_Read_Byte(Address_Unique_ID_B0)==0x01U);
+	TEST_CHECK(Host_Halted()==FALSE);
+	MCU_Flash_Read_Word(0x20000000U);
+	TEST_CHECK(Host_Halted()==TRUE);
+	TEST_CHECK(Host_Get_Statistics()->Errors==1U);
+	Host_Reset();
+	TEST_CHECK(Host_Halted()==FALSE);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 CAN                           ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_CAN_Mailboxes(void)
+{
+	CAN_TxHeaderTypeDef Header={0};
+	uint8_t Data[8]={1,2,3,4,5,6,7,8};
+	uint32_t Mailbox;
+	Host_CAN_Frame_TypeDef Frame;
+
+	Host_Reset();
+	MCU_Init();
+	Host_CAN1_Hold(TRUE);
+	Header.DLC=8;
+	Header.StdId=0x300;
+	TEST_CHECK(MCU_CAN1_Send(&Header,Data,&Mailbox)==TRUE);
+	Header.StdId=0x100;
+	TEST_CHECK(MCU_CAN1_Send(&Header,Data,&Mailbox)==TRUE);
+	Header.StdId=0x200;
+	TEST_CHECK(MCU_CAN1_Send(&Header,Data,&Mailbox)==TRUE);
+	TEST_CHECK(Mailbox==4U);
+	TEST_CHECK(MCU_CAN1_Send(&Header,Data,&Mailbox)==FALSE);
+	TEST_CHECK(Host_CAN1_Mailboxes_Busy()==3U);
+
+	// Nothing leaves without acknowledge, then the lowest identifier goes first
+	MCU_Delay(5);
+	TEST_CHECK(Host_CAN1_Take(&Frame)==FALSE);
+	Host_CAN1_Hold(FALSE);
+	MCU_Delay(1);
+	TEST_CHECK(Host_CAN1_Take(&Frame)==TRUE && Frame.Id==0x100U && Frame.Data[7]==8U);
+	TEST_CHECK(Host_CAN1_Take(&Frame)==TRUE && Frame.Id==0x200U);
+	TEST_CHECK(Host_CAN1_Take(&Frame)==TRUE && Frame.Id==0x300U && Frame.Tick==7U);
+	TEST_CHECK(Host_CAN1_Take(&Frame)==FALSE);
+	TEST_CHECK(MCU_CAN1_Get_Bitrate()==500000U);
+}
+
+static void Test_CAN_Receive_Interrupt(void)
+{
+	const uint8_t Data[8]={0};
+	uint32_t Rx_Frames;
+
+	Test_Boot();
+	Rx_Frames=CAN1_Get_Statistics()->Rx_Frames;
+
+	// The RX0 interrupt waits for the end of the critical section
+	uint32_t State=MCU_Critical_Enter();
+	TEST_CHECK(Host_CAN1_Inject(0x7FF,8,Data)==TRUE);
+	TEST_CHECK(Host_CAN1_Inject(0x7FF,8,Data)==TRUE);
+	TEST_CHECK(Host_CAN1_Inject(0x7FF,8,Data)==TRUE);
+	TEST_CHECK(Host_CAN1_Inject(0x7FF,8,Data)==FALSE);
+	TEST_CHECK(Host_Get_Statistics()->CAN1_Rx_Overruns==1U);
+	TEST_CHECK(CAN1_Get_Statistics()->Rx_Frames==Rx_Frames);
+	MCU_Critical_Exit(State);
+	TEST_CHECK(CAN1_Get_Statistics()->Rx_Frames==Rx_Frames+3U);
+
+	// Outside it the frame is taken at once
+	TEST_CHECK(Host_CAN1_Inject(0x7FF,8,Data)==TRUE);
+	TEST_CHECK(CAN1_Get_Statistics()->Rx_Frames==Rx_Frames+4U);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 SPI                           ***************	
+********************************************************************************
+*******************************************************************************/
+typedef struct
+{
+	uint8_t		Selects;
+	uint8_t		Received[4];
+	uint8_t		Count;
+} Test_SPI_Device_TypeDef;
+
+static void Test_SPI_Device_Select(void* Context, BoolTypeDef Selected)
+{
+	Test_SPI_Device_TypeDef* Device=Context;
+
+	if(Selected==TRUE)
+	{
+		Device->Selects++;
+	}
+}
+
+static uint8_t Test_SPI_Device_Exchange(void* Context, uint8_t Byte)
+{
+	Test_SPI_Device_TypeDef* Device=Context;
+
+	if(Device->Count<sizeof(Device->Received))
+	{
+		Device->Received[Device->Count]=Byte;
+	}
+	return (uint8_t)(0xA0U+Device->Count++);
+}
+
+static void Test_SPI_Exchange(void)
+{
+	Test_SPI_Device_TypeDef Device={0};
+	Host_SPI_Device_TypeDef Bus={&Device,Test_SPI_Device_Select,Test_SPI_Device_Exchange};
+	uint8_t Tx[2]={0x12,0x34};
+	uint8_t Rx[2]={0};
+
+	Host_Reset();
+	MCU_SPI1_Init();
+	Host_SPI_Attach(HOST_SPI_1,&Bus);
+
+	// Not selected, the device does not see the clock and MISO floats high
+	TEST_CHECK(MCU_SPI_Receive(MCU_SPI_1,Rx,2,10)==TRUE);
+	TEST_CHECK(Rx[0]==0xFFU && Device.Count==0U);
+
+	MCU_SPI_Chip_Select(MCU_SPI_1,TRUE);
+	TEST_CHECK(MCU_SPI_Transmit(MCU_SPI_1,Tx,2,10)==TRUE);
+	TEST_CHECK(MCU_SPI_Receive(MCU_SPI_1,Rx,2,10)==TRUE);
+	MCU_SPI_Chip_Select(MCU_SPI_1,FALSE);
+	TEST_CHECK(Device.Selects==1U);
+	TEST_CHECK(Device.Received[0]==0x12U && Device.Received[1]==0x34U && Device.Received[2]==0xFFU);
+	TEST_CHECK(Rx[0]==0xA2U && Rx[1]==0xA3U);
+
+	// The other bus has nothing attached
+	MCU_SPI_Chip_Select(MCU_SPI_2,TRUE);
+	TEST_CHECK(MCU_SPI_Receive(MCU_SPI_2,Rx,1,10)==TRUE && Rx[0]==0xFFU);
+	MCU_SPI_Chip_Select(MCU_SPI_2,FALSE);
+	Host_SPI_Attach(HOST_SPI_1,NULL);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Time Base and Interrupts           ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_Time_Base(void)
+{
+	Host_Reset();
+	TEST_CHECK(MCU_Get_Tick()==0U);
+	// HAL_Delay waits one tick more
+	MCU_Delay(7);
+	TEST_CHECK(MCU_Get_Tick()==8U);
+	Host_Advance_ms(2);
+	TEST_CHECK(MCU_Get_Tick()==10U);
+
+	TEST_CHECK(MCU_Get_Core_Clock_MHz()==16U);
+	MCU_Clock_High_Speed();
+	TEST_CHECK(MCU_Get_Core_Clock_MHz()==64U);
+	MCU_Clock_Low_Power();
+	TEST_CHECK(Host_Get_Statistics()->Clock_Switches==2U);
+}
+
+static void Test_Timer_Interrupt(void)
+{
+	Test_Boot();
+	Profiler_Reset(PROFILER_TIM7_IRQ);
+	Profiler_Reset(PROFILER_PENDSV);
+
+	// TIM7 is held back by a critical section, then its requests are served
+	// together and the deferred work runs once for all of them
+	uint32_t State=MCU_Critical_Enter();
+	Host_Advance_ms(60);
+	TEST_CHECK(Profiler_Get(PROFILER_TIM7_IRQ)->Count==0U);
+	MCU_Critical_Exit(State);
+	TEST_CHECK(Profiler_Get(PROFILER_TIM7_IRQ)->Count==60U);
+	TEST_CHECK(Profiler_Get(PROFILER_PENDSV)->Count==1U);
+
+	Host_Advance_ms(5);
+	TEST_CHECK(Profiler_Get(PROFILER_TIM7_IRQ)->Count==65U);
+	TEST_CHECK(Profiler_Get(PROFILER_PENDSV)->Count==6U);
+}
+
+static void Test_GPIO(void)
+{
+	Host_Reset();
+	MCU_GPIO_Init_C8_Output();
+	MCU_GPIO_Write_C8_Output(TRUE);
+	TEST_CHECK(Host_GPIO_Read_C8()==TRUE && Host_GPIO_Read_C9()==FALSE);
+	MCU_GPIO_Write_C8_Output(FALSE);
+	MCU_GPIO_Write_C9_Output(TRUE);
+	TEST_CHECK(Host_GPIO_Read_C8()==FALSE && Host_GPIO_Read_C9()==TRUE);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_Flash_Program_And_Erase);
+	TEST_RUN(Test_Flash_Power_Cut);
+	TEST_RUN(Test_Flash_Unique_ID_And_Faults);
+	TEST_RUN(Test_CAN_Mailboxes);
+	TEST_RUN(Test_CAN_Receive_Interrupt);
+	TEST_RUN(Test_SPI_Exchange);
+	TEST_RUN(Test_Time_Base);
+	TEST_RUN(Test_Timer_Interrupt);
+	TEST_RUN(Test_GPIO);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_Host_Platform.c
+  * @brief          : Host MCU backend: flash, CAN, SPI, interrupts and time base
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file           : Test_LTC6811_Codec.c
+  * @brief          : LTC6811 PEC15, command framing and the CAN encoders
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 PEC15                         ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_PEC15_Datasheet_Vectors(void)
+{
+	uint8_t Command[4];
+
+	// Datasheet examples, WRCFG and ADCV with MD=10 DCP=0 CH=000
+	LTC6811_Build_Command(LTC6811_CMD_WRCFG,Command);
+	TEST_CHECK(Command[0]==0x00U && Command[1]==0x01U && Command[2]==0x3DU && Command[3]==0x6EU);
+	LTC6811_Build_Command(0x0360,Command);
+	TEST_CHECK(Command[0]==0x03U && Command[1]==0x60U && Command[2]==0xF4U && Command[3]==0x6CU);
+
+	// A register group followed by its PEC checks to the same value
+	uint8_t Group[8]={0x12,0x34,0x56,0x78,0x9A,0xBC,0,0};
+	uint16_t PEC=LTC6811_PEC15_Calc(Group,6);
+	TEST_CHECK((PEC & 0x0001U)==0U);
+	Group[6]=(uint8_t)(PEC>>8);
+	Group[7]=(uint8_t)PEC;
+	Group[3]^=0x01U;
+	TEST_CHECK(LTC6811_PEC15_Calc(Group,6)!=PEC);
+}
+
+static void Test_Command_Codes(void)
+{
+	TEST_CHECK(LTC6811_ADCV(LTC6811_MD_NORMAL,0,0)==0x0360U);
+	TEST_CHECK(LTC6811_ADCVSC(LTC6811_MD_NORMAL,0)==0x0567U);
+	TEST_CHECK((LTC6811_ADCV(LTC6811_MD_FILTERED,1,5) & LTC6811_ADCV_MASK)==LTC6811_CMD_ADCV);
+	TEST_CHECK((LTC6811_ADCVSC(LTC6811_MD_FAST,1) & LTC6811_ADCVSC_MASK)==LTC6811_CMD_ADCVSC);
+	TEST_CHECK(LTC6811_ADC_TIMEOUT_MS>LTC6811_ADCV_TIME_MS);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Encoders                      ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_Encoders(void)
+{
+	TEST_CHECK(LTC6811_Encode_Volt_10mV(3.60f)==160U);
+	TEST_CHECK(LTC6811_Encode_Volt_10mV(1.00f)==0U);
+	TEST_CHECK(LTC6811_Encode_Volt_10mV(5.00f)==255U);
+	TEST_CHECK(LTC6811_Enconde_Temp(25.0f)==90U);
+	TEST_CHECK(LTC6811_Enconde_Temp(-40.0f)==0U);
+	TEST_CHECK(LTC6811_Enconde_Temp(200.0f)==255U);
+}
+
+static void Test_Thermistor_Curve(void)
+{
+	// Table points, an interpolated one and both ends out of range
+	TEST_CHECK_NEAR(LTC_Voltage_to_Temperature(1.86f),25.0f,0.001f);
+	TEST_CHECK_NEAR(LTC_Voltage_to_Temperature(2.44f),-40.0f,0.001f);
+	TEST_CHECK_NEAR(LTC_Voltage_to_Temperature(1.83f),27.5f,0.01f);
+	TEST_CHECK(LTC_Voltage_to_Temperature(2.50f)==LTC6811_TEMPERATURE_OUT_OF_RANGE);
+	TEST_CHECK(LTC_Voltage_to_Temperature(1.20f)==LTC6811_TEMPERATURE_OUT_OF_RANGE);
+
+	// Lower voltage, higher temperature over the whole table
+	float Previous=LTC_Voltage_to_Temperature(2.44f);
+	for(float v=2.43f; v>1.30f; v-=0.01f)
+	{
+		float Temperature=LTC_Voltage_to_Temperature(v);
+		TEST_CHECK(Temperature>=Previous);
+		Previous=Temperature;
+	}
+	TEST_CHECK(LTC_Voltage_to_Temperature_Curve(LTC6811_TEMPERATURE_CURVES,1.86f)==LTC_Voltage_to_Temperature(1.86f));
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_PEC15_Datasheet_Vectors);
+	TEST_RUN(Test_Command_Codes);
+	TEST_RUN(Test_Encoders);
+	TEST_RUN(Test_Thermistor_Curve);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_LTC6811_Codec.c
+  * @brief          : LTC6811 PEC15, command framing and the CAN encoders
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,430 @@
+/**
+  ******************************************************************************
+  * @file           : Test_LTC6811_Simulator.c
+  * @brief          : LTC6811 driver against the SPI level chip model
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include "LTC6811_Simulator.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+// The driver runs on its own here, the main loop is never called
+static LTC6811_Simulator_TypeDef Chip;
+static LTC6811_Typdef LTC6811;
+
+// Each chip select frame: two guards and 16 us per byte, a PLADC poll is 8 bytes
+#define TEST_POLL_US		(2U*LTC6811_CS_GUARD_US+8U*HOST_SPI_BYTE_US)
+
+static void Test_Setup(void)
+{
+	Test_Boot();
+	LTC6811_Simulator_Init(&Chip);
+	LTC6811_Simulator_Attach(&Chip,HOST_SPI_1);
+	memset(&LTC6811,0,sizeof(LTC6811));
+	LTC6811.SPI=MCU_SPI_1;
+}
+
+static void Test_Wake(void)
+{
+	LTC6811_Wake_Up_Pulse(&LTC6811);
+	MCU_Delay(LTC6811_WAKE_TIME_MS);
+}
+
+// us from the call until PLADC reads done, 0 if it never did within 300 ms
+static uint32_t Test_Wait_ADC(uint64_t Start)
+{
+	while(LTC6811_ADC_Done(&LTC6811)==FALSE)
+	{
+		if(Host_Get_Time_us()-Start>300000U)
+		{
+			return 0;
+		}
+	}
+	return (uint32_t)(Host_Get_Time_us()-Start);
+}
+
+static void Test_Config(uint8_t CFGR0)
+{
+	memset(LTC6811.Config,0,sizeof(LTC6811.Config));
+	LTC6811.Config[0]=CFGR0;
+	LTC6811_Write_CFG(&LTC6811);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+// The frame that wakes the core is lost, after tWAKE the configuration reads back
+static void Test_Wake_Up(void)
+{
+	Test_Setup();
+	LTC6811_Write_Default_Config(&LTC6811);
+	TEST_CHECK(LTC6811.Fail==TRUE);
+	TEST_CHECK(Chip.Statistics.Wake_Ups==1U);
+	TEST_CHECK(Chip.Statistics.Ignored_Frames>=1U);
+	TEST_CHECK(Chip.Statistics.Config_Writes==0U);
+
+	LTC6811.Fail=FALSE;
+	MCU_Delay(LTC6811_WAKE_TIME_MS);
+	LTC6811_Write_Default_Config(&LTC6811);
+	TEST_CHECK(LTC6811.Fail==FALSE);
+	TEST_CHECK(Chip.State==LTC6811_SIMULATOR_STANDBY);
+	TEST_CHECK(Chip.Statistics.Config_Writes==1U);
+	TEST_CHECK(Chip.CFGR[0]==0x00 && Chip.CFGR[4]==0x00);
+	TEST_CHECK(Chip.Statistics.Command_PEC_Errors==0U && Chip.Statistics.Data_PEC_Errors==0U);
+}
+
+// Bad command and data PECs are refused, bad read PECs fail the block
+static void Test_PEC_Errors(void)
+{
+	uint8_t Frame[12];
+	uint16_t Cells[3];
+
+	Test_Setup();
+	Test_Wake();
+
+	LTC6811_Build_Command(LTC6811_CMD_DIAGN,Frame);
+	Frame[3]^=0x01;
+	LTC6811_SPI_Transfer(&LTC6811,Frame,4);
+	TEST_CHECK(Chip.Statistics.Command_PEC_Errors==1U);
+	TEST_CHECK(Chip.Statistics.Commands==0U);
+	TEST_CHECK(Chip.Converting==FALSE);
+
+	memset(Frame,0,sizeof(Frame));
+	LTC6811_Build_Command(LTC6811_CMD_WRCFG,Frame);
+	Frame[8]=0xAA;
+	LTC6811_SPI_Transfer(&LTC6811,Frame,12);
+	TEST_CHECK(Chip.Statistics.Data_PEC_Errors==1U);
+	TEST_CHECK(Chip.CFGR[4]==0x00);
+
+	// LTC_Read_All_Voltages tries each block twice
+	Chip.Faults.Corrupt_Reads=1;
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDCVA,Cells)==FALSE);
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDCVA,Cells)==TRUE);
+	TEST_CHECK(Chip.Statistics.Corrupted_Reads==1U);
+	TEST_CHECK(LTC6811.Fail==FALSE);
+}
+
+// PLADC stays busy for the conversion time of MD, plus tREFUP from standby
+static void Test_Conversion_Time(void)
+{
+	const struct
+	{
+		uint8_t MD;
+		uint32_t Time_us;
+	} Modes[]=
+	{
+		{LTC6811_MD_FAST, LTC6811_ADCV_TIME_US_FAST},
+		{LTC6811_MD_NORMAL, LTC6811_ADCV_TIME_US_NORMAL},
+		{LTC6811_MD_FILTERED, LTC6811_ADCV_TIME_US_FILTERED}
+	};
+
+	Test_Setup();
+	Test_Wake();
+	Test_Config(LTC6811_CFGR0_REFON);
+	MCU_Delay(LTC6811_SETTLE_TIME_MS);
+	TEST_CHECK(Chip.State==LTC6811_SIMULATOR_REFUP);
+
+	for(uint8_t i=0; i<sizeof(Modes)/sizeof(Modes[0]); i++)
+	{
+		uint32_t Busy=Chip.Statistics.Busy_Polls;
+		uint64_t Start=Host_Get_Time_us();
+
+		LTC6811_Send_Command(&LTC6811,LTC6811_ADCV(Modes[i].MD,0,0));
+		uint32_t Time=Test_Wait_ADC(Start);
+		TEST_CHECK(Time>=Modes[i].Time_us);
+		TEST_CHECK(Time<=Modes[i].Time_us+2U*TEST_POLL_US+100U);
+		TEST_CHECK(Chip.Statistics.Busy_Polls>Busy);
+	}
+
+	// The sum of cells is one more slot
+	uint64_t Start=Host_Get_Time_us();
+	LTC6811_Send_Command(&LTC6811,LTC6811_ADCVSC(LTC6811_MD_NORMAL,0));
+	uint32_t Time=Test_Wait_ADC(Start);
+	TEST_CHECK(Time>=LTC6811_ADCVSC_TIME_US-1U);
+	TEST_CHECK(Time<=LTC6811_ADCVSC_TIME_US+2U*TEST_POLL_US+100U);
+
+	Test_Config(0x00);
+	TEST_CHECK(Chip.State==LTC6811_SIMULATOR_STANDBY);
+	Start=Host_Get_Time_us();
+	LTC6811_Send_Command(&LTC6811,LTC6811_ADCV(LTC6811_MD_NORMAL,0,0));
+	Time=Test_Wait_ADC(Start);
+	TEST_CHECK(Time>=LTC6811_ADCV_TIME_US_NORMAL+LTC6811_SIMULATOR_REFUP_US);
+	TEST_CHECK(Time<=LTC6811_ADCV_TIME_US_NORMAL+LTC6811_SIMULATOR_REFUP_US+2U*TEST_POLL_US+100U);
+
+	// A stuck ADC never ends
+	Chip.Faults.ADC_Stuck=TRUE;
+	LTC6811_Start_ADC_Conv(&LTC6811,FALSE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())==0U);
+}
+
+// The cells and SC read back, the inputs with DCC on read their sensor
+static void Test_Readings_And_Discharge(void)
+{
+	float Voltages[12];
+	float Sum=0.0f;
+	float Expected=0.0f;
+
+	Test_Setup();
+	for(uint8_t i=0; i<12; i++)
+	{
+		Chip.Cell[i]=LTC6811_Simulator_Constant(3.0f+0.05f*i);
+		Expected+=3.0f+0.05f*i;
+	}
+	LTC6811_Simulator_Set_Temperatures(&Chip,40.0f);
+	Test_Wake();
+
+	LTC6811_Start_ADC_Conv(&LTC6811,TRUE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	LTC_Read_All_Voltages(&LTC6811,Voltages);
+	TEST_CHECK(LTC6811.Fail==FALSE);
+	for(uint8_t i=0; i<12; i++)
+	{
+		TEST_CHECK_NEAR(Voltages[i],3.0f+0.05f*i,0.0001f);
+	}
+	TEST_CHECK(LTC6811_Read_Sum_Of_Cells(&LTC6811,&Sum)==TRUE);
+	TEST_CHECK_NEAR(Sum,Expected,LTC6811_SC_LSB);
+
+	// Inputs 1, 3, 5... on, like the even balancing phase
+	TEST_CHECK(LTC6811_Write_Discharge(&LTC6811,0x0AAA,0)==TRUE);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip)==0x0AAA);
+	LTC6811_Start_ADC_Conv(&LTC6811,FALSE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	LTC_Read_All_Voltages(&LTC6811,Voltages);
+	for(uint8_t i=0; i<12; i++)
+	{
+		if(i%2U==1U)
+		{
+			TEST_CHECK_NEAR(LTC_Voltage_to_Temperature(Voltages[i]),40.0f,0.1f);
+		}
+		else
+		{
+			TEST_CHECK_NEAR(Voltages[i],3.0f+0.05f*i,0.0001f);
+		}
+	}
+
+	// The cell flags follow the thresholds of the configuration
+	memset(LTC6811.Config,0,sizeof(LTC6811.Config));
+	LTC6811.Config[1]=0xFF;
+	LTC6811.Config[2]=0xFF;
+	LTC6811.Config[3]=0xFF;
+	LTC6811_Write_CFG(&LTC6811);
+	LTC6811_Start_ADC_Conv(&LTC6811,FALSE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	TEST_CHECK(Chip.STAT[4]==0x5555);
+}
+
+// The scripted voltages follow the virtual time
+static void Test_Waveforms(void)
+{
+	float Voltages[12];
+	uint32_t Now;
+
+	Test_Setup();
+	Test_Wake();
+	Now=MCU_Get_Tick();
+	Chip.Cell[0]=LTC6811_Simulator_Ramp(3.6f,3.0f,Now+100U,1000U);
+	Chip.Cell[1]=LTC6811_Simulator_Sine(3.6f,0.2f,400U);
+	Chip.Cell[1].Start_ms=Now+100U;
+
+	LTC6811_Start_ADC_Conv(&LTC6811,FALSE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	LTC_Read_All_Voltages(&LTC6811,Voltages);
+	TEST_CHECK_NEAR(Voltages[0],3.6f,0.0001f);
+	TEST_CHECK_NEAR(Voltages[1],3.6f,0.001f);
+
+	// Sampled when the command arrives, 500 ms into both
+	Host_Advance_ms(Now+600U-MCU_Get_Tick());
+	LTC6811_Start_ADC_Conv(&LTC6811,FALSE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	LTC_Read_All_Voltages(&LTC6811,Voltages);
+	TEST_CHECK_NEAR(Voltages[0],3.3f,0.001f);
+	TEST_CHECK_NEAR(Voltages[1],3.6f+0.2f*sin(2.0*3.14159265*500.0/400.0),0.002f);
+
+	Host_Advance_ms(1000);
+	LTC6811_Start_ADC_Conv(&LTC6811,FALSE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	LTC_Read_All_Voltages(&LTC6811,Voltages);
+	TEST_CHECK_NEAR(Voltages[0],3.0f,0.0001f);
+}
+
+// tSLEEP without a valid command resets the configuration, but a discharge
+// with a DCTO timer keeps running until the timer ends
+static void Test_Sleep_And_Discharge_Timer(void)
+{
+	Test_Setup();
+	Test_Wake();
+	TEST_CHECK(LTC6811_Write_Discharge(&LTC6811,0x0003,0)==TRUE);
+	Host_Advance_ms(LTC6811_SIMULATOR_SLEEP_US/1000U+10U);
+	LTC6811_Simulator_Update(&Chip);
+	TEST_CHECK(Chip.State==LTC6811_SIMULATOR_SLEEP);
+	TEST_CHECK(Chip.Statistics.Sleeps==1U);
+	TEST_CHECK(Chip.CFGR[0]==LTC6811_SIMULATOR_CFGR0_DEFAULT);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip)==0U);
+
+	Test_Wake();
+	TEST_CHECK(LTC6811_Write_Discharge(&LTC6811,0x0003,LTC6811_DCTO_30S)==TRUE);
+	Host_Advance_ms(LTC6811_SIMULATOR_SLEEP_US/1000U+10U);
+	LTC6811_Simulator_Update(&Chip);
+	TEST_CHECK(Chip.State==LTC6811_SIMULATOR_SLEEP);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip)==0x0003);
+
+	Host_Advance_ms(30000U);
+	LTC6811_Simulator_Update(&Chip);
+	TEST_CHECK(LTC6811_Simulator_Discharge(&Chip)==0U);
+	TEST_CHECK(Chip.Statistics.Discharge_Timeouts==1U);
+}
+
+// Self-test codes, status conversion and the diagnostic flags
+static void Test_Self_Test_And_Status(void)
+{
+	uint16_t Registers[3];
+
+	Test_Setup();
+	Test_Wake();
+
+	LTC6811_Send_Command(&LTC6811,LTC6811_CVST(LTC6811_MD_NORMAL,1));
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDCVD,Registers)==TRUE);
+	TEST_CHECK(Registers[0]==0x9555 && Registers[2]==0x9555);
+
+	LTC6811_Send_Command(&LTC6811,LTC6811_AXST(LTC6811_MD_NORMAL,2));
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDAUXA,Registers)==TRUE);
+	TEST_CHECK(Registers[1]==0x6AAA);
+
+	Chip.Die_Temperature=47.0f;
+	LTC6811_Send_Command(&LTC6811,LTC6811_ADSTAT(LTC6811_MD_NORMAL,0));
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDSTATA,Registers)==TRUE);
+	TEST_CHECK_NEAR(Registers[0]*LTC6811_SC_LSB,12.0f*LTC6811_SIMULATOR_DEFAULT_CELL,LTC6811_SC_LSB);
+	TEST_CHECK_NEAR(LTC6811_ITMP_TO_C(Registers[1]),47.0f,0.1f);
+	TEST_CHECK_NEAR(Registers[2]*LTC6811_ADC_LSB,5.0f,LTC6811_ADC_LSB);
+
+	Chip.Faults.Mux_Fail=TRUE;
+	Chip.Faults.Thermal_Shutdown=TRUE;
+	LTC6811_Send_Command(&LTC6811,LTC6811_CMD_DIAGN);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDSTATB,Registers)==TRUE);
+	TEST_CHECK_NEAR(Registers[0]*LTC6811_ADC_LSB,3.0f,LTC6811_ADC_LSB);
+	TEST_CHECK(((Registers[2]>>8) & LTC6811_STBR5_MUXFAIL)!=0U);
+	TEST_CHECK(((Registers[2]>>8) & LTC6811_STBR5_THSD)!=0U);
+	TEST_CHECK(LTC6811_STBR5_REV(Registers[2]>>8)==Chip.Revision);
+	TEST_CHECK(Chip.Statistics.Unknown_Commands==0U);
+}
+
+// An open C5 wire: cell 6 reads zero with the pull-up, cell 5 with the pull-down
+static void Test_Open_Wire(void)
+{
+	float Voltages[12];
+
+	Test_Setup();
+	// Below 3.28 V the two cells fit in the 6.5535 V full scale
+	LTC6811_Simulator_Set_Cells(&Chip,3.0f);
+	Chip.Faults.Open_Pins=1U<<5;
+	Test_Wake();
+
+	LTC6811_Start_Open_Wire_Conv(&LTC6811,TRUE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	LTC_Read_All_Voltages(&LTC6811,Voltages);
+	TEST_CHECK_NEAR(Voltages[5],0.0f,0.0001f);
+	TEST_CHECK_NEAR(Voltages[4],6.0f,0.0002f);
+	TEST_CHECK_NEAR(Voltages[6],3.0f,0.0001f);
+
+	LTC6811_Start_Open_Wire_Conv(&LTC6811,FALSE);
+	TEST_CHECK(Test_Wait_ADC(Host_Get_Time_us())!=0U);
+	LTC_Read_All_Voltages(&LTC6811,Voltages);
+	TEST_CHECK_NEAR(Voltages[4],0.0f,0.0001f);
+	TEST_CHECK_NEAR(Voltages[5],6.0f,0.0002f);
+}
+
+// A dead chip leaves MISO high, every read fails its PEC
+static void Test_Dead_Chip(void)
+{
+	uint16_t Registers[3];
+
+	Test_Setup();
+	Test_Wake();
+	Chip.Faults.Dead=TRUE;
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDCFG,Registers)==FALSE);
+	TEST_CHECK(Chip.Statistics.Commands==0U);
+
+	Chip.Faults.Dead=FALSE;
+	TEST_CHECK(LTC6811_Read_Cell_Block(&LTC6811,LTC6811_CMD_RDCFG,Registers)==TRUE);
+}
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_Wake_Up);
+	TEST_RUN(Test_PEC_Errors);
+	TEST_RUN(Test_Conversion_Time);
+	TEST_RUN(Test_Readings_And_Discharge);
+	TEST_RUN(Test_Waveforms);
+	TEST_RUN(Test_Sleep_And_Discharge_Timer);
+	TEST_RUN(Test_Self_Test_And_Status);
+	TEST_RUN(Test_Open_Wire);
+	TEST_RUN(Test_Dead_Chip);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_LTC6811_Simulator.c
+  * @brief          : LTC6811 driver against the SPI level chip model
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
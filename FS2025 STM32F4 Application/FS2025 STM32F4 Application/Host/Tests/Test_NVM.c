@@ -0,0 +1,314 @@
+/**
+  ******************************************************************************
+  * @file           : Test_NVM.c
+  * @brief          : NVM rewrite through the backup copy with the power cut at every flash operation
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include "Calibration.h"
+#include "LTC6811_Simulator.h"
+#include "Scan_Scheduler.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Helpers                       ***************	
+********************************************************************************
+*******************************************************************************/
+#define TEST_SENSORS_WORD	((Address_APP_BPCU_Activated_Sensors-Address_Bootloader_Stay_Condition)/4)
+#define TEST_SLOW_WORD		((Address_APP_BPCU_Scan_Period_Slow-Address_Bootloader_Stay_Condition)/4)
+#define TEST_FAST_WORD		((Address_APP_BPCU_Scan_Period_Fast-Address_Bootloader_Stay_Condition)/4)
+
+// Bootloader words with a pattern, sensor 1 disabled and the tables erased
+static uint32_t Test_Image[BPCU_NVM_WORDS];
+
+// Cells at 3.60 V and sensors at 25 degC, for the calibration
+static LTC6811_Simulator_TypeDef Chip_1;
+static LTC6811_Simulator_TypeDef Chip_2;
+
+static void Test_NVM_Program(void)
+{
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		Test_Image[i]=(i<TEST_SENSORS_WORD) ? 0xA5000000U+i : 0xFFFFFFFFU;
+	}
+	Test_Image[TEST_SENSORS_WORD]=BPCU_CHANNEL_MASK & ~0x01UL;
+
+	Host_Reset();
+	Host_Flash_Erase_All();
+	Host_Flash_Load(MCU_ADDRESS_BOOTLOADER_DATA,Test_Image,sizeof(Test_Image));
+}
+
+// The master stays off the unit while a held rewrite runs
+static void Test_NVM_Open_Window(void)
+{
+	const uint8_t Open[1]={0x01};
+
+	Host_CAN1_Inject(BPCU_NVM_WINDOW_DEF,1,Open);
+	Host_Run_ms(2);
+}
+
+// Enabling sensor 1 sets a bit, so the sector has to be rewritten
+static void Test_NVM_Enable_Sensor_1(void)
+{
+	const uint8_t Enable[8]={0x01,0,0,0,0,0,0,0};
+
+	Host_CAN1_Inject(BPCU_CANCEL_SENSOR_1_DEF,8,Enable);
+	Host_Run_ms(2);
+	Test_NVM_Open_Window();
+}
+
+static void Test_NVM_Calibration_Command(const uint8_t* Command)
+{
+	Host_CAN1_Inject(BPCU_CALIBRATION_DEF,8,Command);
+	Host_Run_ms(2);
+}
+
+// The data sector holds the old or the new image, never a mix or a blank
+static BoolTypeDef Test_NVM_Data_Sector_Valid(BoolTypeDef* Updated)
+{
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		uint32_t Word=MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA+4*i);
+		if(i==TEST_SENSORS_WORD)
+		{
+			if(Word!=Test_Image[i] && Word!=BPCU_CHANNEL_MASK)
+			{
+				return FALSE;
+			}
+			*Updated=(Word==BPCU_CHANNEL_MASK) ? TRUE : FALSE;
+		}
+		else if(Word!=Test_Image[i])
+		{
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+static uint32_t Test_Rewrite_Operations;
+
+static void Test_Rewrite(void)
+{
+	BoolTypeDef Updated=FALSE;
+
+	Test_NVM_Program();
+	Test_Boot();
+	TEST_CHECK(CONTROL_UNIT.Status.Temperatures.Disabled==0x01UL);
+
+	// A window left to expire does not let the erase through
+	Test_NVM_Open_Window();
+	Host_Run_ms(BPCU_NVM_WINDOW_MS+100U);
+	uint32_t Operations=Host_Get_Statistics()->Flash_Erases+Host_Get_Statistics()->Flash_Programs;
+	const uint8_t Enable[8]={0x01,0,0,0,0,0,0,0};
+	Host_CAN1_Inject(BPCU_CANCEL_SENSOR_1_DEF,8,Enable);
+	Host_Run_ms(100);
+	TEST_CHECK(Host_Get_Statistics()->Flash_Erases+Host_Get_Statistics()->Flash_Programs==Operations);
+	TEST_CHECK(CONTROL_UNIT.NVM.Rewrite_Held==TRUE);
+	TEST_CHECK(CONTROL_UNIT.NVM.Rewrites==0U);
+
+	Test_NVM_Open_Window();
+	Test_Rewrite_Operations=Host_Get_Statistics()->Flash_Erases+Host_Get_Statistics()->Flash_Programs-Operations;
+
+	TEST_CHECK(Test_Rewrite_Operations>BPCU_NVM_WORDS);
+	TEST_CHECK(CONTROL_UNIT.NVM.Rewrites==1U);
+	TEST_CHECK(CONTROL_UNIT.NVM.Rewrite_Held==FALSE);
+	TEST_CHECK(CONTROL_UNIT.NVM.Window==FALSE);
+	TEST_CHECK(Test_NVM_Data_Sector_Valid(&Updated)==TRUE && Updated==TRUE);
+	TEST_CHECK(MCU_Flash_Read_Word(BPCU_NVM_BACKUP_MARKER)==BPCU_NVM_BACKUP_COMMITTED);
+	TEST_CHECK(Host_Get_Statistics()->Flash_Program_Errors==0U);
+
+	// The next boot finds a committed copy and leaves the sector alone
+	Test_Boot();
+	TEST_CHECK(CONTROL_UNIT.NVM.Restores==0U && CONTROL_UNIT.NVM.Sequence==1U);
+	TEST_CHECK(CONTROL_UNIT.Status.Temperatures.Disabled==0U);
+}
+
+// Boots with the scan period words, the periods of the three bands
+static void Test_Scan_Period_Boot(uint32_t Slow_Word, uint32_t Fast_Word, const uint32_t* Period)
+{
+	Test_NVM_Program();
+	Test_Image[TEST_SLOW_WORD]=Slow_Word;
+	Test_Image[TEST_FAST_WORD]=Fast_Word;
+	Host_Flash_Load(MCU_ADDRESS_BOOTLOADER_DATA,Test_Image,sizeof(Test_Image));
+	Test_Boot();
+
+	TEST_CHECK(CONTROL_UNIT.Scan_Scheduler.Period[SCAN_BAND_SLOW]==Period[SCAN_BAND_SLOW]);
+	TEST_CHECK(CONTROL_UNIT.Scan_Scheduler.Period[SCAN_BAND_NORMAL]==Period[SCAN_BAND_NORMAL]);
+	TEST_CHECK(CONTROL_UNIT.Scan_Scheduler.Period[SCAN_BAND_FAST]==Period[SCAN_BAND_FAST]);
+}
+
+static void Test_Scan_Periods(void)
+{
+	const uint32_t Erased[SCAN_BANDS]={SCAN_PERIOD_SLOW_MS,SCAN_PERIOD_NORMAL_MS,SCAN_PERIOD_FAST_MS};
+	const uint32_t Configured[SCAN_BANDS]={2000,500,200};
+	const uint32_t Narrow[SCAN_BANDS]={300,300,250};
+	const uint32_t Clamped[SCAN_BANDS]={SCAN_PERIOD_MAX_MS,SCAN_PERIOD_NORMAL_MS,SCAN_PERIOD_MIN_MS};
+	const uint32_t Crossed[SCAN_BANDS]={400,400,400};
+
+	Test_Scan_Period_Boot(0xFFFFFFFFU,0xFFFFFFFFU,Erased);
+	Test_Scan_Period_Boot(2000,200,Configured);
+	Test_Scan_Period_Boot(300,250,Narrow);
+	Test_Scan_Period_Boot(60000,0,Clamped);
+	Test_Scan_Period_Boot(400,800,Crossed);
+}
+
+/**
+ * @brief Calibration over the bus and back from NVM: SET of channel 5 and a
+ * zero of channel 3 to 3.6100 V, over the 3.2767 V of a signed reference. The
+ * zero is refused before a scan stores the channel and when it would move
+ * the offset past the bound. SAVE fits in the erased table, the next boot
+ * loads it.
+ */
+static void Test_Calibration_Round_Trip(void)
+{
+	const uint8_t Set[8]={CALIBRATION_SET_TEMPERATURE,5,0x2C,0x01,0x10,0x00,0,0};	// +3.00 degC, gain error 16
+	const uint8_t Zero[8]={CALIBRATION_ZERO_VOLTAGE,3,0x04,0x8D,0,0,0,0};					// 36100, 3.6100 V
+	const uint8_t Far[8]={CALIBRATION_ZERO_VOLTAGE,4,0x40,0x9C,0,0,0,0};					// 40000, 0.4 V over the reading
+	const uint8_t Save[8]={CALIBRATION_SAVE,0,0,0,0,0,0,0};
+	const float Gain=1.0f+16.0f*CALIBRATION_GAIN_LSB;
+
+	LTC6811_Simulator_Init(&Chip_1);
+	LTC6811_Simulator_Init(&Chip_2);
+	LTC6811_Simulator_Attach(&Chip_1,HOST_SPI_1);
+	LTC6811_Simulator_Attach(&Chip_2,HOST_SPI_2);
+	Test_NVM_Program();
+	Test_Boot();
+	TEST_CHECK(CONTROL_UNIT.Calibration.Loaded==FALSE);
+
+	// Only the boot placeholder of 3.6 V to zero against
+	TEST_CHECK(CONTROL_UNIT.Cell_Stats.Voltage_Lifetime[3].Count==0U);
+	Test_NVM_Calibration_Command(Zero);
+	TEST_CHECK(CONTROL_UNIT.Calibration.Rejected==1U);
+	TEST_CHECK(CONTROL_UNIT.Calibration.Voltage_Offset[3]==0.0f);
+
+	Host_Run_ms(3000);
+	Test_NVM_Calibration_Command(Set);
+	Test_NVM_Calibration_Command(Zero);
+	Test_NVM_Calibration_Command(Far);
+	TEST_CHECK(CONTROL_UNIT.Calibration.Rejected==2U);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Calibration.Voltage_Offset[3],0.0100f,0.0002f);
+	TEST_CHECK(CONTROL_UNIT.Calibration.Voltage_Offset[4]==0.0f);
+	Test_NVM_Calibration_Command(Save);
+	Host_Run_ms(100);
+	TEST_CHECK(CONTROL_UNIT.Calibration.Saves==1U);
+	TEST_CHECK(CONTROL_UNIT.NVM.Rewrites==0U);
+
+	// Power cycle, the table comes back from NVM
+	Test_Boot();
+	TEST_CHECK(CONTROL_UNIT.Calibration.Loaded==TRUE);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Calibration.Temperature_Offset[5],3.00f,0.005f);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Calibration.Temperature_Gain[5],Gain,1e-6f);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Calibration.Voltage_Offset[3],0.0100f,0.0002f);
+	TEST_CHECK(CONTROL_UNIT.Calibration.Voltage_Offset[4]==0.0f);
+	Host_Run_ms(3000);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Status.Voltages[3],3.6100f,0.0003f);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Status.Voltages[4],3.6000f,0.0003f);
+	TEST_CHECK_NEAR(CONTROL_UNIT.Status.Temperatures.Readed_Value[5],25.0f*Gain+3.00f,0.2f);
+
+	Host_SPI_Attach(HOST_SPI_1,NULL);
+	Host_SPI_Attach(HOST_SPI_2,NULL);
+}
+
+static void Test_Power_Cut_At_Every_Operation(void)
+{
+	uint32_t Old=0;
+	uint32_t New=0;
+
+	for(uint32_t Cut=0; Cut<=Test_Rewrite_Operations; Cut++)
+	{
+		BoolTypeDef Updated=FALSE;
+
+		Test_NVM_Program();
+		Test_Boot();
+		Host_Flash_Power_Cut(Cut);
+		Test_NVM_Enable_Sensor_1();
+
+		// Power cycle, the startup recovers from the backup copy if needed
+		Test_Boot();
+		TEST_CHECK(Test_NVM_Data_Sector_Valid(&Updated)==TRUE);
+		TEST_CHECK(CONTROL_UNIT.Status.Temperatures.Disabled==((Updated==TRUE) ? 0U : 0x01UL));
+		TEST_CHECK(Host_Get_Statistics()->Flash_Program_Errors==0U);
+		if(Updated==TRUE)
+		{
+			New++;
+		}
+		else
+		{
+			Old++;
+		}
+	}
+	// Early cuts keep the old image, the ones after the copy give the new one
+	TEST_CHECK(Old>0U && New>0U);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_Rewrite);
+	TEST_RUN(Test_Power_Cut_At_Every_Operation);
+	TEST_RUN(Test_Scan_Periods);
+	TEST_RUN(Test_Calibration_Round_Trip);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_NVM.c
+  * @brief          : NVM rewrite through the backup copy with the power cut at every flash operation
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
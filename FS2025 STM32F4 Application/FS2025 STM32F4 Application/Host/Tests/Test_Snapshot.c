@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * @file           : Test_Snapshot.c
+  * @brief          : Stress of the measurement snapshot under interrupts and threads
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include "Snapshot.h"
+#include <pthread.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+#define TEST_PHASE_MS					500U
+#define TEST_INTERRUPT_US			20U
+#define TEST_READERS					4U
+
+static Control_Unit_TypeDef Test_Unit;
+
+// Counts from the handlers and the threads, checked by the main thread
+typedef struct
+{
+	volatile uint32_t	Reads;
+	volatile uint32_t	Torn;						// Values of different scans in one copy
+	volatile uint32_t	Backwards;			// Scan count lower than an earlier read
+	volatile uint32_t	Overlaps;				// Reads or publishes that landed inside the other
+	volatile uint32_t	Unprotected_Torn;
+	volatile uint32_t	Last_Scan;
+} Test_Counts_TypeDef;
+
+static Test_Counts_TypeDef Test_Counts;
+static volatile BoolTypeDef Test_Publishing;
+static volatile BoolTypeDef Test_Reading;
+static volatile BoolTypeDef Test_Stop;
+
+// Every value of a scan follows from its count, so a mixed copy shows
+static float Test_Value(uint32_t Scan)
+{
+	return (float)(Scan & 0xFFFFFU);
+}
+
+static void Test_Publish(void)
+{
+	uint32_t Scan=Test_Unit.Snapshot.Sequence+1U;
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Test_Unit.Status.Temperatures.Actual_Value[i]=Test_Value(Scan);
+		Test_Unit.Status.Voltages[i]=Test_Value(Scan)+0.5f;
+	}
+	Test_Unit.Status.Temperatures_Hot=(uint8_t)(Scan%25U);
+	Test_Unit.Status.Temperatures_Failed=(uint8_t)((Scan/25U)%25U);
+	Snapshot_Publish(&Test_Unit);
+}
+
+static BoolTypeDef Test_Consistent(const Measurement_Snapshot_TypeDef* Snapshot)
+{
+	uint32_t Scan=Snapshot->Scan_Count;
+
+	if(Snapshot->Temperatures_Hot!=Scan%25U || Snapshot->Temperatures_Failed!=(Scan/25U)%25U)
+	{
+		return FALSE;
+	}
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		if(Snapshot->Temperatures[i]!=Test_Value(Scan) || Snapshot->Voltages[i]!=Test_Value(Scan)+0.5f)
+		{
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+static void Test_Check_Read(Test_Counts_TypeDef* Counts, const Measurement_Snapshot_TypeDef* Snapshot)
+{
+	Counts->Reads++;
+	Counts->Torn+=(Test_Consistent(Snapshot)==TRUE) ? 0U : 1U;
+	Counts->Backwards+=(Snapshot->Scan_Count<Counts->Last_Scan) ? 1U : 0U;
+	Counts->Last_Scan=Snapshot->Scan_Count;
+}
+
+// The published buffer copied once, as a reader without the sequence check
+static void Test_Unprotected_Read(Measurement_Snapshot_TypeDef* Snapshot)
+{
+	memcpy(Snapshot,&Test_Unit.Snapshot.Buffer[Test_Unit.Snapshot.Sequence & 1U],sizeof(Measurement_Snapshot_TypeDef));
+}
+
+static void Test_Start(void)
+{
+	memset(&Test_Unit,0,sizeof(Test_Unit));
+	memset((void*)&Test_Counts,0,sizeof(Test_Counts));
+	Test_Publishing=FALSE;
+	Test_Reading=FALSE;
+	Test_Stop=FALSE;
+	Snapshot_Init(&Test_Unit);
+	Test_Publish();
+}
+
+// Interrupts at a fixed rate on the main thread, like the CAN and timer ones
+static void Test_Interrupts(void (*Handler)(int), uint32_t Period_us)
+{
+	struct itimerval Timer={{0,(suseconds_t)Period_us},{0,(suseconds_t)Period_us}};
+
+	signal(SIGALRM,(Handler!=NULL) ? Handler : SIG_IGN);
+	if(Handler==NULL)
+	{
+		memset(&Timer,0,sizeof(Timer));
+	}
+	setitimer(ITIMER_REAL,&Timer,NULL);
+}
+
+static BoolTypeDef Test_Elapsed(const struct timespec* Start, uint32_t Time_ms)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC,&Now);
+	return ((Now.tv_sec-Start->tv_sec)*1000+(Now.tv_nsec-Start->tv_nsec)/1000000>=(long)Time_ms) ? TRUE : FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+static void Test_Reader_Handler(int Signal)
+{
+	Measurement_Snapshot_TypeDef Snapshot;
+
+	(void)Signal;
+	Test_Counts.Overlaps+=(Test_Publishing==TRUE) ? 1U : 0U;
+	Snapshot_Read(&Test_Unit,&Snapshot);
+	Test_Check_Read(&Test_Counts,&Snapshot);
+}
+
+// The CAN and timer handlers read while the main loop publishes: the reader
+// gets the last published scan and never has to wait for the writer
+static void Test_Reader_Interrupts_Writer(void)
+{
+	struct timespec Start;
+	uint32_t Publishes=0;
+
+	Test_Start();
+	clock_gettime(CLOCK_MONOTONIC,&Start);
+	Test_Interrupts(Test_Reader_Handler,TEST_INTERRUPT_US);
+	while(Test_Elapsed(&Start,TEST_PHASE_MS)==FALSE)
+	{
+		Test_Publishing=TRUE;
+		Test_Publish();
+		Test_Publishing=FALSE;
+		Publishes++;
+	}
+	Test_Interrupts(NULL,0);
+
+	TEST_CHECK(Test_Counts.Reads>0U);
+	TEST_CHECK(Test_Counts.Overlaps>0U);
+	TEST_CHECK(Test_Counts.Torn==0U);
+	TEST_CHECK(Test_Counts.Backwards==0U);
+	printf("  %u publishes, %u reads from interrupts, %u inside a publish\n",Publishes,Test_Counts.Reads,Test_Counts.Overlaps);
+}
+
+// Two scans per interrupt, the second one reuses the buffer being read
+static void Test_Writer_Handler(int Signal)
+{
+	(void)Signal;
+	Test_Counts.Overlaps+=(Test_Reading==TRUE) ? 1U : 0U;
+	Test_Publish();
+	Test_Publish();
+}
+
+// The worst case for the reader: publishes land in the middle of its copy.
+// Copies without the sequence check get torn, Snapshot_Read copies again.
+static void Test_Writer_Interrupts_Reader(void)
+{
+	Measurement_Snapshot_TypeDef Snapshot;
+	struct timespec Start;
+
+	Test_Start();
+	clock_gettime(CLOCK_MONOTONIC,&Start);
+	Test_Interrupts(Test_Writer_Handler,TEST_INTERRUPT_US);
+	while(Test_Elapsed(&Start,TEST_PHASE_MS)==FALSE)
+	{
+		Test_Reading=TRUE;
+		Test_Unprotected_Read(&Snapshot);
+		Test_Reading=FALSE;
+		Test_Counts.Unprotected_Torn+=(Test_Consistent(&Snapshot)==TRUE) ? 0U : 1U;
+
+		Test_Reading=TRUE;
+		Snapshot_Read(&Test_Unit,&Snapshot);
+		Test_Reading=FALSE;
+		Test_Check_Read(&Test_Counts,&Snapshot);
+	}
+	Test_Interrupts(NULL,0);
+
+	TEST_CHECK(Test_Counts.Reads>0U);
+	TEST_CHECK(Test_Counts.Overlaps>0U);
+	TEST_CHECK(Test_Counts.Unprotected_Torn>0U);
+	TEST_CHECK(Test_Counts.Torn==0U);
+	TEST_CHECK(Test_Counts.Backwards==0U);
+	printf("  %u reads, %u publishes inside a read, %u copies torn without the sequence check\n",
+		Test_Counts.Reads,Test_Counts.Overlaps,Test_Counts.Unprotected_Torn);
+}
+
+static void* Test_Reader_Thread(void* Argument)
+{
+	Test_Counts_TypeDef* Counts=(Test_Counts_TypeDef*)Argument;
+	Measurement_Snapshot_TypeDef Snapshot;
+
+	while(Test_Stop==FALSE)
+	{
+		Snapshot_Read(&Test_Unit,&Snapshot);
+		Test_Check_Read(Counts,&Snapshot);
+	}
+	return NULL;
+}
+
+// Readers on the other cores of the host, against a writer that never stops
+static void Test_Concurrent_Threads(void)
+{
+	static Test_Counts_TypeDef Counts[TEST_READERS];
+	pthread_t Reader[TEST_READERS];
+	struct timespec Start;
+	uint32_t Publishes=0;
+	uint32_t Reads=0;
+	uint32_t Torn=0;
+	uint32_t Backwards=0;
+
+	Test_Start();
+	memset(Counts,0,sizeof(Counts));
+	for(uint8_t i=0; i<TEST_READERS; i++)
+	{
+		TEST_CHECK(pthread_create(&Reader[i],NULL,Test_Reader_Thread,&Counts[i])==0);
+	}
+	clock_gettime(CLOCK_MONOTONIC,&Start);
+	while(Test_Elapsed(&Start,TEST_PHASE_MS)==FALSE)
+	{
+		Test_Publish();
+		Publishes++;
+	}
+	Test_Stop=TRUE;
+	for(uint8_t i=0; i<TEST_READERS; i++)
+	{
+		pthread_join(Reader[i],NULL);
+		Reads+=Counts[i].Reads;
+		Torn+=Counts[i].Torn;
+		Backwards+=Counts[i].Backwards;
+	}
+
+	TEST_CHECK(Reads>0U);
+	TEST_CHECK(Torn==0U);
+	TEST_CHECK(Backwards==0U);
+	printf("  %u publishes, %u reads on %u threads, %ld cores\n",Publishes,Reads,TEST_READERS,sysconf(_SC_NPROCESSORS_ONLN));
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_Reader_Interrupts_Writer);
+	TEST_RUN(Test_Writer_Interrupts_Reader);
+	TEST_RUN(Test_Concurrent_Threads);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_Snapshot.c
+  * @brief          : Stress of the measurement snapshot under interrupts and threads
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
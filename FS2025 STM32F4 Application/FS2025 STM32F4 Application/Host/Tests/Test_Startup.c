@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file           : Test_Startup.c
+  * @brief          : Startup sequencer and recovery without LTC6811 on the buses
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+// Both buses read 0xFF, every register read fails its PEC
+static void Test_Startup_Timeout(void)
+{
+	Host_CAN_Frame_TypeDef Frame;
+
+	Test_Boot();
+	TEST_CHECK(CONTROL_UNIT.State==INIT);
+
+	Host_Run_ms(BPCU_STARTUP_TIMEOUT_MS-10);
+	TEST_CHECK(CONTROL_UNIT.State==INIT);
+	TEST_CHECK(CONTROL_UNIT.Startup.Attempts>1U);
+	TEST_CHECK(Host_CAN1_Take(&Frame)==FALSE);
+
+	// Gives up once, tells it on the bus and starts the recovery
+	Host_Run_ms(20);
+	TEST_CHECK(CONTROL_UNIT.State==LTC6811_FAIL_MODE);
+	TEST_CHECK(CONTROL_UNIT.Startup.Timed_Out==TRUE);
+	TEST_CHECK(Test_CAN1_Find(BPCU_STARTUP_DIAG_DEF,&Frame)==TRUE);
+	TEST_CHECK(Frame.Tick>=BPCU_STARTUP_TIMEOUT_MS && Frame.Tick<=BPCU_STARTUP_TIMEOUT_MS+2U);
+	// Each pass costs 1 ms plus the chip select guards, the watchdog is fed on all
+	TEST_CHECK(Host_Get_Statistics()->WDT_Refreshes>=BPCU_STARTUP_TIMEOUT_MS/2U);
+	TEST_CHECK(Host_Halted()==FALSE);
+}
+
+static void Test_Recovery_Backoff(void)
+{
+	const uint8_t Measure=0x01;
+	uint32_t Attempts=CONTROL_UNIT.Recovery.Attempts;
+
+	// One attempt per backoff period, and the scan requests are counted as missed
+	Host_Run_ms(10*BPCU_RECOVERY_BACKOFF_MS);
+	TEST_CHECK(CONTROL_UNIT.State==LTC6811_FAIL_MODE);
+	TEST_CHECK(CONTROL_UNIT.Recovery.Attempts-Attempts>=8U);
+	TEST_CHECK(CONTROL_UNIT.Recovery.Attempts-Attempts<=10U);
+
+	uint32_t Missed=CONTROL_UNIT.Recovery.Missed_Scans;
+	Host_CAN1_Inject(BPCU_INIT_MEASURE_DEF,1,&Measure);
+	TEST_CHECK(CONTROL_UNIT.Recovery.Missed_Scans==Missed+1U);
+}
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_Startup_Timeout);
+	TEST_RUN(Test_Recovery_Backoff);
+	return TEST_RESULT();
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_Startup.c
+  * @brief          : Startup sequencer and recovery without LTC6811 on the buses
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
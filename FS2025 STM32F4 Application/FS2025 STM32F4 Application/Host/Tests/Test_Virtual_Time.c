@@ -0,0 +1,219 @@
+/**
+  ******************************************************************************
+  * @file           : Test_Virtual_Time.c
+  * @brief          : Virtual clock and reproducible long scenarios
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Test.h"
+#include <time.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Scenario                      ***************	
+********************************************************************************
+*******************************************************************************/
+#define SCENARIO_MINUTES			10U
+#define SCENARIO_MEASURE_MS		100U
+
+// FNV-1a over every frame sent and the state at the end of the run
+static uint32_t Scenario_Hash(uint32_t Hash, const void* Data, uint32_t Length)
+{
+	const uint8_t* Bytes=(const uint8_t*)Data;
+
+	for(uint32_t i=0; i<Length; i++)
+	{
+		Hash^=Bytes[i];
+		Hash*=16777619U;
+	}
+	return Hash;
+}
+
+// A master asking for a scan every 100 ms to a unit without LTC6811
+static uint32_t Scenario_Run(uint32_t* Frames)
+{
+	const uint8_t Measure=0x01;
+	Host_CAN_Frame_TypeDef Frame;
+	uint32_t Hash=2166136261U;
+
+	Test_Boot();
+	*Frames=0;
+	for(uint32_t Time=0; Time<SCENARIO_MINUTES*60000U; Time+=SCENARIO_MEASURE_MS)
+	{
+		Host_CAN1_Inject(BPCU_INIT_MEASURE_DEF,1,&Measure);
+		// The master keeps its own schedule, a pass ending late does not shift it
+		Host_Run_ms(Time+SCENARIO_MEASURE_MS-MCU_Get_Tick());
+		while(Host_CAN1_Take(&Frame)==TRUE)
+		{
+			Hash=Scenario_Hash(Hash,&Frame.Id,sizeof(Frame.Id));
+			Hash=Scenario_Hash(Hash,&Frame.Tick,sizeof(Frame.Tick));
+			Hash=Scenario_Hash(Hash,Frame.Data,Frame.DLC);
+			(*Frames)++;
+		}
+	}
+	uint32_t End[3]={CONTROL_UNIT.State, CONTROL_UNIT.Recovery.Attempts, CONTROL_UNIT.Recovery.Missed_Scans};
+	Hash=Scenario_Hash(Hash,End,sizeof(End));
+	return Hash;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Tests                         ***************	
+********************************************************************************
+*******************************************************************************/
+// The tick, TIM7 and the CAN mailboxes only move on the ms boundaries
+static void Test_Step_Resolution(void)
+{
+	Test_Boot();
+	Profiler_Reset(PROFILER_TIM7_IRQ);
+
+	for(uint32_t i=0; i<3U; i++)
+	{
+		Host_Step_us(250);
+	}
+	TEST_CHECK(MCU_Get_Tick()==0U);
+	TEST_CHECK(Host_Get_Time_us()==750U);
+	TEST_CHECK(Profiler_Get(PROFILER_TIM7_IRQ)->Count==0U);
+
+	Host_Step_us(250);
+	TEST_CHECK(MCU_Get_Tick()==1U);
+	TEST_CHECK(Profiler_Get(PROFILER_TIM7_IRQ)->Count==1U);
+
+	// A long step still serves every ms on its way
+	Host_Step_us(2500000U);
+	TEST_CHECK(MCU_Get_Tick()==2501U);
+	TEST_CHECK(Profiler_Get(PROFILER_TIM7_IRQ)->Count==2501U);
+}
+
+// The us delays move the clock, the DWT follows the HCLK of each moment
+static void Test_Delays_And_Cycles(void)
+{
+	Test_Boot();
+	MCU_Clock_Low_Power();
+
+	uint32_t Start=MCU_Cycle_Counter_Get();
+	MCU_Delay_us(10);
+	TEST_CHECK(MCU_Cycle_Counter_Get()-Start==10U*HOST_LOW_POWER_HCLK_MHZ);
+	TEST_CHECK(Host_Get_Time_us()==10U);
+
+	MCU_Clock_High_Speed();
+	Start=MCU_Cycle_Counter_Get();
+	MCU_Delay_us(10);
+	TEST_CHECK(MCU_Cycle_Counter_Get()-Start==10U*HOST_HIGH_SPEED_HCLK_MHZ);
+
+	// HAL_Delay from the middle of a ms: one more tick, up to its boundary
+	MCU_Delay(3);
+	TEST_CHECK(MCU_Get_Tick()==4U);
+	TEST_CHECK(Host_Get_Time_us()==4000U);
+	MCU_Delay(0);
+	TEST_CHECK(Host_Get_Time_us()==5000U);
+}
+
+// The main loop passes cost their delays plus the configured pass time
+static void Test_Main_Pass_Cost(void)
+{
+	Test_Boot();
+	Profiler_Reset(PROFILER_MAIN_TASK);
+	Host_Set_Main_Pass_us(100);
+	Host_Run_ms(100);
+	uint32_t Fast=Profiler_Get(PROFILER_MAIN_TASK)->Count;
+
+	Profiler_Reset(PROFILER_MAIN_TASK);
+	Host_Set_Main_Pass_us(HOST_MAIN_PASS_US);
+	Host_Run_ms(100);
+	uint32_t Slow=Profiler_Get(PROFILER_MAIN_TASK)->Count;
+
+	TEST_CHECK(Slow>0U && Slow<=100U);
+	TEST_CHECK(Fast>Slow*5U);
+	TEST_CHECK(MCU_Get_Tick()==200U);
+}
+
+// Minutes of operation in a fraction of a second, the same result every run
+static void Test_Scenario_Reproducible(void)
+{
+	uint32_t Frames[2];
+	uint32_t Hash[2];
+
+	clock_t Start=clock();
+	Hash[0]=Scenario_Run(&Frames[0]);
+	double Elapsed=(double)(clock()-Start)*1000.0/CLOCKS_PER_SEC;
+	TEST_CHECK(MCU_Get_Tick()-SCENARIO_MINUTES*60000U<10U);
+	TEST_CHECK(CONTROL_UNIT.State==LTC6811_FAIL_MODE);
+	// One recovery every backoff period and every scan request after INIT missed
+	TEST_CHECK(CONTROL_UNIT.Recovery.Attempts>=SCENARIO_MINUTES*60000U/BPCU_RECOVERY_BACKOFF_MS*95U/100U);
+	TEST_CHECK(CONTROL_UNIT.Recovery.Attempts<=SCENARIO_MINUTES*60000U/BPCU_RECOVERY_BACKOFF_MS);
+	TEST_CHECK(CONTROL_UNIT.Recovery.Missed_Scans>=(SCENARIO_MINUTES*60000U-BPCU_STARTUP_TIMEOUT_MS)/SCENARIO_MEASURE_MS-1U);
+	TEST_CHECK(Host_Halted()==FALSE);
+	TEST_CHECK(Host_Get_Statistics()->CAN1_Tx_Log_Lost==0U);
+
+	Hash[1]=Scenario_Run(&Frames[1]);
+	TEST_CHECK(Frames[0]>0U && Frames[0]==Frames[1]);
+	TEST_CHECK(Hash[0]==Hash[1]);
+	printf("%u min of virtual time in %.0f ms, %u frames, hash %08X\n",
+		SCENARIO_MINUTES, Elapsed, (unsigned int)Frames[0], (unsigned int)Hash[0]);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(void)
+{
+	TEST_RUN(Test_Step_Resolution);
+	TEST_RUN(Test_Delays_And_Cycles);
+	TEST_RUN(Test_Main_Pass_Cost);
+	TEST_RUN(Test_Scenario_Reproducible);
+	return TEST_RESULT();
+}
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Test_Virtual_Time.c
+  * @brief          : Virtual clock and reproducible long scenarios
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,163 @@
+/**
+  ******************************************************************************
+  * @file           : Capture_Replay.c
+  * @brief          : Replays a capture dump through the firmware and times it
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include "Capture_Replayer.h"
+#include "Filter_Comparison.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Setup                         ***************	
+********************************************************************************
+*******************************************************************************/
+// A dump of the on-target ring is CAPTURE_RECORDS long, host captures more
+#define CAPTURE_REPLAY_RECORDS		65536U
+// Scans of the filter comparison, far more than such a capture holds
+#define CAPTURE_REPLAY_SCANS			16384U
+
+static Capture_Record_TypeDef Capture_Replay_Input[CAPTURE_REPLAY_RECORDS];
+static Capture_Record_TypeDef Capture_Replay_Output[CAPTURE_REPLAY_RECORDS];
+static Capture_Replayer_TypeDef Capture_Replay;
+static float Capture_Replay_Readings[CAPTURE_REPLAY_SCANS][BPCU_CHANNELS];
+static Filter_Comparison_TypeDef Capture_Replay_Filters;
+
+static const char* const Capture_Replay_States[]=
+{
+	"INIT", "NORMAL_OPERATION", "LTC6811_FAIL_MODE", "TEMP_FAIL_MODE", "TEMP_PLUS_60_FAIL_MODE"
+};
+
+static const char* const Capture_Replay_Filter_Names[FILTER_TYPES]=
+{
+	"DEFAULT", "IIR", "MEDIAN", "KALMAN", "RAW"
+};
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Main                          ***************	
+********************************************************************************
+*******************************************************************************/
+int main(int argc, char** argv)
+{
+	if(argc<2 || argc>4)
+	{
+		printf("Capture_Replay CAPTURE [TIME_MS [REPLAY_CAPTURE]]\n");
+		printf("  Boots the unit with the capture as its chips and bus and runs it for the\n");
+		printf("  time (up to the last record by default). The capture of the replay can be\n");
+		printf("  saved in the same format to compare it. Every filter type is then run on\n");
+		printf("  the temperatures the unit read, with its settings, to compare them.\n");
+		return 2;
+	}
+
+	uint32_t Count=Capture_Replayer_Load(argv[1],Capture_Replay_Input,CAPTURE_REPLAY_RECORDS);
+	if(Count==0U)
+	{
+		printf("%s: no records\n",argv[1]);
+		return 2;
+	}
+	uint32_t Time_ms=(argc>2) ? (uint32_t)strtoul(argv[2],NULL,0) : Capture_Replayer_Duration_ms(Capture_Replay_Input,Count);
+
+	Capture_Replayer_Init(&Capture_Replay,Capture_Replay_Input,Count,Capture_Replay_Output,CAPTURE_REPLAY_RECORDS);
+	Capture_Replayer_Trace_Readings(&Capture_Replay.Trace,Capture_Replay_Readings,CAPTURE_REPLAY_SCANS);
+	Capture_Replayer_Run(&Capture_Replay,Time_ms);
+
+	const Capture_Replayer_Trace_TypeDef* Trace=&Capture_Replay.Trace;
+	for(uint32_t i=0; i<Trace->Steps && i<CAPTURE_REPLAYER_STEPS; i++)
+	{
+		const Capture_Replayer_Step_TypeDef* Step=&Trace->Step[i];
+
+		printf("%8u ms  %-24s hot 0x%06X  failed 0x%06X\n",Step->Tick,
+			(Step->State<sizeof(Capture_Replay_States)/sizeof(Capture_Replay_States[0])) ? Capture_Replay_States[Step->State] : "?",
+			Step->Hot,Step->Failed);
+	}
+
+	const Capture_Replayer_Statistics_TypeDef* Statistics=&Capture_Replay.Statistics;
+	printf("%u records, %u SPI matched, %u skipped, %u unmatched, %u failed transfers replayed as good, %u CAN frames injected\n",
+		Count,Statistics->Matched,Statistics->Skipped,Statistics->Unmatched,Statistics->Failed_Transfers,Statistics->CAN_Injected);
+	if(Capture_Replay.Diverged_At==CAPTURE_REPLAYER_NONE)
+	{
+		printf("replay matches the capture\n");
+	}
+	else
+	{
+		const Capture_Record_TypeDef* Record=&Capture_Replay_Input[Capture_Replay.Diverged_At];
+		printf("replay diverges at record %u: %u ms, source %u, id 0x%04X\n",Capture_Replay.Diverged_At,Record->Timestamp,
+			Record->Source,Record->Id);
+	}
+	printf("%u virtual ms, %u passes in %.1f ms, digest %016llX\n",Time_ms,Trace->Passes,Capture_Replay.Wall_ms,
+		(unsigned long long)Trace->Digest);
+
+	// Filters of the enabled channels, on the readings of the replay
+	Filter_Comparison_Run(&CONTROL_UNIT.Filter_Engine,(const float (*)[BPCU_CHANNELS])Capture_Replay_Readings,Trace->Reading_Count,
+		~CONTROL_UNIT.Status.Temperatures.Disabled,&Capture_Replay_Filters);
+	printf("%u scans of %u channels%s\n",Capture_Replay_Filters.Scans,Capture_Replay_Filters.Channels,
+		(Trace->Readings_Lost>0U) ? ", the last ones left out" : "");
+	printf("  filter    latency (scans)  noise (mdegC/scan)\n");
+	for(uint8_t Type=0; Type<FILTER_TYPES; Type++)
+	{
+		printf("  %-8s  %15u  %18.1f\n",Capture_Replay_Filter_Names[Type],Capture_Replay_Filters.Latency[Type],
+			Capture_Replay_Filters.Noise[Type]);
+	}
+
+	if(argc>3 && Capture_Replayer_Save(argv[3],Trace->Records,Trace->Record_Count)==FALSE)
+	{
+		printf("%s: not written\n",argv[3]);
+		return 2;
+	}
+	return (Capture_Replay.Diverged_At==CAPTURE_REPLAYER_NONE) ? 0 : 1;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Capture_Replay.c
+  * @brief          : Replays a capture dump through the firmware and times it
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,355 @@
+/**
+  ******************************************************************************
+  * @file           : Balancing.c
+  * @brief          : Passive cell balancing controller
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Balancing.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Balancing Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Balancing_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	memset(&Control_Unit->Balancing, 0, sizeof(Balancing_TypeDef));
+	Control_Unit->Balancing.Step=BALANCING_IDLE;
+	Control_Unit->Balancing.Enabled=FALSE;
+	Control_Unit->Balancing.Threshold=BALANCING_DEFAULT_THRESHOLD;
+	Control_Unit->Balancing.Min_Voltage=BALANCING_DEFAULT_MIN_VOLTAGE;
+	Control_Unit->Balancing.Last_Sequence=Control_Unit->Snapshot.Sequence;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Balancing Command      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Called from the deferred CAN dispatch (Control_Unit_Deferred_Task),
+ * the controller applies it after the next scan.
+ */
+void Balancing_Command(Control_Unit_TypeDef* Control_Unit)
+{
+	const uint8_t* Data=Control_Unit->Rx_Message.Data;
+
+	if(Control_Unit->Rx_Message.Header.DLC!=8 || Data[0]>0x01)
+	{
+		return;
+	}
+
+	uint16_t Threshold=(uint16_t)(Data[1] | (Data[2]<<8));
+	uint16_t Min_Voltage=(uint16_t)(Data[3] | (Data[4]<<8));
+
+	if(Threshold!=0)
+	{
+		Control_Unit->Balancing.Threshold=Threshold*BALANCING_COMMAND_LSB;
+	}
+	if(Min_Voltage!=0)
+	{
+		Control_Unit->Balancing.Min_Voltage=Min_Voltage*BALANCING_COMMAND_LSB;
+	}
+	Control_Unit->Balancing.Enabled=(Data[0]==0x01) ? TRUE : FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Balancing Pause      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Called when a measurement starts: its phases overwrite the discharge
+ * switches, so the discharge ends here and the time is added to each cell.
+ */
+void Balancing_Pause(Control_Unit_TypeDef* Control_Unit)
+{
+	Balancing_TypeDef* Balancing=&Control_Unit->Balancing;
+
+	if(Balancing->Step==BALANCING_ON)
+	{
+		uint32_t Elapsed=MCU_Get_Tick()-Balancing->Step_Tick;
+		if(Elapsed>BALANCING_TIMEOUT_MS)
+		{
+			Elapsed=BALANCING_TIMEOUT_MS;
+		}
+		for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+		{
+			if(Balancing->Active & (1UL<<i))
+			{
+				Balancing->Discharge_Time[i]+=Elapsed;
+			}
+		}
+	}
+	Balancing->Active=0;
+	Balancing->Step=BALANCING_IDLE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Cell Selection      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Picks the cells over the lowest one by more than the threshold. A
+ * cell discharging in the last round goes on down to Threshold-Hysteresis.
+ * Resistors over the temperature limit, or without a working sensor, are left
+ * out until they cool below the release temperature.
+ *
+ * Cells with a suspect sense wire, not stored by the scan or read out of the
+ * plausible range are neither the lowest cell nor a target, and an open wire
+ * stops the balancing: a bad reading would discharge every other cell.
+ */
+static uint32_t Balancing_Select(Control_Unit_TypeDef* Control_Unit, const Measurement_Snapshot_TypeDef* Snapshot, uint32_t Previous)
+{
+	Balancing_TypeDef* Balancing=&Control_Unit->Balancing;
+	uint32_t No_Sensor=Control_Unit->Status.Temperatures.Disabled | Control_Unit->Status.Temperatures.Failed;
+	uint32_t Excluded=Control_Unit->Open_Wire.Suspect | Snapshot->Voltages_Stale;
+	float Min=BALANCING_CELL_VOLTAGE_MAX;
+	uint32_t Target=0;
+
+	if(Control_Unit->Open_Wire.Open!=0)
+	{
+		return 0;
+	}
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		if(Snapshot->Voltages[i]<BALANCING_CELL_VOLTAGE_MIN || Snapshot->Voltages[i]>BALANCING_CELL_VOLTAGE_MAX)
+		{
+			Excluded|=1UL<<i;
+		}
+		else if((Excluded & (1UL<<i))==0 && Snapshot->Voltages[i]<Min)
+		{
+			Min=Snapshot->Voltages[i];
+		}
+	}
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		uint32_t Bit=1UL<<i;
+		float Temperature=Snapshot->Temperatures[i];
+
+		if((No_Sensor & Bit) || Temperature>=BALANCING_TEMPERATURE_LIMIT)
+		{
+			Balancing->Inhibited|=Bit;
+		}
+		else if(Temperature<BALANCING_TEMPERATURE_RELEASE)
+		{
+			Balancing->Inhibited&=~Bit;
+		}
+
+		float Start=Min+((Previous & Bit) ? Balancing->Threshold-BALANCING_HYSTERESIS : Balancing->Threshold);
+		if((Balancing->Inhibited & Bit)==0 && (Excluded & Bit)==0 &&
+			 Snapshot->Voltages[i]>Start && Snapshot->Voltages[i]>=Balancing->Min_Voltage)
+		{
+			Target|=Bit;
+		}
+	}
+	return Target;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Status Message      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+static void Balancing_Send(Control_Unit_TypeDef* Control_Unit, uint8_t Page)
+{
+	Balancing_TypeDef* Balancing=&Control_Unit->Balancing;
+
+	Control_Unit->Tx_Message.ID=BPCU_BALANCING_DEF;
+	Control_Unit->Tx_Message.DLC=8;
+	Control_Unit->Tx_Message.Data[0]=Page;
+
+	if(Page==BALANCING_PAGE_STATE)
+	{
+		for(uint8_t i=0; i<3; i++)
+		{
+			Control_Unit->Tx_Message.Data[1+i]=(uint8_t)(Balancing->Active>>(8*i));
+			Control_Unit->Tx_Message.Data[4+i]=(uint8_t)(Balancing->Inhibited>>(8*i));
+		}
+		Control_Unit->Tx_Message.Data[7]=(Balancing->Enabled==TRUE ? BALANCING_FLAG_ENABLED : 0) |
+			(Balancing->Write_Errors!=0 ? BALANCING_FLAG_WRITE_ERROR : 0);
+	}
+	else
+	{
+		for(uint8_t i=0; i<3; i++)
+		{
+			uint32_t Seconds=Balancing->Discharge_Time[3*(Page-1)+i]/1000;
+			uint16_t Time=(Seconds>0xFFFF) ? 0xFFFF : (uint16_t)Seconds;
+			Control_Unit->Tx_Message.Data[1+2*i]=(uint8_t)Time;
+			Control_Unit->Tx_Message.Data[2+2*i]=(uint8_t)(Time>>8);
+		}
+		Control_Unit->Tx_Message.Data[7]=0;
+	}
+	CAN1_Send(&Control_Unit->Tx_Message);
+}
+
+/**
+ * @brief State frame and the next page of discharge times, once per scan.
+ * Only marks them, Balancing_Report_Task sends them on the following passes.
+ */
+static void Balancing_Report(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->State==INIT)
+	{
+		return;
+	}
+	Control_Unit->Balancing.Reports_Pending=BALANCING_REPORT_STATE | BALANCING_REPORT_TIME;
+}
+
+/**
+ * @brief Sends at most one pending report frame per call.
+ */
+static void Balancing_Report_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	Balancing_TypeDef* Balancing=&Control_Unit->Balancing;
+
+	if(Balancing->Reports_Pending & BALANCING_REPORT_STATE)
+	{
+		Balancing->Reports_Pending&=~BALANCING_REPORT_STATE;
+		Balancing_Send(Control_Unit,BALANCING_PAGE_STATE);
+	}
+	else if(Balancing->Reports_Pending & BALANCING_REPORT_TIME)
+	{
+		Balancing->Reports_Pending&=~BALANCING_REPORT_TIME;
+		Balancing_Send(Control_Unit,1+Balancing->Time_Page);
+		Balancing->Time_Page=(Balancing->Time_Page+1)%BALANCING_TIME_PAGES;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Balancing Task      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Runs between measurements. After every scan the cells are selected
+ * again and written to both chips once the isoSPI ports are awake, then the
+ * state is reported. Leaving the normal operation or disabling writes an
+ * empty selection.
+ */
+void Balancing_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	Balancing_TypeDef* Balancing=&Control_Unit->Balancing;
+	uint32_t Now=MCU_Get_Tick();
+
+	// The report frames leave before the task acts, on the pass after the write
+	Balancing_Report_Task(Control_Unit);
+
+	// The open wire sequence and the self-test own the chips until they end
+	if(Control_Unit->Status.Read_Temperatures!=IDLE || Control_Unit->Open_Wire.Step!=OPEN_WIRE_IDLE ||
+		 Control_Unit->Self_Test.Step!=SELF_TEST_IDLE)
+	{
+		return;
+	}
+
+	if(Balancing->Last_Sequence!=Control_Unit->Snapshot.Sequence)
+	{
+		Measurement_Snapshot_TypeDef Snapshot;
+		uint32_t Previous=Balancing->Target;
+
+		Snapshot_Read(Control_Unit,&Snapshot);
+		Balancing->Last_Sequence=Control_Unit->Snapshot.Sequence;
+		Balancing->Target=0;
+		if(Balancing->Enabled==TRUE && Control_Unit->State==NORMAL_OPERATION)
+		{
+			Balancing->Target=Balancing_Select(Control_Unit,&Snapshot,Previous);
+		}
+		if(Balancing->Target!=0)
+		{
+			Balancing->Step=BALANCING_WAKE;
+		}
+		else
+		{
+			Balancing->Step=BALANCING_IDLE;
+			Balancing_Report(Control_Unit);
+		}
+	}
+	else if(Balancing->Step==BALANCING_ON && (Balancing->Enabled==FALSE || Control_Unit->State!=NORMAL_OPERATION))
+	{
+		Balancing_Pause(Control_Unit);
+		Balancing->Target=0;
+		Balancing->Step=BALANCING_WAKE;
+	}
+
+	switch(Balancing->Step)
+	{
+		case BALANCING_WAKE:
+			LTC6811_Wake_Up_Pulse(&Control_Unit->Status.LTC6811_1);
+			LTC6811_Wake_Up_Pulse(&Control_Unit->Status.LTC6811_2);
+			Balancing->Step_Tick=Now;
+			Balancing->Step=BALANCING_WRITE;
+		break;
+
+		case BALANCING_WRITE:
+			if(Now-Balancing->Step_Tick<LTC6811_WAKE_TIME_MS)
+			{
+				break;
+			}
+			if(LTC6811_Write_Discharge(&Control_Unit->Status.LTC6811_1,(uint16_t)(Balancing->Target & 0xFFF),BALANCING_TIMEOUT)==FALSE ||
+				 LTC6811_Write_Discharge(&Control_Unit->Status.LTC6811_2,(uint16_t)(Balancing->Target>>12),BALANCING_TIMEOUT)==FALSE)
+			{
+				// The timeout stops whatever was written, the next scan tries again
+				Balancing->Write_Errors++;
+			}
+			Balancing->Active=Balancing->Target;
+			Balancing->Step_Tick=Now;
+			Balancing->Step=(Balancing->Target!=0) ? BALANCING_ON : BALANCING_IDLE;
+			Balancing_Report(Control_Unit);
+		break;
+
+		default:
+		break;
+	}
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Balancing.c
+  * @brief          : Passive cell balancing controller
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file           : Balancing.h
+  * @brief          : Passive cell balancing controller header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef BALANCING_H
+#define BALANCING_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "Can_Bus.h"
+#include "LTC6811.h"
+#include "Snapshot.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Limits      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+#define BALANCING_DEFAULT_THRESHOLD		0.010f	//V over the lowest cell to start
+#define BALANCING_HYSTERESIS					0.005f	//V, a discharging cell stops at Threshold-Hysteresis
+#define BALANCING_DEFAULT_MIN_VOLTAGE	3.300f	//V
+
+// Readings out of this range are taken as a bad measurement, not as a cell
+#define BALANCING_CELL_VOLTAGE_MIN		2.500f	//V
+#define BALANCING_CELL_VOLTAGE_MAX		4.300f	//V
+
+// Discharge resistor limit, read on the sensor of the same channel
+#define BALANCING_TEMPERATURE_LIMIT		50.0f		//degC, stops the discharge
+#define BALANCING_TEMPERATURE_RELEASE	45.0f		//degC, allows it again
+
+// The chip ends the discharge alone if no scan rewrites it meanwhile
+#define BALANCING_TIMEOUT							LTC6811_DCTO_30S
+#define BALANCING_TIMEOUT_MS					30000
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Frames      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// Command (BPCU_BALANCING_COMMAND_DEF): 0 Enable (0x01) or disable (0x00),
+// 1..2 Threshold and 3..4 Minimum voltage (100 uV, 0 keeps the current one)
+#define BALANCING_COMMAND_LSB					0.0001f	//V
+
+// Status (BPCU_BALANCING_DEF), Data[0] page: 0 Discharging cells 1..3,
+// Inhibited cells 4..6, Flags 7. 1..8 Discharge time (s) of three cells from
+// 3*(page-1), two bytes each. Masks and times little endian
+#define BALANCING_PAGE_STATE					0
+#define BALANCING_TIME_PAGES					(BPCU_CHANNELS/3)
+#define BALANCING_FLAG_ENABLED				0x01
+#define BALANCING_FLAG_WRITE_ERROR		0x02
+
+// A report is the state frame and the next time page, one per main loop pass
+#define BALANCING_REPORT_STATE				0x01
+#define BALANCING_REPORT_TIME					0x02
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Balancing_Init(Control_Unit_TypeDef* Control_Unit);
+void Balancing_Command(Control_Unit_TypeDef* Control_Unit);
+void Balancing_Pause(Control_Unit_TypeDef* Control_Unit);
+void Balancing_Task(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Balancing.h
+  * @brief          : Passive cell balancing controller header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
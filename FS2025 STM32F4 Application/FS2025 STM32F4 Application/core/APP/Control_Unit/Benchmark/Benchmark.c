@@ -0,0 +1,244 @@
+/**
+  ******************************************************************************
+  * @file           : Benchmark.c
+  * @brief          : On-target micro-benchmarks
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Benchmark.h"
+#include "Battery_Pack_Control_Unit.h"
+
+/*******************************************************************************
+********************************************************************************
+***************									Benchmark Data      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+static Benchmark_Result_TypeDef Benchmark_Results[BENCHMARK_KERNELS];
+
+// The status checks run on a copy of the status alone, so the live fail
+// counters are not touched and the control unit is not duplicated
+static Control_Unit_Status_Typdef Benchmark_Status;
+
+// Results are stored here so the compiler cannot drop the timed calls
+static volatile uint32_t Benchmark_Sink;
+
+// Cycles read by two back to back counter reads, removed from every sample
+static uint32_t Benchmark_Overhead;
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Benchmark Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Benchmark_Init(void)
+{
+	memset(Benchmark_Results, 0, sizeof(Benchmark_Results));
+
+	uint32_t Start=MCU_Cycle_Counter_Get();
+	Benchmark_Overhead=MCU_Cycle_Counter_Get()-Start;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Benchmark Kernel      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Times one call of the kernel. Run selects the input, so the inputs
+ * sweep the whole range of the data dependent kernels over a run.
+ */
+static uint32_t Benchmark_Kernel(Control_Unit_TypeDef* Control_Unit, Benchmark_Kernel_TypeDef Kernel, uint8_t Run)
+{
+	uint8_t Register[LTC6811_REG_GROUP_SIZE];
+	float Values[BPCU_CHANNELS];
+	uint32_t Samples[CHANNEL_FILTER_PAIRS];
+	uint32_t State[CHANNEL_FILTER_PAIRS];
+	uint32_t Alpha[CHANNEL_FILTER_PAIRS];
+	float Input=(float)Run/(float)BENCHMARK_RUNS;
+	Control_Unit_State_Typdef Fail_State;
+	uint32_t Start;
+	uint32_t Stop;
+
+	switch(Kernel)
+	{
+		case BENCHMARK_PEC15:
+			for(uint8_t i=0; i<LTC6811_REG_GROUP_SIZE; i++)
+			{
+				Register[i]=(uint8_t)(Run*LTC6811_REG_GROUP_SIZE+i);
+			}
+			Start=MCU_Cycle_Counter_Get();
+			Benchmark_Sink=LTC6811_PEC15_Calc(Register, LTC6811_REG_GROUP_SIZE);
+			Stop=MCU_Cycle_Counter_Get();
+		break;
+
+		case BENCHMARK_VOLTAGE_TO_TEMPERATURE:
+			Start=MCU_Cycle_Counter_Get();
+			Benchmark_Sink=(uint32_t)LTC_Voltage_to_Temperature(3.0f*Input);
+			Stop=MCU_Cycle_Counter_Get();
+		break;
+
+		case BENCHMARK_ENCODE_TEMP:
+			Start=MCU_Cycle_Counter_Get();
+			Benchmark_Sink=LTC6811_Enconde_Temp(-30.0f+150.0f*Input);
+			Stop=MCU_Cycle_Counter_Get();
+		break;
+
+		case BENCHMARK_ENCODE_VOLT:
+			Start=MCU_Cycle_Counter_Get();
+			Benchmark_Sink=LTC6811_Encode_Volt_10mV(1.5f+3.5f*Input);
+			Stop=MCU_Cycle_Counter_Get();
+		break;
+
+		case BENCHMARK_CHECK_TEMPERATURES:
+			// Limits of every enabled channel. The filter engine pass would need
+			// a copy of its history, the host suite times the whole check.
+			Benchmark_Status.Temperatures=Control_Unit->Status.Temperatures;
+			Start=MCU_Cycle_Counter_Get();
+			Battery_Pack_Control_Unit_Check_Limits(&Benchmark_Status.Temperatures, ~Benchmark_Status.Temperatures.Disabled & BPCU_CHANNEL_MASK);
+			Stop=MCU_Cycle_Counter_Get();
+		break;
+
+		case BENCHMARK_CHECK_FAILS:
+			Benchmark_Status.Temperatures=Control_Unit->Status.Temperatures;
+			Fail_State=Control_Unit->State;
+			Start=MCU_Cycle_Counter_Get();
+			Battery_Pack_Control_Count_Fails(&Benchmark_Status, &Fail_State);
+			Stop=MCU_Cycle_Counter_Get();
+			Benchmark_Sink=Fail_State;
+		break;
+
+		case BENCHMARK_CHANNEL_FILTER:
+		case BENCHMARK_CHANNEL_FILTER_PORTABLE:
+			// The state starts Run degC over the last readings
+			for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+			{
+				Values[i]=Control_Unit->Status.Temperatures.Readed_Value[i]+(float)Run;
+			}
+			Channel_Filter_Pack(Control_Unit->Status.Temperatures.Readed_Value, Samples, CHANNEL_FILTER_PAIRS);
+			Channel_Filter_Pack(Values, State, CHANNEL_FILTER_PAIRS);
+			for(uint8_t p=0; p<CHANNEL_FILTER_PAIRS; p++)
+			{
+				Alpha[p]=CHANNEL_FILTER_ALPHA_PAIR(0.1f,0.5f);
+			}
+			Start=MCU_Cycle_Counter_Get();
+			if(Kernel==BENCHMARK_CHANNEL_FILTER)
+			{
+				Channel_Filter_Run(Samples, State, Alpha, CHANNEL_FILTER_PAIRS);
+			}
+			else
+			{
+				Channel_Filter_Run_Portable(Samples, State, Alpha, CHANNEL_FILTER_PAIRS);
+			}
+			Stop=MCU_Cycle_Counter_Get();
+			Benchmark_Sink=State[Run%CHANNEL_FILTER_PAIRS];
+		break;
+
+		default:
+			return 0;
+	}
+
+	uint32_t Cycles=Stop-Start;
+	return (Cycles>Benchmark_Overhead) ? Cycles-Benchmark_Overhead : 0;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Benchmark Run      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Runs BENCHMARK_RUNS timed calls of the kernel, replacing its last
+ * result. Blocking, it is meant to be requested with the car stopped.
+ */
+void Benchmark_Run(Control_Unit_TypeDef* Control_Unit, Benchmark_Kernel_TypeDef Kernel)
+{
+	if(Kernel>=BENCHMARK_KERNELS)
+	{
+		return;
+	}
+
+	Benchmark_Result_TypeDef* Result=&Benchmark_Results[Kernel];
+
+	Result->Runs=0;
+	Result->Min=UINT32_MAX;
+	Result->Max=0;
+	Result->Total=0;
+
+	for(uint8_t Run=0; Run<BENCHMARK_RUNS; Run++)
+	{
+		uint32_t Cycles=Benchmark_Kernel(Control_Unit,Kernel,Run);
+
+		Result->Runs++;
+		Result->Total+=Cycles;
+		if(Cycles<Result->Min)
+		{
+			Result->Min=Cycles;
+		}
+		if(Cycles>Result->Max)
+		{
+			Result->Max=Cycles;
+		}
+	}
+	Result->Clock_MHz=MCU_Get_Core_Clock_MHz();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Benchmark Get      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+const Benchmark_Result_TypeDef* Benchmark_Get(Benchmark_Kernel_TypeDef Kernel)
+{
+	if(Kernel>=BENCHMARK_KERNELS)
+	{
+		return NULL;
+	}
+	return &Benchmark_Results[Kernel];
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Benchmark.c
+  * @brief          : On-target micro-benchmarks
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
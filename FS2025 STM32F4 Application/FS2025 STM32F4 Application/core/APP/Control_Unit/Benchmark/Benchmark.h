@@ -0,0 +1,76 @@
+/**
+  ******************************************************************************
+  * @file           : Benchmark.h
+  * @brief          : On-target micro-benchmarks header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "Channel_Filter.h"
+#include <string.h>
+
+// Calls per kernel in a run, each one is timed on its own
+#define BENCHMARK_RUNS							32
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Benchmark_Init(void);
+void Benchmark_Run(Control_Unit_TypeDef* Control_Unit, Benchmark_Kernel_TypeDef Kernel);
+const Benchmark_Result_TypeDef* Benchmark_Get(Benchmark_Kernel_TypeDef Kernel);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Benchmark.h
+  * @brief          : On-target micro-benchmarks header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * @file           : Calibration.c
+  * @brief          : Per channel calibration tables
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Calibration.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibration Defaults      	  	 ***************
+********************************************************************************
+*******************************************************************************/
+void Calibration_Defaults(Calibration_TypeDef* Calibration)
+{
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Calibration->Temperature_Gain[i]=1.0f;
+		Calibration->Temperature_Offset[i]=0.0f;
+		Calibration->Voltage_Gain[i]=1.0f;
+		Calibration->Voltage_Offset[i]=0.0f;
+		Calibration->Curve[i]=0;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Word Conversion      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+static int16_t Calibration_Quantize(float Value, float LSB)
+{
+	float Steps=Value/LSB;
+
+	if(Steps>32767.0f)
+	{
+		return 32767;
+	}
+	if(Steps<-32768.0f)
+	{
+		return -32768;
+	}
+	return (int16_t)((Steps>=0.0f) ? Steps+0.5f : Steps-0.5f);
+}
+
+static uint32_t Calibration_Pack(float Gain, float Offset, float LSB)
+{
+	uint16_t Offset_Steps=(uint16_t)Calibration_Quantize(Offset,LSB);
+	uint16_t Gain_Steps=(uint16_t)Calibration_Quantize(Gain-1.0f,CALIBRATION_GAIN_LSB);
+
+	return (uint32_t)Offset_Steps | ((uint32_t)Gain_Steps<<16);
+}
+
+static void Calibration_Unpack(uint32_t Word, float LSB, float* Gain, float* Offset)
+{
+	*Offset=(int16_t)(Word & 0xFFFFU)*LSB;
+	*Gain=1.0f+(int16_t)(Word>>16)*CALIBRATION_GAIN_LSB;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibration Load      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+void Calibration_Load(Calibration_TypeDef* Calibration, const uint32_t* Words)
+{
+	Calibration_Defaults(Calibration);
+	Calibration->Loaded=FALSE;
+
+	if(Words[0]!=CALIBRATION_MAGIC)
+	{
+		return;
+	}
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Calibration_Unpack(Words[CALIBRATION_TEMPERATURE_WORD+i],CALIBRATION_TEMPERATURE_LSB,
+			&Calibration->Temperature_Gain[i],&Calibration->Temperature_Offset[i]);
+		Calibration_Unpack(Words[CALIBRATION_VOLTAGE_WORD+i],CALIBRATION_VOLTAGE_LSB,
+			&Calibration->Voltage_Gain[i],&Calibration->Voltage_Offset[i]);
+
+		uint8_t Curve=(uint8_t)(Words[CALIBRATION_CURVE_WORD+i/4]>>(8*(i%4)));
+		Calibration->Curve[i]=(Curve<LTC6811_TEMPERATURE_CURVES) ? Curve : 0;
+	}
+	Calibration->Loaded=TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibration Encode      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+void Calibration_Encode(const Calibration_TypeDef* Calibration, uint32_t* Words)
+{
+	Words[0]=CALIBRATION_MAGIC;
+	for(uint8_t i=0; i<BPCU_CHANNELS/4; i++)
+	{
+		Words[CALIBRATION_CURVE_WORD+i]=0;
+	}
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Words[CALIBRATION_TEMPERATURE_WORD+i]=Calibration_Pack(Calibration->Temperature_Gain[i],
+			Calibration->Temperature_Offset[i],CALIBRATION_TEMPERATURE_LSB);
+		Words[CALIBRATION_VOLTAGE_WORD+i]=Calibration_Pack(Calibration->Voltage_Gain[i],
+			Calibration->Voltage_Offset[i],CALIBRATION_VOLTAGE_LSB);
+		Words[CALIBRATION_CURVE_WORD+i/4]|=(uint32_t)Calibration->Curve[i]<<(8*(i%4));
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibration Request      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Copies the command frame out of the deferred CAN dispatch
+ * (Control_Unit_Deferred_Task), which preempts the main task. Commands arriving
+ * before the previous one is handled are rejected.
+ */
+void Calibration_Request(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->Calibration.Pending==TRUE || Control_Unit->Rx_Message.Header.DLC!=8)
+	{
+		Control_Unit->Calibration.Rejected++;
+		return;
+	}
+
+	memcpy(Control_Unit->Calibration.Request, Control_Unit->Rx_Message.Data, 8);
+	Control_Unit->Calibration.Pending=TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Zero Channel      	  	   		 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Moves the offset so the last raw reading converts to the reference,
+ * keeping the gain. Channels no scan has stored yet (the boot placeholders),
+ * without a valid reading or whose offset would pass the bound are left as
+ * they are.
+ */
+static BoolTypeDef Calibration_Zero_Temperature(Control_Unit_TypeDef* Control_Unit, uint8_t Channel, float Reference)
+{
+	Calibration_TypeDef* Calibration=&Control_Unit->Calibration;
+	float Reading=Control_Unit->Status.Temperatures.Readed_Value[Channel];
+
+	if(Control_Unit->Cell_Stats.Temperature_Lifetime[Channel].Count==0 || Reading==LTC6811_TEMPERATURE_OUT_OF_RANGE)
+	{
+		return FALSE;
+	}
+
+	float Raw=(Reading-Calibration->Temperature_Offset[Channel])/Calibration->Temperature_Gain[Channel];
+	float Offset=Reference-Raw*Calibration->Temperature_Gain[Channel];
+	if(fabsf(Offset)>CALIBRATION_TEMPERATURE_OFFSET_MAX)
+	{
+		return FALSE;
+	}
+	Calibration->Temperature_Offset[Channel]=Offset;
+	return TRUE;
+}
+
+static BoolTypeDef Calibration_Zero_Voltage(Control_Unit_TypeDef* Control_Unit, uint8_t Channel, float Reference)
+{
+	Calibration_TypeDef* Calibration=&Control_Unit->Calibration;
+	float Reading=Control_Unit->Status.Voltages[Channel];
+
+	if(Control_Unit->Cell_Stats.Voltage_Lifetime[Channel].Count==0)
+	{
+		return FALSE;
+	}
+
+	float Raw=(Reading-Calibration->Voltage_Offset[Channel])/Calibration->Voltage_Gain[Channel];
+	float Offset=Reference-Raw*Calibration->Voltage_Gain[Channel];
+	if(fabsf(Offset)>CALIBRATION_VOLTAGE_OFFSET_MAX)
+	{
+		return FALSE;
+	}
+	Calibration->Voltage_Offset[Channel]=Offset;
+	return TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibration Task      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Applies the pending command. The new table is used from the next
+ * scan, SAVE only flags it, the unit writes the NVM when the bus is idle.
+ */
+void Calibration_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	Calibration_TypeDef* Calibration=&Control_Unit->Calibration;
+
+	if(Calibration->Pending==FALSE)
+	{
+		return;
+	}
+
+	const uint8_t* Data=Calibration->Request;
+	uint8_t Channel=Data[1];
+	int16_t Offset=(int16_t)(Data[2] | (Data[3]<<8));
+	uint16_t Reference=(uint16_t)(Data[2] | (Data[3]<<8));
+	int16_t Gain=(int16_t)(Data[4] | (Data[5]<<8));
+	BoolTypeDef Valid=TRUE;
+
+	switch((Calibration_Command_TypeDef)Data[0])
+	{
+		case CALIBRATION_SET_TEMPERATURE:
+			if(Channel>=BPCU_CHANNELS || Data[6]>=LTC6811_TEMPERATURE_CURVES)
+			{
+				Valid=FALSE;
+				break;
+			}
+			Calibration->Temperature_Offset[Channel]=Offset*CALIBRATION_TEMPERATURE_LSB;
+			Calibration->Temperature_Gain[Channel]=1.0f+Gain*CALIBRATION_GAIN_LSB;
+			Calibration->Curve[Channel]=Data[6];
+		break;
+
+		case CALIBRATION_SET_VOLTAGE:
+			if(Channel>=BPCU_CHANNELS)
+			{
+				Valid=FALSE;
+				break;
+			}
+			Calibration->Voltage_Offset[Channel]=Offset*CALIBRATION_VOLTAGE_LSB;
+			Calibration->Voltage_Gain[Channel]=1.0f+Gain*CALIBRATION_GAIN_LSB;
+		break;
+
+		case CALIBRATION_ZERO_TEMPERATURE:
+		case CALIBRATION_ZERO_VOLTAGE:
+			if(Channel>=BPCU_CHANNELS && Channel!=CALIBRATION_ALL_CHANNELS)
+			{
+				Valid=FALSE;
+				break;
+			}
+			for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+			{
+				if(Channel!=CALIBRATION_ALL_CHANNELS && Channel!=i)
+				{
+					continue;
+				}
+				BoolTypeDef Zeroed=(Data[0]==CALIBRATION_ZERO_TEMPERATURE) ?
+					Calibration_Zero_Temperature(Control_Unit,i,Offset*CALIBRATION_TEMPERATURE_LSB) :
+					Calibration_Zero_Voltage(Control_Unit,i,Reference*CALIBRATION_VOLTAGE_LSB);
+				if(Zeroed==FALSE)
+				{
+					Valid=FALSE;
+				}
+			}
+		break;
+
+		case CALIBRATION_SAVE:
+			Calibration->Save_Pending=TRUE;
+		break;
+
+		case CALIBRATION_DEFAULTS:
+			Calibration_Defaults(Calibration);
+		break;
+
+		default:
+			Valid=FALSE;
+		break;
+	}
+
+	if(Valid==FALSE)
+	{
+		Calibration->Rejected++;
+	}
+	Calibration->Pending=FALSE;
+}
+
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Calibration.c
+  * @brief          : Per channel calibration tables
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,125 @@
+/**
+  ******************************************************************************
+  * @file           : Calibration.h
+  * @brief          : Per channel calibration tables header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "LTC6811.h"
+#include <math.h>
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 NVM Layout      	  	  		 	 ***************
+********************************************************************************
+*******************************************************************************/
+// Word 0 magic, 1..24 temperature and 25..48 voltage of each channel as offset
+// (low half) and gain error (high half) int16, 49..54 thermistor curve of each
+// channel, one byte each, channel 4k in the low byte of word 49+k. A block
+// without the magic (erased) takes the defaults
+#define CALIBRATION_WORDS							55
+#define CALIBRATION_MAGIC							0xCA1B0001UL
+#define CALIBRATION_TEMPERATURE_WORD	1
+#define CALIBRATION_VOLTAGE_WORD			(CALIBRATION_TEMPERATURE_WORD+BPCU_CHANNELS)
+#define CALIBRATION_CURVE_WORD				(CALIBRATION_VOLTAGE_WORD+BPCU_CHANNELS)
+
+#define CALIBRATION_TEMPERATURE_LSB		0.01f						//degC
+#define CALIBRATION_VOLTAGE_LSB				0.0001f					//V
+#define CALIBRATION_GAIN_LSB					(1.0f/65536.0f)	//Gain error
+
+// Largest offset a zero command may leave, a reference further from the
+// reading than this is a wrong command or a broken channel
+#define CALIBRATION_TEMPERATURE_OFFSET_MAX	10.0f			//degC
+#define CALIBRATION_VOLTAGE_OFFSET_MAX			0.1f			//V
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Commands      	  	  		 	   ***************
+********************************************************************************
+*******************************************************************************/
+// Data[0] command, Data[1] channel (CALIBRATION_ALL_CHANNELS for every one on
+// the zero commands), offsets and references in CALIBRATION_*_LSB and gain
+// errors in CALIBRATION_GAIN_LSB, little endian. Signed but for the voltage
+// reference, a cell sits well over the 3.2767 V an int16 reaches
+typedef enum
+{
+	CALIBRATION_SET_TEMPERATURE		=0x01,	//[2..3] offset, [4..5] gain error, [6] curve
+	CALIBRATION_SET_VOLTAGE				=0x02,	//[2..3] offset, [4..5] gain error
+	CALIBRATION_ZERO_TEMPERATURE	=0x03,	//[2..3] reference temperature
+	CALIBRATION_ZERO_VOLTAGE			=0x04,	//[2..3] reference voltage, unsigned
+	CALIBRATION_SAVE							=0x05,	//Writes the table to NVM
+	CALIBRATION_DEFAULTS					=0x06		//Unity gain and no offset, not saved
+} Calibration_Command_TypeDef;
+
+#define CALIBRATION_ALL_CHANNELS			0xFF
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Calibration_Defaults(Calibration_TypeDef* Calibration);
+void Calibration_Load(Calibration_TypeDef* Calibration, const uint32_t* Words);
+void Calibration_Encode(const Calibration_TypeDef* Calibration, uint32_t* Words);
+
+// Request is called from the deferred CAN dispatch, the command runs in the main task
+void Calibration_Request(Control_Unit_TypeDef* Control_Unit);
+void Calibration_Task(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Calibration.h
+  * @brief          : Per channel calibration tables header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,160 @@
+/**
+  ******************************************************************************
+  * @file           : Capture.c
+  * @brief          : SPI and CAN traffic capture
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Capture.h"
+
+/*******************************************************************************
+********************************************************************************
+***************									Capture Data      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+// Written from the main loop and the deferred work handler
+static Capture_Record_TypeDef Capture_Records[CAPTURE_RECORDS];
+static uint32_t Capture_Recorded;
+static volatile BoolTypeDef Capture_Frozen;
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Capture Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Empties the ring and starts recording again.
+ */
+void Capture_Init(void)
+{
+	uint32_t State=MCU_Critical_Enter();
+	memset(Capture_Records, 0, sizeof(Capture_Records));
+	Capture_Recorded=0;
+	Capture_Frozen=FALSE;
+	MCU_Critical_Exit(State);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Record      	  	   		 		 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Stores one transaction, overwriting the oldest record when the ring
+ * is full. Data beyond 8 bytes is not kept.
+ */
+void Capture_Record(Capture_Source_TypeDef Source, uint32_t Timestamp, uint16_t Id, uint8_t Flags, const uint8_t* Data, uint16_t Length)
+{
+	if(Capture_Frozen==TRUE)
+	{
+		return;
+	}
+
+	if(Length>8)
+	{
+		Length=8;
+	}
+
+	uint32_t State=MCU_Critical_Enter();
+	Capture_Record_TypeDef* Record=&Capture_Records[Capture_Recorded % CAPTURE_RECORDS];
+
+	Record->Timestamp=Timestamp;
+	Record->Source=(uint8_t)Source;
+	Record->Flags=Flags;
+	Record->Id=Id;
+	memset(Record->Data, 0, sizeof(Record->Data));
+	if(Data!=NULL)
+	{
+		memcpy(Record->Data, Data, Length);
+	}
+	Capture_Recorded++;
+	MCU_Critical_Exit(State);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Freeze      	  	   		 		 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Stops recording so the records leading to a fault, or being dumped,
+ * are kept. Capture_Init resumes.
+ */
+void Capture_Freeze(void)
+{
+	Capture_Frozen=TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Read      	  	   		 		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+uint32_t Capture_Count(void)
+{
+	return (Capture_Recorded<CAPTURE_RECORDS) ? Capture_Recorded : CAPTURE_RECORDS;
+}
+
+uint32_t Capture_Total(void)
+{
+	return Capture_Recorded;
+}
+
+/**
+ * @brief Index 0 is the oldest record held.
+ */
+const Capture_Record_TypeDef* Capture_Get(uint32_t Index)
+{
+	if(Index>=Capture_Count())
+	{
+		return NULL;
+	}
+	return &Capture_Records[(Capture_Recorded-Capture_Count()+Index) % CAPTURE_RECORDS];
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Capture.c
+  * @brief          : SPI and CAN traffic capture
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file           : Capture.h
+  * @brief          : SPI and CAN traffic capture header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include <string.h>
+
+// Comment to remove the capture from the build, the hooks compile to nothing
+#define CAPTURE_ENABLED
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Hooks      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+#ifdef CAPTURE_ENABLED
+	#define CAPTURE(Source,Timestamp,Id,Flags,Data,Length)	Capture_Record(Source,Timestamp,Id,Flags,Data,Length)
+	#define CAPTURE_FREEZE()																Capture_Freeze()
+#else
+	#define CAPTURE(Source,Timestamp,Id,Flags,Data,Length)
+	#define CAPTURE_FREEZE()
+#endif
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Capture_Init(void);
+void Capture_Record(Capture_Source_TypeDef Source, uint32_t Timestamp, uint16_t Id, uint8_t Flags, const uint8_t* Data, uint16_t Length);
+void Capture_Freeze(void);
+uint32_t Capture_Count(void);
+uint32_t Capture_Total(void);
+const Capture_Record_TypeDef* Capture_Get(uint32_t Index);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Capture.h
+  * @brief          : SPI and CAN traffic capture header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,218 @@
+/**
+  ******************************************************************************
+  * @file           : Cell_Stats.c
+  * @brief          : Streaming cell statistics
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Cell_Stats.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Cell Stats Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Cell_Stats_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	memset(&Control_Unit->Cell_Stats, 0, sizeof(Cell_Stats_TypeDef));
+	Cell_Stats_Scan_Start(Control_Unit);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Start      	  	   				 ***************
+********************************************************************************
+*******************************************************************************/
+static void Cell_Stats_Clear(Cell_Stats_Scan_TypeDef* Scan)
+{
+	Scan->Min=INFINITY;
+	Scan->Max=-INFINITY;
+	Scan->Sum=0.0f;
+	Scan->Mean=0.0f;
+	Scan->Spread=0.0f;
+	Scan->Min_Channel=CELL_STATS_NO_CHANNEL;
+	Scan->Max_Channel=CELL_STATS_NO_CHANNEL;
+	Scan->Count=0;
+}
+
+void Cell_Stats_Scan_Start(Control_Unit_TypeDef* Control_Unit)
+{
+	Cell_Stats_Clear(&Control_Unit->Cell_Stats.Voltage);
+	Cell_Stats_Clear(&Control_Unit->Cell_Stats.Temperature);
+	Control_Unit->Cell_Stats.Ready=FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Add Value      	  	   				 	 ***************
+********************************************************************************
+*******************************************************************************/
+void Cell_Stats_Add(Cell_Stats_Scan_TypeDef* Scan, uint8_t Channel, float Value)
+{
+	if(Value<Scan->Min)
+	{
+		Scan->Min=Value;
+		Scan->Min_Channel=Channel;
+	}
+	if(Value>Scan->Max)
+	{
+		Scan->Max=Value;
+		Scan->Max_Channel=Channel;
+	}
+	Scan->Sum+=Value;
+	Scan->Count++;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan End      	  	   				 	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Cell_Stats_Close(Cell_Stats_Scan_TypeDef* Scan)
+{
+	if(Scan->Count==0)
+	{
+		Scan->Min=0.0f;
+		Scan->Max=0.0f;
+		return;
+	}
+	Scan->Mean=Scan->Sum/Scan->Count;
+	Scan->Spread=Scan->Max-Scan->Min;
+}
+
+static void Cell_Stats_Welford(Cell_Stats_Lifetime_TypeDef* Lifetime, float Value)
+{
+	Lifetime->Count++;
+	float Delta=Value-Lifetime->Mean;
+	Lifetime->Mean+=Delta/Lifetime->Count;
+	Lifetime->M2+=Delta*(Value-Lifetime->Mean);
+}
+
+/**
+ * @brief Closes the scan and adds it to the lifetime statistics. The sensors
+ * left out of the scan (disabled or out of the table) are left out here too.
+ */
+void Cell_Stats_Scan_End(Control_Unit_TypeDef* Control_Unit)
+{
+	Cell_Stats_TypeDef* Stats=&Control_Unit->Cell_Stats;
+
+	Cell_Stats_Close(&Stats->Voltage);
+	Cell_Stats_Close(&Stats->Temperature);
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Cell_Stats_Welford(&Stats->Voltage_Lifetime[i],Control_Unit->Status.Voltages[i]);
+
+		float Temperature=Control_Unit->Status.Temperatures.Readed_Value[i];
+		if((Control_Unit->Status.Temperatures.Disabled & (1UL<<i))==0 && Temperature!=LTC6811_TEMPERATURE_OUT_OF_RANGE)
+		{
+			Cell_Stats_Welford(&Stats->Temperature_Lifetime[i],Temperature);
+		}
+	}
+	Stats->Ready=TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Deviation      	  	   				 	 ***************
+********************************************************************************
+*******************************************************************************/
+float Cell_Stats_Deviation(const Cell_Stats_Lifetime_TypeDef* Lifetime)
+{
+	if(Lifetime->Count<2)
+	{
+		return 0.0f;
+	}
+	return sqrtf(Lifetime->M2/(Lifetime->Count-1));
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Summary Message      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+static int32_t Cell_Stats_Scale(float Value, float LSB, int32_t Min, int32_t Max)
+{
+	float Steps=Value/LSB;
+	return (Steps>(float)Max) ? Max : (Steps<(float)Min) ? Min : (int32_t)Steps;
+}
+
+/**
+ * @brief Sends the summary of one quantity of the last scan.
+ */
+void Cell_Stats_Send(Control_Unit_TypeDef* Control_Unit, uint8_t Quantity)
+{
+	const Cell_Stats_Scan_TypeDef* Scan=(Quantity==CELL_STATS_VOLTAGE) ? &Control_Unit->Cell_Stats.Voltage : &Control_Unit->Cell_Stats.Temperature;
+	float LSB=(Quantity==CELL_STATS_VOLTAGE) ? CELL_STATS_VOLTAGE_LSB : CELL_STATS_TEMPERATURE_LSB;
+	int32_t Min=(Quantity==CELL_STATS_VOLTAGE) ? 0 : -32768;
+	int32_t Max=(Quantity==CELL_STATS_VOLTAGE) ? 65535 : 32767;
+	uint16_t Values[3];
+
+	if(Control_Unit->Cell_Stats.Ready==FALSE)
+	{
+		return;
+	}
+
+	Values[0]=(uint16_t)Cell_Stats_Scale(Scan->Min,LSB,Min,Max);
+	Values[1]=(uint16_t)Cell_Stats_Scale(Scan->Max,LSB,Min,Max);
+	Values[2]=(uint16_t)Cell_Stats_Scale(Scan->Mean,LSB,Min,Max);
+
+	Control_Unit->Tx_Message.ID=BPCU_CELL_STATS_DEF;
+	Control_Unit->Tx_Message.DLC=8;
+	Control_Unit->Tx_Message.Data[0]=Scan->Min_Channel | Quantity;
+	Control_Unit->Tx_Message.Data[1]=Scan->Max_Channel;
+	for(uint8_t i=0; i<3; i++)
+	{
+		Control_Unit->Tx_Message.Data[2+2*i]=(uint8_t)Values[i];
+		Control_Unit->Tx_Message.Data[3+2*i]=(uint8_t)(Values[i]>>8);
+	}
+	CAN1_Send(&Control_Unit->Tx_Message);
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Cell_Stats.c
+  * @brief          : Streaming cell statistics
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file           : Cell_Stats.h
+  * @brief          : Streaming cell statistics header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef CELL_STATS_H
+#define CELL_STATS_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "Can_Bus.h"
+#include "LTC6811.h"
+#include <math.h>
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Summary Frame      	  	  	 ***************
+********************************************************************************
+*******************************************************************************/
+// One frame per quantity and scan: 0 Min channel | Quantity<<7, 1 Max channel,
+// 2..3 Min, 4..5 Max, 6..7 Mean. Voltages in CELL_STATS_VOLTAGE_LSB unsigned,
+// temperatures in CELL_STATS_TEMPERATURE_LSB signed, little endian
+#define CELL_STATS_VOLTAGE						0x00
+#define CELL_STATS_TEMPERATURE				0x80
+#define CELL_STATS_NO_CHANNEL					0x7F		//No valid channel in the scan
+
+#define CELL_STATS_VOLTAGE_LSB				0.0001f	//V
+#define CELL_STATS_TEMPERATURE_LSB		0.01f		//degC
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Cell_Stats_Init(Control_Unit_TypeDef* Control_Unit);
+
+// Start clears the scan, Add is called by the acquisition for every converted
+// value and End closes the scan once both phases are stored
+void Cell_Stats_Scan_Start(Control_Unit_TypeDef* Control_Unit);
+void Cell_Stats_Add(Cell_Stats_Scan_TypeDef* Scan, uint8_t Channel, float Value);
+void Cell_Stats_Scan_End(Control_Unit_TypeDef* Control_Unit);
+
+void Cell_Stats_Send(Control_Unit_TypeDef* Control_Unit, uint8_t Quantity);
+float Cell_Stats_Deviation(const Cell_Stats_Lifetime_TypeDef* Lifetime);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Cell_Stats.h
+  * @brief          : Streaming cell statistics header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file           : Channel_Filter.c
+  * @brief          : Fixed point channel filter
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Channel_Filter.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Saturate      	  	   						 ***************
+********************************************************************************
+*******************************************************************************/
+static int16_t Channel_Filter_Saturate(int32_t Value)
+{
+	if(Value>32767)
+	{
+		return 32767;
+	}
+	if(Value<-32768)
+	{
+		return -32768;
+	}
+	return (int16_t)Value;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Pack / Unpack      	  	   			 ***************
+********************************************************************************
+*******************************************************************************/
+void Channel_Filter_Pack(const float* Values, uint32_t* Packed, uint8_t Pairs)
+{
+	for(uint8_t p=0; p<Pairs; p++)
+	{
+		float Low=Values[2*p]*CHANNEL_FILTER_SCALE;
+		float High=Values[2*p+1]*CHANNEL_FILTER_SCALE;
+
+		// Clamped as floats, out of range float to int conversions are undefined
+		Low=(Low>32767.0f) ? 32767.0f : (Low<-32768.0f) ? -32768.0f : Low;
+		High=(High>32767.0f) ? 32767.0f : (High<-32768.0f) ? -32768.0f : High;
+		Packed[p]=(uint16_t)(int16_t)Low | ((uint32_t)(uint16_t)(int16_t)High<<16);
+	}
+}
+
+void Channel_Filter_Unpack(const uint32_t* Packed, float* Values, uint8_t Pairs)
+{
+	for(uint8_t p=0; p<Pairs; p++)
+	{
+		Values[2*p]=(float)(int16_t)(Packed[p] & 0xFFFF)*(1.0f/CHANNEL_FILTER_SCALE);
+		Values[2*p+1]=(float)(int16_t)(Packed[p]>>16)*(1.0f/CHANNEL_FILTER_SCALE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Portable Filter      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Channel_Filter_Run_Portable(const uint32_t* Input, uint32_t* State, const uint32_t* Alpha, uint8_t Pairs)
+{
+	for(uint8_t p=0; p<Pairs; p++)
+	{
+		uint32_t Result=0;
+
+		for(uint8_t Lane=0; Lane<32; Lane+=16)
+		{
+			int32_t x=(int16_t)(Input[p]>>Lane);
+			int32_t y=(int16_t)(State[p]>>Lane);
+			int32_t a=(int16_t)(Alpha[p]>>Lane);
+			int32_t Difference=Channel_Filter_Saturate(x-y);
+			int32_t Step=(Difference*a+0x4000)>>15;
+
+			Result|=(uint32_t)(uint16_t)Channel_Filter_Saturate(y+Step)<<Lane;
+		}
+		State[p]=Result;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Filter      	  	   						 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Two channels per word: QSUB16 and QADD16 work on both halves at once,
+ * and each SMLAD multiplies one half by its factor, the other factor masked to
+ * zero, adding the rounding constant in the same instruction.
+ * CMSIS-DSP (Drivers/CMSIS/DSP) is not used on purpose: its IIR filters run a
+ * block of samples of one channel with shared coefficients, while this runs
+ * one sample of 24 channels, each with its own factor. The element-wise
+ * arm_sub_q15/arm_mult_q15/arm_add_q15 would take three passes and two
+ * buffers, and arm_mult_q15 truncates where the portable path rounds.
+ */
+void Channel_Filter_Run(const uint32_t* Input, uint32_t* State, const uint32_t* Alpha, uint8_t Pairs)
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP==1)
+	for(uint8_t p=0; p<Pairs; p++)
+	{
+		uint32_t Difference=__QSUB16(Input[p],State[p]);
+		int32_t Low=(int32_t)__SMLAD(Difference,Alpha[p] & 0x0000FFFFU,0x4000)>>15;
+		int32_t High=(int32_t)__SMLAD(Difference,Alpha[p] & 0xFFFF0000U,0x4000)>>15;
+
+		State[p]=__QADD16(State[p],__PKHBT(Low,High,16));
+	}
+#else
+	Channel_Filter_Run_Portable(Input,State,Alpha,Pairs);
+#endif
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Channel_Filter.c
+  * @brief          : Fixed point channel filter
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
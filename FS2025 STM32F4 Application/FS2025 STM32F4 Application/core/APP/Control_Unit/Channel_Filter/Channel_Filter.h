@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file           : Channel_Filter.h
+  * @brief          : Fixed point channel filter header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef CHANNEL_FILTER_H
+#define CHANNEL_FILTER_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Format      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// Samples are signed 16 bit in 1/64 degC (+-512 degC), two channels per word:
+// channel 2p in the low half of word p, channel 2p+1 in the high half
+#define CHANNEL_FILTER_SCALE					64.0f
+#define CHANNEL_FILTER_PAIRS					(BPCU_CHANNELS/2)
+
+// Q15 smoothing factor of each channel, packed the same way as the samples
+#define CHANNEL_FILTER_Q15(x)					((uint16_t)(int16_t)((x)*32767.0f))
+#define CHANNEL_FILTER_ALPHA_PAIR(a,b)	((uint32_t)CHANNEL_FILTER_Q15(a) | ((uint32_t)CHANNEL_FILTER_Q15(b)<<16))
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Channel_Filter_Pack(const float* Values, uint32_t* Packed, uint8_t Pairs);
+void Channel_Filter_Unpack(const uint32_t* Packed, float* Values, uint8_t Pairs);
+
+// State+=Alpha*(Input-State) on every channel, saturated. Run uses the DSP
+// instructions when the core has them, both give the same result
+void Channel_Filter_Run(const uint32_t* Input, uint32_t* State, const uint32_t* Alpha, uint8_t Pairs);
+void Channel_Filter_Run_Portable(const uint32_t* Input, uint32_t* State, const uint32_t* Alpha, uint8_t Pairs);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Channel_Filter.h
+  * @brief          : Fixed point channel filter header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -28,6 +28,7 @@
 ********************************************************************************
 *******************************************************************************/
 #include "Control_Unit.h"
+#include "Profiler.h"
 
 
 
@@ -38,6 +39,10 @@
 *******************************************************************************/
 Control_Unit_TypeDef CONTROL_UNIT;
 
+// 1 ms ticks counted by the timer interrupt and served by the deferred work
+static volatile uint32_t Timer_10ms_Captured;
+static uint32_t Timer_10ms_Served;
+
 
 /*******************************************************************************
 ********************************************************************************
@@ -74,9 +79,12 @@ void Control_Unit_Init()
 *******************************************************************************/
 void Control_Unit_Main_Task()
 {
+	PROFILER_MARK(PROFILER_MAIN_PERIOD);
+	PROFILER_START(PROFILER_MAIN_TASK);
 	#ifdef BATTERY_PACK_CONTROL_UNIT
 		Battery_Pack_Control_Unit_Main_Task(&CONTROL_UNIT);
 	#endif
+	PROFILER_STOP(PROFILER_MAIN_TASK);
 }
 
 /*******************************************************************************
@@ -105,6 +113,38 @@ void Control_Unit_CAN1_Interrupt()
 
 }
 
+
+/*******************************************************************************
+********************************************************************************
+***************								Timer 10ms Capture               ***************	
+********************************************************************************
+*******************************************************************************/
+void Control_Unit_Timer_10ms_Capture()
+{
+	Timer_10ms_Captured++;
+	MCU_Deferred_Trigger();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Deferred Task	               ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Runs from PendSV at the lowest interrupt priority: dispatches the
+ * received CAN frames and serves the timer ticks counted since the last run.
+ */
+void Control_Unit_Deferred_Task()
+{
+	CAN1_Interrupt_DoTask();
+	while(Timer_10ms_Served!=Timer_10ms_Captured)
+	{
+		Timer_10ms_Served++;
+		Control_Unit_Timer_10ms_Interrupt();
+	}
+}
+
 	/*****************************************************************************
 	** 																END OF FILE																**			
 	******************************************************************************
@@ -76,6 +76,15 @@ void Control_Unit_Timer_10ms_Interrupt(void);
 void Control_Unit_CAN1_Interrupt(void);
 
 
+/*******************************************************************************
+********************************************************************************
+***************									Deferred Work	                 ***************	
+********************************************************************************
+*******************************************************************************/
+void Control_Unit_Timer_10ms_Capture(void);
+void Control_Unit_Deferred_Task(void);
+
+
 #endif
 
 	/*****************************************************************************
@@ -69,23 +69,34 @@ void Battery_Pack_Control_Unit_Device_Init(Device_TypeDef* Device_Data)
 ********************************************************************************
   * @brief  Initializes Device Parameters from Flash stored values
   */
+static void Battery_Pack_Control_Unit_NVM_Recover(Control_Unit_TypeDef* Control_Unit);
+
 void Battery_Pack_Control_Unit_Read_Memory_Init(Control_Unit_TypeDef* Control_Unit)
 {
+	Battery_Pack_Control_Unit_NVM_Recover(Control_Unit);
+	
 	uint32_t Activated_Sensors= MCU_Flash_Read_Word(Address_APP_BPCU_Activated_Sensors);
 	
-	for(uint8_t i=0; i<24 ; i++)
+	Control_Unit->Status.Temperatures.Disabled=~Activated_Sensors & BPCU_CHANNEL_MASK;
+	
+	uint32_t Filter_Config[FILTER_CONFIG_WORDS];
+	for(uint8_t i=0; i<FILTER_CONFIG_WORDS; i++)
 	{
-		uint8_t bit_state = (Activated_Sensors >> i) & 0x01;
-		if(bit_state)
-		{
-			Control_Unit->Status.Temperatures[i].Disabled=FALSE;
-		}
-		else
-		{
-			Control_Unit->Status.Temperatures[i].Disabled=TRUE;
-		}
-		
+		Filter_Config[i]=MCU_Flash_Read_Word(Address_APP_BPCU_Filter_Config+4*i);
+	}
+	Filter_Engine_Init(&Control_Unit->Filter_Engine,Filter_Config);
+	
+	uint32_t Calibration[CALIBRATION_WORDS];
+	for(uint8_t i=0; i<CALIBRATION_WORDS; i++)
+	{
+		Calibration[i]=MCU_Flash_Read_Word(Address_APP_BPCU_Calibration+4*i);
 	}
+	memset(&Control_Unit->Calibration, 0, sizeof(Calibration_TypeDef));
+	Calibration_Load(&Control_Unit->Calibration,Calibration);
+	
+	Open_Wire_Init(Control_Unit,MCU_Flash_Read_Word(Address_APP_BPCU_Open_Wire_Period));
+	Sum_Check_Init(Control_Unit,MCU_Flash_Read_Word(Address_APP_BPCU_Sum_Check_Tolerance));
+	Scan_Scheduler_Configure(Control_Unit,MCU_Flash_Read_Word(Address_APP_BPCU_Scan_Period_Slow),MCU_Flash_Read_Word(Address_APP_BPCU_Scan_Period_Fast));
 }
 /*******************************************************************************
 ********************************************************************************
@@ -95,12 +106,17 @@ void Battery_Pack_Control_Unit_Read_Memory_Init(Control_Unit_TypeDef* Control_Un
 void Battery_Pack_Control_Unit_Init_Values(Control_Unit_TypeDef* Control_Unit)
 {
 	Battery_Pack_Control_Unit_Read_Memory_Init(Control_Unit);
-	for(unsigned char i=0; i<24; i++)
+	for(unsigned char i=0; i<BPCU_CHANNELS; i++)
 	{
-		Control_Unit->Status.Temperatures[i].Actual_Value=25.0f;
-		Control_Unit->Status.Temperatures[i].Readed_Value=25.0f;
+		Control_Unit->Status.Temperatures.Actual_Value[i]=25.0f;
+		Control_Unit->Status.Temperatures.Readed_Value[i]=25.0f;
+		Control_Unit->Status.Temperatures.Cont_Fail[i]=0;
 		Control_Unit->Status.Voltages[i]=3.6f;
 	}
+	Control_Unit->Status.Temperatures.Failed=0;
+	Control_Unit->Status.Temperatures.Hot=0;
+	Control_Unit->Status.Temperatures.Stale=BPCU_CHANNEL_MASK;
+	Control_Unit->Status.Voltages_Stale=BPCU_CHANNEL_MASK;
 }
 
 
@@ -112,11 +128,24 @@ void Battery_Pack_Control_Unit_Init_Values(Control_Unit_TypeDef* Control_Unit)
 void Battery_Pack_Control_Unit_Init(Control_Unit_TypeDef* Control_Unit)
 {
 	State_LEDs_Init(Control_Unit);
+	Power_Governor_Init(Control_Unit);
+	Profiler_Init();
+	Diagnostics_Init(Control_Unit);
+	Benchmark_Init();
+	Capture_Init();
 	Battery_Pack_Control_Unit_Init_Values(Control_Unit);
+	Snapshot_Init(Control_Unit);
+	Balancing_Init(Control_Unit);
+	Self_Test_Init(Control_Unit);
+	Scan_Scheduler_Init(Control_Unit);
+	Thermal_Trend_Init(Control_Unit);
+	Cell_Stats_Init(Control_Unit);
 	Timer_10ms_Init(&Control_Unit->Timing.Status_Send_Timer,1,MILISECONDS,100);
 	
-	Timer_10ms_Init(&Control_Unit->Timing.Init_State_Timer,1,MILISECONDS,1000);
-	Timer_10ms_Start(&Control_Unit->Timing.Init_State_Timer);
+	memset(&Control_Unit->Startup, 0, sizeof(Startup_TypeDef));
+	Control_Unit->Startup.Step=STARTUP_WAKE;
+	memset(&Control_Unit->Recovery, 0, sizeof(Recovery_TypeDef));
+	Fault_Injection_Init();
 	
 	Timer_10ms_Init(&Control_Unit->Timing.Temp_Send_Timer,1,MILISECONDS,200);
 	
@@ -131,11 +160,18 @@ void Battery_Pack_Control_Unit_Init(Control_Unit_TypeDef* Control_Unit)
 *******************************************************************************/
 void Generate_Status_Message(Control_Unit_TypeDef* Control_Unit)
 {
+		Measurement_Snapshot_TypeDef Snapshot;
+		Snapshot_Read(Control_Unit,&Snapshot);
+	
 		Control_Unit->Tx_Message.ID=BPCU_STATUS_DEF;
-		Control_Unit->Tx_Message.DLC=3;
+		Control_Unit->Tx_Message.DLC=6;
 		Control_Unit->Tx_Message.Data[0]=Control_Unit->State;
-		Control_Unit->Tx_Message.Data[1]=Control_Unit->Status.Temperatures_Hot;
-		Control_Unit->Tx_Message.Data[2]=Control_Unit->Status.Temperatures_Failed;
+		Control_Unit->Tx_Message.Data[1]=Snapshot.Temperatures_Hot;
+		Control_Unit->Tx_Message.Data[2]=Snapshot.Temperatures_Failed;
+		// Cells with an open sense wire, little endian
+		Control_Unit->Tx_Message.Data[3]=(uint8_t)Control_Unit->Open_Wire.Open;
+		Control_Unit->Tx_Message.Data[4]=(uint8_t)(Control_Unit->Open_Wire.Open>>8);
+		Control_Unit->Tx_Message.Data[5]=(uint8_t)(Control_Unit->Open_Wire.Open>>16);
 }
 
 /*******************************************************************************
@@ -150,12 +186,15 @@ void Generate_Temp_Message(Control_Unit_TypeDef* Control_Unit)
 	uint8_t base = Control_Unit->Status.CAN_Message * 6;
 	if (base + 5 >= 24) return;  // Protege overflow
 
+	Measurement_Snapshot_TypeDef Snapshot;
+	Snapshot_Read(Control_Unit,&Snapshot);
+
 	for (uint8_t i = 0; i < 6; i++) 
 	{
-    Control_Unit->Tx_Message.Data[i] = LTC6811_Enconde_Temp(Control_Unit->Status.Temperatures[base + i].Actual_Value);
+    Control_Unit->Tx_Message.Data[i] = LTC6811_Enconde_Temp(Snapshot.Temperatures[base + i]);
 	}
-	Control_Unit->Tx_Message.Data[6]=Control_Unit->Status.Temperatures_Hot;
-	Control_Unit->Tx_Message.Data[7]=Control_Unit->Status.Temperatures_Failed;	
+	Control_Unit->Tx_Message.Data[6]=Snapshot.Temperatures_Hot;
+	Control_Unit->Tx_Message.Data[7]=Snapshot.Temperatures_Failed;	
 }
 
 /*******************************************************************************
@@ -177,12 +216,35 @@ void Generate_Volt_Message(Control_Unit_TypeDef* Control_Unit)
 	Control_Unit->Tx_Message.DLC = 8;
 	Control_Unit->Tx_Message.ID = BPCU_TEMP_1_DEF + Control_Unit->Status.CAN_Message;
 
+	Measurement_Snapshot_TypeDef Snapshot;
+	Snapshot_Read(Control_Unit,&Snapshot);
+
 	for (uint8_t i = 0; i < 8; i++) 
 	{
-		Control_Unit->Tx_Message.Data[i] =LTC6811_Encode_Volt_10mV(Control_Unit->Status.Voltages[base_index + i]);
+		Control_Unit->Tx_Message.Data[i] =LTC6811_Encode_Volt_10mV(Snapshot.Voltages[base_index + i]);
 	}
 }
 
+/*******************************************************************************
+********************************************************************************
+***************					Generate Startup Message       			 	   ***************	
+********************************************************************************
+*******************************************************************************/
+void Generate_Startup_Message(Control_Unit_TypeDef* Control_Unit)
+{
+	uint16_t Ready_Time=(Control_Unit->Startup.Ready_Time>0xFFFF) ? 0xFFFF : Control_Unit->Startup.Ready_Time;
+	uint16_t First_Frame_Time=(Control_Unit->Startup.First_Frame_Time>0xFFFF) ? 0xFFFF : Control_Unit->Startup.First_Frame_Time;
+	
+	Control_Unit->Tx_Message.ID=BPCU_STARTUP_DIAG_DEF;
+	Control_Unit->Tx_Message.DLC=6;
+	Control_Unit->Tx_Message.Data[0]=(uint8_t)Ready_Time;
+	Control_Unit->Tx_Message.Data[1]=(uint8_t)(Ready_Time>>8);
+	Control_Unit->Tx_Message.Data[2]=(uint8_t)First_Frame_Time;
+	Control_Unit->Tx_Message.Data[3]=(uint8_t)(First_Frame_Time>>8);
+	Control_Unit->Tx_Message.Data[4]=Control_Unit->Startup.Attempts;
+	Control_Unit->Tx_Message.Data[5]=Control_Unit->Startup.Timed_Out;
+}
+
 /*******************************************************************************
 ********************************************************************************
 ***************					Generate Finished Measure       			 	   ***************	
@@ -207,6 +269,201 @@ void Battery_Pack_Control_Unit_WDT_Task(void)
 
 
 
+/*******************************************************************************
+********************************************************************************
+***************						 		  NVM TASK       			   		 			 ***************	
+********************************************************************************
+*******************************************************************************/
+static uint32_t NVM_Image[BPCU_NVM_WORDS];
+
+static uint32_t Battery_Pack_Control_Unit_NVM_Checksum(const uint32_t* Image, uint32_t Sequence)
+{
+	uint32_t Sum=Sequence;
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		Sum+=Image[i];
+	}
+	return ~Sum;
+}
+
+/**
+ * @brief Erases the data sector and programs Image into it. The image goes to
+ * the backup sector first and is marked valid, so a reset at any point leaves
+ * one complete copy: the data sector until its erase, the backup from then on
+ * until the data sector is programmed and the copy is marked committed.
+ */
+static void Battery_Pack_Control_Unit_NVM_Rewrite(Control_Unit_TypeDef* Control_Unit, const uint32_t* Image)
+{
+	uint32_t Sequence=Control_Unit->NVM.Sequence+1;
+	
+	MCU_WDT_Refresh();
+	MCU_Flash_Erase_Sector(MCU_SECTOR_BOOTLOADER_DATA_BKUP);
+	MCU_WDT_Refresh();
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		MCU_Flash_Program_Word(MCU_ADDRESS_BOOTLOADER_DATA_BKUP+4*i,Image[i]);
+	}
+	MCU_Flash_Program_Word(BPCU_NVM_BACKUP_SEQUENCE,Sequence);
+	MCU_Flash_Program_Word(BPCU_NVM_BACKUP_CHECKSUM,Battery_Pack_Control_Unit_NVM_Checksum(Image,Sequence));
+	MCU_Flash_Program_Word(BPCU_NVM_BACKUP_MARKER,BPCU_NVM_BACKUP_VALID);
+	
+	MCU_Flash_Erase_Sector(MCU_SECTOR_BOOTLOADER_DATA);
+	MCU_WDT_Refresh();
+	// Ascending order, the bootloader words come back first
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		if(Image[i]!=0xFFFFFFFFU)
+		{
+			MCU_Flash_Program_Word(Address_Bootloader_Stay_Condition+4*i,Image[i]);
+		}
+	}
+	MCU_Flash_Program_Word(BPCU_NVM_BACKUP_MARKER,BPCU_NVM_BACKUP_COMMITTED);
+	
+	Control_Unit->NVM.Sequence=Sequence;
+	Control_Unit->NVM.Rewrites++;
+}
+
+/**
+ * @brief Runs at startup before any word is read: a copy still marked valid
+ * means the last rewrite was cut, the data sector is rebuilt from it.
+ */
+static void Battery_Pack_Control_Unit_NVM_Recover(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Marker=MCU_Flash_Read_Word(BPCU_NVM_BACKUP_MARKER);
+	
+	memset(&Control_Unit->NVM, 0, sizeof(NVM_TypeDef));
+	if(Marker!=BPCU_NVM_BACKUP_VALID && Marker!=BPCU_NVM_BACKUP_COMMITTED)
+	{
+		return;
+	}
+	Control_Unit->NVM.Sequence=MCU_Flash_Read_Word(BPCU_NVM_BACKUP_SEQUENCE);
+	if(Marker!=BPCU_NVM_BACKUP_VALID)
+	{
+		return;
+	}
+	
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		NVM_Image[i]=MCU_Flash_Read_Word(MCU_ADDRESS_BOOTLOADER_DATA_BKUP+4*i);
+	}
+	if(Battery_Pack_Control_Unit_NVM_Checksum(NVM_Image,Control_Unit->NVM.Sequence)!=MCU_Flash_Read_Word(BPCU_NVM_BACKUP_CHECKSUM))
+	{
+		return;
+	}
+	
+	BoolTypeDef Match=TRUE;
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		if(MCU_Flash_Read_Word(Address_Bootloader_Stay_Condition+4*i)!=NVM_Image[i])
+		{
+			Match=FALSE;
+		}
+	}
+	if(Match==FALSE)
+	{
+		MCU_WDT_Refresh();
+		MCU_Flash_Erase_Sector(MCU_SECTOR_BOOTLOADER_DATA);
+		MCU_WDT_Refresh();
+		for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+		{
+			if(NVM_Image[i]!=0xFFFFFFFFU)
+			{
+				MCU_Flash_Program_Word(Address_Bootloader_Stay_Condition+4*i,NVM_Image[i]);
+			}
+		}
+		Control_Unit->NVM.Restores++;
+	}
+	MCU_Flash_Program_Word(BPCU_NVM_BACKUP_MARKER,BPCU_NVM_BACKUP_COMMITTED);
+}
+
+// Open from the frame of the master until BPCU_NVM_WINDOW_MS later
+static BoolTypeDef Battery_Pack_Control_Unit_NVM_Window(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->NVM.Window==TRUE && MCU_Get_Tick()-Control_Unit->NVM.Window_Tick>BPCU_NVM_WINDOW_MS)
+	{
+		Control_Unit->NVM.Window=FALSE;
+	}
+	return Control_Unit->NVM.Window;
+}
+
+/**
+ * @brief The only flash writer after startup: saves the calibration table and
+ * the activated sensors when they changed and no scan is running. Flash can
+ * only clear bits, those words are programmed in place at once. If any word
+ * needs a bit set the sector is rewritten through the backup copy, held
+ * until the master opens a write window.
+ */
+static void Battery_Pack_Control_Unit_NVM_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	const uint32_t Sensors_Word=(Address_APP_BPCU_Activated_Sensors-Address_Bootloader_Stay_Condition)/4;
+	const uint32_t Calibration_Word=(Address_APP_BPCU_Calibration-Address_Bootloader_Stay_Condition)/4;
+	BoolTypeDef Window=Battery_Pack_Control_Unit_NVM_Window(Control_Unit);
+	
+	if((Control_Unit->Calibration.Save_Pending==FALSE && Control_Unit->NVM.Sensors_Pending==FALSE && Control_Unit->NVM.Rewrite_Held==FALSE) ||
+		 Control_Unit->Status.Read_Temperatures!=IDLE)
+	{
+		return;
+	}
+	if(Control_Unit->NVM.Rewrite_Held==TRUE && Control_Unit->NVM.Sensors_Pending==FALSE && Window==FALSE)
+	{
+		return;
+	}
+	
+	// Cleared before the mask is read, a change arriving meanwhile saves again
+	Control_Unit->NVM.Sensors_Pending=FALSE;
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		NVM_Image[i]=MCU_Flash_Read_Word(Address_Bootloader_Stay_Condition+4*i);
+	}
+	// The activated sensors word is the complement of the disabled mask, bit for bit
+	NVM_Image[Sensors_Word]=(NVM_Image[Sensors_Word] & ~BPCU_CHANNEL_MASK) | (~Control_Unit->Status.Temperatures.Disabled & BPCU_CHANNEL_MASK);
+	if(Control_Unit->Calibration.Save_Pending==TRUE)
+	{
+		Calibration_Encode(&Control_Unit->Calibration,&NVM_Image[Calibration_Word]);
+	}
+	
+	BoolTypeDef Erase=FALSE;
+	for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+	{
+		uint32_t Stored=MCU_Flash_Read_Word(Address_Bootloader_Stay_Condition+4*i);
+		if((NVM_Image[i] & ~Stored)!=0)
+		{
+			Erase=TRUE;
+		}
+	}
+	
+	if(Erase==TRUE)
+	{
+		// The save stays pending, the image is built again in the window
+		if(Window==FALSE)
+		{
+			Control_Unit->NVM.Rewrite_Held=TRUE;
+			return;
+		}
+		Battery_Pack_Control_Unit_NVM_Rewrite(Control_Unit,NVM_Image);
+		Control_Unit->NVM.Window=FALSE;
+	}
+	else
+	{
+		for(uint32_t i=0; i<BPCU_NVM_WORDS; i++)
+		{
+			uint32_t Address=Address_Bootloader_Stay_Condition+4*i;
+			if(NVM_Image[i]!=MCU_Flash_Read_Word(Address))
+			{
+				MCU_Flash_Program_Word(Address,NVM_Image[i]);
+			}
+		}
+	}
+	
+	Control_Unit->NVM.Rewrite_Held=FALSE;
+	if(Control_Unit->Calibration.Save_Pending==TRUE)
+	{
+		Control_Unit->Calibration.Saves++;
+		Control_Unit->Calibration.Save_Pending=FALSE;
+	}
+}
+
+
 /*******************************************************************************
 ********************************************************************************
 ***************						 		  STATE MACHINE TASK       			   ***************	
@@ -226,6 +483,8 @@ void Battery_Pack_Control_State_Machine_Task(Control_Unit_TypeDef* Control_Unit)
 		break;
 		
 		case LTC6811_FAIL_MODE:
+			// Keeps the SPI traffic that led to the fault
+			CAPTURE_FREEZE();
 			Green_LED_Blink(Control_Unit,500);
 			Yellow_LED_Blink(Control_Unit,500);
 		break;
@@ -294,22 +553,237 @@ void CAN_Temp_Send_Interrupt_Task(Control_Unit_TypeDef* Control_Unit)
 
 /*******************************************************************************
 ********************************************************************************
-***************				Interrupt Task for Initialitation timer    ***************	
+***************								 Startup Ready        			 	   ***************	
 ********************************************************************************
 *******************************************************************************/
-void Initialitation_Tim_Interrupt_Task(Control_Unit_TypeDef* Control_Unit)
+/**
+ * @brief Enables the periodic frames and sends the first status frame right
+ * away, built from the first validated scan.
+ */
+static void Battery_Pack_Control_Startup_Ready(Control_Unit_TypeDef* Control_Unit)
 {
-	if(Control_Unit->Timing.Init_State_Timer.Overflowed==TRUE)
+	Control_Unit->Startup.Ready_Time=MCU_Get_Tick();
+	Timer_10ms_Start(&Control_Unit->Timing.Status_Send_Timer);
+	Timer_10ms_Start(&Control_Unit->Timing.Temp_Send_Timer);
+	Yellow_LED_Permanent_Off(Control_Unit);
+	
+	// The first scan may already have raised a temperature fail mode
+	if(Control_Unit->State==INIT)
 	{
-		Timer_10ms_Stop(&Control_Unit->Timing.Init_State_Timer);
-		Timer_10ms_Start(&Control_Unit->Timing.Status_Send_Timer);
-		Timer_10ms_Start(&Control_Unit->Timing.Temp_Send_Timer);
-		Yellow_LED_Permanent_Off(Control_Unit);
 		Control_Unit->State=NORMAL_OPERATION;
 	}
+	
+	Generate_Status_Message(Control_Unit);
+	CAN1_Send(&Control_Unit->Tx_Message);
+	Control_Unit->Startup.First_Frame_Time=MCU_Get_Tick();
+	
+	Generate_Startup_Message(Control_Unit);
+	CAN1_Send(&Control_Unit->Tx_Message);
+	Control_Unit->Startup.Step=STARTUP_DONE;
 }
 
 
+/*******************************************************************************
+********************************************************************************
+***************								 Startup Task        			 	   	 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Brings both LTC6811 up together and leaves INIT as soon as a first
+ * scan is validated. Each failed step restarts from the wake up, and
+ * BPCU_STARTUP_TIMEOUT_MS after boot the unit gives up in LTC6811_FAIL_MODE.
+ */
+void Battery_Pack_Control_Startup_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->State!=INIT || Control_Unit->Startup.Step==STARTUP_DONE)
+	{
+		return;
+	}
+	
+	uint32_t Now=MCU_Get_Tick();
+	
+	if(Now>=BPCU_STARTUP_TIMEOUT_MS)
+	{
+		if(Control_Unit->Startup.Step==STARTUP_FIRST_SCAN)
+		{
+			Power_Governor_Exit_Burst(Control_Unit);
+		}
+		Control_Unit->State=LTC6811_FAIL_MODE;
+		Control_Unit->Startup.Timed_Out=TRUE;
+		Control_Unit->Startup.Step=STARTUP_DONE;
+		Generate_Startup_Message(Control_Unit);
+		CAN1_Send(&Control_Unit->Tx_Message);
+		return;
+	}
+	
+	switch(Control_Unit->Startup.Step)
+	{
+		case STARTUP_WAKE:
+			Control_Unit->Status.LTC6811_1.Fail=FALSE;
+			Control_Unit->Status.LTC6811_2.Fail=FALSE;
+			Control_Unit->Startup.Attempts++;
+			LTC6811_Wake_Up_Pulse(&Control_Unit->Status.LTC6811_1);
+			LTC6811_Wake_Up_Pulse(&Control_Unit->Status.LTC6811_2);
+			Control_Unit->Startup.Step_Tick=Now;
+			Control_Unit->Startup.Step=STARTUP_CONFIG;
+		break;
+		
+		case STARTUP_CONFIG:
+			if(Now-Control_Unit->Startup.Step_Tick<LTC6811_WAKE_TIME_MS)
+			{
+				break;
+			}
+			LTC6811_Write_Default_Config(&Control_Unit->Status.LTC6811_1);
+			LTC6811_Write_Default_Config(&Control_Unit->Status.LTC6811_2);
+			if(Control_Unit->Status.LTC6811_1.Fail==TRUE || Control_Unit->Status.LTC6811_2.Fail==TRUE)
+			{
+				Control_Unit->Startup.Step=STARTUP_WAKE;
+			}
+			else
+			{
+				Power_Governor_Enter_Burst(Control_Unit);
+				LTC6811_Acquisition_Start(Control_Unit);
+				Control_Unit->Startup.Step=STARTUP_FIRST_SCAN;
+			}
+		break;
+		
+		case STARTUP_FIRST_SCAN:
+			switch(LTC6811_Acquisition_Task(Control_Unit))
+			{
+				case ACQUISITION_DONE:
+					Battery_Pack_Control_Unit_Check_Temperatures(Control_Unit);
+					Battery_Pack_Control_Check_Fails(Control_Unit);
+					Snapshot_Publish(Control_Unit);
+					Power_Governor_Exit_Burst(Control_Unit);
+					Battery_Pack_Control_Startup_Ready(Control_Unit);
+				break;
+				
+				case ACQUISITION_FAILED:
+					// The acquisition enters the fail mode on error, here the timeout decides
+					Control_Unit->State=INIT;
+					Control_Unit->Startup.Step=STARTUP_WAKE;
+					Power_Governor_Exit_Burst(Control_Unit);
+				break;
+				
+				default:
+				break;
+			}
+		break;
+		
+		default:
+		break;
+	}
+}
+
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************								 Recovery Task        			 	   	 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Brings the unit back from LTC6811_FAIL_MODE with the startup sequence:
+ * wake, default configuration and a full scan, every BPCU_RECOVERY_BACKOFF_MS
+ * until a scan passes. Records the attempts and the time spent in the fail mode.
+ */
+void Battery_Pack_Control_Recovery_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	Recovery_TypeDef* Recovery=&Control_Unit->Recovery;
+	uint32_t Now=MCU_Get_Tick();
+
+	if(Control_Unit->State!=LTC6811_FAIL_MODE)
+	{
+		Recovery->Step=RECOVERY_IDLE;
+		return;
+	}
+
+	switch(Recovery->Step)
+	{
+		case RECOVERY_IDLE:
+			Recovery->Fail_Tick=Now;
+			Recovery->Step_Tick=Now;
+			Recovery->Step=RECOVERY_BACKOFF;
+		break;
+
+		case RECOVERY_BACKOFF:
+			if(Now-Recovery->Step_Tick>=BPCU_RECOVERY_BACKOFF_MS)
+			{
+				Recovery->Step=RECOVERY_WAKE;
+			}
+		break;
+
+		case RECOVERY_WAKE:
+			Control_Unit->Status.LTC6811_1.Fail=FALSE;
+			Control_Unit->Status.LTC6811_2.Fail=FALSE;
+			Recovery->Attempts++;
+			LTC6811_Wake_Up_Pulse(&Control_Unit->Status.LTC6811_1);
+			LTC6811_Wake_Up_Pulse(&Control_Unit->Status.LTC6811_2);
+			Recovery->Step_Tick=Now;
+			Recovery->Step=RECOVERY_CONFIG;
+		break;
+
+		case RECOVERY_CONFIG:
+			if(Now-Recovery->Step_Tick<LTC6811_WAKE_TIME_MS)
+			{
+				break;
+			}
+			LTC6811_Write_Default_Config(&Control_Unit->Status.LTC6811_1);
+			LTC6811_Write_Default_Config(&Control_Unit->Status.LTC6811_2);
+			if(Control_Unit->Status.LTC6811_1.Fail==TRUE || Control_Unit->Status.LTC6811_2.Fail==TRUE)
+			{
+				Recovery->Step_Tick=Now;
+				Recovery->Step=RECOVERY_BACKOFF;
+			}
+			else
+			{
+				Power_Governor_Enter_Burst(Control_Unit);
+				LTC6811_Acquisition_Start(Control_Unit);
+				Recovery->Step=RECOVERY_SCAN;
+			}
+		break;
+
+		case RECOVERY_SCAN:
+		{
+			Acquisition_Step_TypeDef Acquisition=LTC6811_Acquisition_Task(Control_Unit);
+			if(Acquisition==ACQUISITION_DONE)
+			{
+				// Back to normal, the checks raise the temperature fail modes again if needed
+				Control_Unit->State=NORMAL_OPERATION;
+				Control_Unit->Status.Read_Temperatures=IDLE;
+				Battery_Pack_Control_Unit_Check_Temperatures(Control_Unit);
+				Battery_Pack_Control_Check_Fails(Control_Unit);
+				Snapshot_Publish(Control_Unit);
+
+				// A startup timeout never started the periodic frames
+				Timer_10ms_Start(&Control_Unit->Timing.Status_Send_Timer);
+				Timer_10ms_Start(&Control_Unit->Timing.Temp_Send_Timer);
+				Yellow_LED_Permanent_Off(Control_Unit);
+
+				Recovery->Recoveries++;
+				Recovery->Last_Time_To_Recover=MCU_Get_Tick()-Recovery->Fail_Tick;
+				if(Recovery->Last_Time_To_Recover>Recovery->Max_Time_To_Recover)
+				{
+					Recovery->Max_Time_To_Recover=Recovery->Last_Time_To_Recover;
+				}
+				Recovery->Step=RECOVERY_IDLE;
+				Power_Governor_Exit_Burst(Control_Unit);
+			}
+			else if(Acquisition==ACQUISITION_FAILED)
+			{
+				Recovery->Step_Tick=Now;
+				Recovery->Step=RECOVERY_BACKOFF;
+				Power_Governor_Exit_Burst(Control_Unit);
+			}
+		}
+		break;
+
+		default:
+			Recovery->Step=RECOVERY_IDLE;
+		break;
+	}
+}
 
 
 /*******************************************************************************
@@ -319,7 +793,6 @@ void Initialitation_Tim_Interrupt_Task(Control_Unit_TypeDef* Control_Unit)
 *******************************************************************************/
 void Battery_Pack_Control_Interrupt_Task(Control_Unit_TypeDef* Control_Unit)
 {
-	Initialitation_Tim_Interrupt_Task(Control_Unit);
 	CAN_Status_Send_Interrupt_Task(Control_Unit);
 	CAN_Temp_Send_Interrupt_Task(Control_Unit);
 	State_LEDs_Interrupt_Task(Control_Unit);
@@ -332,12 +805,15 @@ void Battery_Pack_Control_Interrupt_Task(Control_Unit_TypeDef* Control_Unit)
 ***************							 Timer 10ms Interrupt        		     ***************	
 ********************************************************************************
 *******************************************************************************/
+/**
+ * @brief The timers keep running during a scan: the acquisition no longer
+ * blocks the main loop and the frames are built from the published snapshot.
+ */
 void Battery_Pack_Control_Unit_10ms_Interrupt(Control_Unit_TypeDef* Control_Unit)
 {
-	if(Control_Unit->Status.Read_Temperatures!=READING && Control_Unit->State!=INIT && Control_Unit->State!=LTC6811_FAIL_MODE)
+	if(Control_Unit->State!=INIT && Control_Unit->State!=LTC6811_FAIL_MODE)
 	{
 		Timer_10ms_Tick(&Control_Unit->Timing.Status_Send_Timer);
-		Timer_10ms_Tick(&Control_Unit->Timing.Init_State_Timer);
 		Timer_10ms_Tick(&Control_Unit->Timing.Temp_Send_Timer);
 		State_LEDs_10ms_Tick(Control_Unit);
 	}
@@ -353,68 +829,72 @@ void Battery_Pack_Control_Unit_10ms_Interrupt(Control_Unit_TypeDef* Control_Unit
  * @brief Verifica y actualiza el estado de los sensores de temperatura de la unidad de control.
  *
  * Esta funcin recorre los 24 sensores de temperatura:
- * - Si la lectura ha cambiado significativamente (>0.5C), se actualiza el valor actual.
- * - Si hay un salto brusco y la lectura es extrema (>60C o <10C), se suaviza.
- * - Detecta fallos por temperatura fuera de rango repetida.
- * - Si un sensor est deshabilitado, se le asigna 25C fijo.
+ * - El filtro de cada canal (Filter_Engine, configurado en NVM) actualiza el valor actual.
+ *   El filtro por defecto ignora cambios de menos de 0.5C y suaviza los saltos
+ *   bruscos a valores extremos (>60C o <0C).
+ * - Detecta fallos por temperatura fuera de rango repetida en los canales actualizados.
+ * - Si un sensor est deshabilitado, se le asigna 107.5C fijo.
  */
 void Battery_Pack_Control_Unit_Check_Temperatures (Control_Unit_TypeDef* Control_Unit)
 {
-	for (uint8_t i = 0; i < 24; i++)
+	Temperatures_Typedef* Temperatures=&Control_Unit->Status.Temperatures;
+	uint32_t Updated=Filter_Engine_Run(&Control_Unit->Filter_Engine, Temperatures->Readed_Value, Temperatures->Actual_Value, Temperatures->Disabled);
+
+	Battery_Pack_Control_Unit_Check_Limits(Temperatures, Updated);
+}
+
+/**
+ * @brief Comprobacin de lmites sobre los valores ya filtrados. Updated son
+ * los canales que el filtro ha actualizado en este escaneo.
+ */
+void Battery_Pack_Control_Unit_Check_Limits(Temperatures_Typedef* Temperatures, uint32_t Updated)
+{
+	for (uint8_t i = 0; i < BPCU_CHANNELS; i++)
 	{
-		// Solo actualiza si la lectura cambi ms de 0.5C desde la ltima
-		if (fabsf(Control_Unit->Status.Temperatures[i].Readed_Value - Control_Unit->Status.Temperatures[i].Actual_Value) > 0.5f)
+		uint32_t Bit=1UL<<i;
+
+		if (Temperatures->Disabled & Bit)
 		{
-			// Si el sensor est habilitado
-			if (Control_Unit->Status.Temperatures[i].Disabled == FALSE)
+			// Sensor deshabilitado: se fuerza valor a 107.5C
+			if (fabsf(Temperatures->Readed_Value[i] - Temperatures->Actual_Value[i]) > 0.5f)
 			{
-				// Si el cambio es brusco (>10C) y adems el valor ledo es crtico
-				if (fabsf(Control_Unit->Status.Temperatures[i].Readed_Value - Control_Unit->Status.Temperatures[i].Actual_Value) > 5.0f &&
-				    (Control_Unit->Status.Temperatures[i].Readed_Value > 60.0f || Control_Unit->Status.Temperatures[i].Readed_Value < 0.0f))
-				{
-					// Suavizado: 70% valor anterior + 30% valor nuevo
-					float alpha = 0.1f;
-					Control_Unit->Status.Temperatures[i].Actual_Value =(1.0f - alpha) * Control_Unit->Status.Temperatures[i].Actual_Value + alpha * Control_Unit->Status.Temperatures[i].Readed_Value;
-				}
-				else
-				{
-					// Si el cambio es razonable, se toma el valor directamente
-					Control_Unit->Status.Temperatures[i].Actual_Value =Control_Unit->Status.Temperatures[i].Readed_Value;
-				}
+				Temperatures->Actual_Value[i] = 107.5f;
+			}
+			continue;
+		}
 
-				// Si la temperatura actual est fuera de rango permitido
-				if (Control_Unit->Status.Temperatures[i].Actual_Value > 60.0f || Control_Unit->Status.Temperatures[i].Actual_Value < 0.0f)
+		// Solo se comprueban los canales que el filtro ha actualizado
+		if ((Updated & Bit) == 0)
+		{
+			continue;
+		}
+
+		// Si la temperatura actual est fuera de rango permitido
+		if (Temperatures->Actual_Value[i] > 60.0f || Temperatures->Actual_Value[i] < 0.0f)
+		{
+			// Se permite hasta 3 errores antes de marcar fallo
+			if (Temperatures->Cont_Fail[i] <= 2)
+			{
+				Temperatures->Cont_Fail[i]++;
+			}
+			else
+			{
+				// Marca como Hot o Failed segn el extremo
+				if (Temperatures->Actual_Value[i] > 60.0f)
 				{
-					// Se permite hasta 3 errores antes de marcar fallo
-					if (Control_Unit->Status.Temperatures[i].Cont_Fail <= 2)
-					{
-						Control_Unit->Status.Temperatures[i].Cont_Fail++;
-					}
-					else
-					{
-						// Marca como Hot o Failed segn el extremo
-						if (Control_Unit->Status.Temperatures[i].Actual_Value > 60.0f)
-						{
-							Control_Unit->Status.Temperatures[i].Hot = TRUE;
-						}
-						else if (Control_Unit->Status.Temperatures[i].Actual_Value < 0.0f)
-						{
-							Control_Unit->Status.Temperatures[i].Failed = TRUE;
-						}
-					}
+					Temperatures->Hot |= Bit;
 				}
-				else
+				else if (Temperatures->Actual_Value[i] < 0.0f)
 				{
-					// Si la temperatura es normal, se limpian los flags de fallo
-					Control_Unit->Status.Temperatures[i].Failed = FALSE;
-					Control_Unit->Status.Temperatures[i].Hot = FALSE;
+					Temperatures->Failed |= Bit;
 				}
 			}
-			else
-			{
-				// Sensor deshabilitado: se fuerza valor a 25C
-				Control_Unit->Status.Temperatures[i].Actual_Value = 107.5f;
-			}
+		}
+		else
+		{
+			// Si la temperatura es normal, se limpian los flags de fallo
+			Temperatures->Failed &= ~Bit;
+			Temperatures->Hot &= ~Bit;
 		}
 	}
 }
@@ -426,32 +906,73 @@ void Battery_Pack_Control_Unit_Check_Temperatures (Control_Unit_TypeDef* Control
 *******************************************************************************/
 void Battery_Pack_Control_Check_Fails(Control_Unit_TypeDef* Control_Unit)
 {
-	Control_Unit->Status.Temperatures_Failed=0;
-	Control_Unit->Status.Temperatures_Hot=0;
-	for (uint8_t i = 0; i < 24; i++)
+	Battery_Pack_Control_Count_Fails(&Control_Unit->Status, &Control_Unit->State);
+}
+
+void Battery_Pack_Control_Count_Fails(Control_Unit_Status_Typdef* Status, Control_Unit_State_Typdef* State)
+{
+	Status->Temperatures_Failed=Popcount(Status->Temperatures.Failed);
+	Status->Temperatures_Hot=Popcount(Status->Temperatures.Hot);
+	
+	if(Status->Temperatures_Hot>0 && Status->Temperatures_Hot > Status->Temperatures_Failed)
 	{
-		if(Control_Unit->Status.Temperatures[i].Hot==TRUE)
-		{
-				Control_Unit->Status.Temperatures_Hot++;
-		}
-		if(Control_Unit->Status.Temperatures[i].Failed==TRUE)
-		{
-			Control_Unit->Status.Temperatures_Failed++;
-		}
+		*State=TEMP_PLUS_60_FAIL_MODE;
 	}
 	
-	if(Control_Unit->Status.Temperatures_Hot>0 && Control_Unit->Status.Temperatures_Hot > Control_Unit->Status.Temperatures_Failed)
+	if(Status->Temperatures_Failed>0 && Status->Temperatures_Failed > Status->Temperatures_Hot)
 	{
-		Control_Unit->State=TEMP_PLUS_60_FAIL_MODE;
+		*State=TEMP_FAIL_MODE;
 	}
+
+}
 	
-	if(Control_Unit->Status.Temperatures_Failed>0 && Control_Unit->Status.Temperatures_Failed > Control_Unit->Status.Temperatures_Hot)
+
+/*******************************************************************************
+********************************************************************************
+***************									 Check Invariants       			 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Checks the state fields written from CAN frames and from the checks
+ * are within their ranges. Violations are counted for the diagnostics, the
+ * state machine is left as it is.
+ */
+void Battery_Pack_Control_Unit_Check_Invariants(Control_Unit_TypeDef* Control_Unit)
+{
+	uint8_t Failed=0;
+
+	if(Control_Unit->State>TEMP_PLUS_60_FAIL_MODE)
+	{
+		Failed|=BPCU_INVARIANT_STATE;
+	}
+	if(Control_Unit->Status.Read_Temperatures>READING)
+	{
+		Failed|=BPCU_INVARIANT_READ_STATUS;
+	}
+	if(Control_Unit->Status.Temperatures_Hot>BPCU_CHANNELS || Control_Unit->Status.Temperatures_Failed>BPCU_CHANNELS)
 	{
-		Control_Unit->State=TEMP_FAIL_MODE;
+		Failed|=BPCU_INVARIANT_FAIL_COUNT;
+	}
+	if(((Control_Unit->Status.Temperatures.Disabled | Control_Unit->Status.Temperatures.Hot |
+		  Control_Unit->Status.Temperatures.Failed | Control_Unit->Status.Temperatures.Stale) & ~BPCU_CHANNEL_MASK)!=0)
+	{
+		Failed|=BPCU_INVARIANT_SENSOR;
+	}
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		if(Control_Unit->Status.Temperatures.Cont_Fail[i]>3)
+		{
+			Failed|=BPCU_INVARIANT_SENSOR;
+		}
 	}
 
+	if(Failed!=0)
+	{
+		Control_Unit->Diagnostics.Invariant_Violations++;
+		Control_Unit->Diagnostics.Invariant_Last=Failed;
+	}
 }
-	
+
 
 /*******************************************************************************
 ********************************************************************************
@@ -463,20 +984,45 @@ void Battery_Pack_Control_Read_Task(Control_Unit_TypeDef* Control_Unit)
 	if(Control_Unit->Status.Read_Temperatures==READ_RECEIVED && Control_Unit->State!=INIT && Control_Unit->State!=LTC6811_FAIL_MODE)
 	{
 		Control_Unit->Status.Read_Temperatures=READING;
-		LTC6811_Measure_Temperatures_and_Voltages(Control_Unit);
-		if(Control_Unit->Status.LTC6811_1.Fail==FALSE && Control_Unit->Status.LTC6811_2.Fail==FALSE)
-		{
+		
+		// Acquisition, PEC checking and filtering run on the high speed clock
+		Power_Governor_Enter_Burst(Control_Unit);
+		LTC6811_Acquisition_Start(Control_Unit);
+	}
+	
+	if(Control_Unit->Status.Read_Temperatures!=READING)
+	{
+		return;
+	}
+	
+	// One step per main loop pass, the acquisition waits do not block
+	switch(LTC6811_Acquisition_Task(Control_Unit))
+	{
+		case ACQUISITION_DONE:
 			Battery_Pack_Control_Unit_Check_Temperatures(Control_Unit);
 			Battery_Pack_Control_Check_Fails(Control_Unit);
-			Generate_Finish_Message(Control_Unit);
-			CAN1_Send(&Control_Unit->Tx_Message);
+			Snapshot_Publish(Control_Unit);
+			// Local scans are silent unless the master asked for one meanwhile
+			if(Control_Unit->Scan_Scheduler.Local_Scan==FALSE || Control_Unit->Scan_Scheduler.Remote_Request==TRUE)
+			{
+				Generate_Finish_Message(Control_Unit);
+				CAN1_Send(&Control_Unit->Tx_Message);
+			}
+			Control_Unit->Scan_Scheduler.Local_Scan=FALSE;
+			Control_Unit->Scan_Scheduler.Remote_Request=FALSE;
 			Control_Unit->Status.Read_Temperatures=IDLE;
-		}
-		else
-		{
+			Power_Governor_Exit_Burst(Control_Unit);
+		break;
+		
+		case ACQUISITION_FAILED:
+			Control_Unit->Scan_Scheduler.Local_Scan=FALSE;
+			Control_Unit->Scan_Scheduler.Remote_Request=FALSE;
 			Control_Unit->Status.Read_Temperatures=IDLE;
-		}
+			Power_Governor_Exit_Burst(Control_Unit);
+		break;
 		
+		default:
+		break;
 	}
 }
 
@@ -489,10 +1035,22 @@ void Battery_Pack_Control_Unit_Main_Task(Control_Unit_TypeDef* Control_Unit)
 {
 	State_LEDs_Task(&Control_Unit->Yellow_Led);
 	State_LEDs_Task(&Control_Unit->Green_Led);
+	Battery_Pack_Control_Startup_Task(Control_Unit);
+	Battery_Pack_Control_Recovery_Task(Control_Unit);
 	Battery_Pack_Control_Read_Task(Control_Unit);
 	Battery_Pack_Control_Unit_WDT_Task();
 	Battery_Pack_Control_State_Machine_Task(Control_Unit);
 	Battery_Pack_Control_Interrupt_Task(Control_Unit);
+	Diagnostics_Task(Control_Unit);
+	Scan_Scheduler_Task(Control_Unit);
+	Balancing_Task(Control_Unit);
+	Open_Wire_Task(Control_Unit);
+	Self_Test_Task(Control_Unit);
+	Calibration_Task(Control_Unit);
+	Battery_Pack_Control_Unit_NVM_Task(Control_Unit);
+	CAN1_Tx_Task();
+	CAN1_Bus_Load_Task();
+	Battery_Pack_Control_Unit_Check_Invariants(Control_Unit);
 }
 
 	
@@ -500,151 +1058,41 @@ void Battery_Pack_Control_Unit_Main_Task(Control_Unit_TypeDef* Control_Unit)
 
 /*******************************************************************************
 ********************************************************************************
-***************										Cancel Sensors 1        		   ***************	
-********************************************************************************
-*******************************************************************************/
-void Battery_Pack_Control_Unit_Cancel_Sensors_1 (Control_Unit_TypeDef* Control_Unit)
-{
-	BoolTypeDef Changed=FALSE;
-	for(uint8_t i=0; i<8;i++)
-	{
-		if (Control_Unit->Rx_Message.Data[i]==0x01)
-		{
-			Control_Unit->Status.Temperatures[i].Disabled=FALSE;
-			Changed=TRUE;
-		}
-		
-		if (Control_Unit->Rx_Message.Data[i]==0x02)
-		{
-				Control_Unit->Status.Temperatures[i].Disabled=TRUE;
-				Changed=TRUE;
-		}
-	}
-	
-	if(Changed==TRUE)
-	{
-			uint32_t Activated_Sensors= MCU_Flash_Read_Word(Address_APP_BPCU_Activated_Sensors);
-			uint32_t New_Activated_Sensors= Activated_Sensors;
-			for(uint8_t i=0; i<24 ; i++)
-			{
-					uint8_t bit_state = (Activated_Sensors >> i) & 0x01;
-					if(bit_state== 0x00 && Control_Unit->Status.Temperatures[i].Disabled==0x00)
-					{
-							//cambiar el bit i de 0 a 1
-							New_Activated_Sensors |= (1UL << i);
-
-					}
-					else 	if(bit_state== 0x01 && Control_Unit->Status.Temperatures[i].Disabled==0x01)
-					{
-							//cambiar el bit i de 1 a 0
-							New_Activated_Sensors &= ~(1UL << i);
-					}
-			}
-			// Si cambi el contenido, graba nueva configuracin en Flash
-      if (New_Activated_Sensors != Activated_Sensors)
-      {
-            MCU_Flash_Program_Word(Address_APP_BPCU_Activated_Sensors, New_Activated_Sensors);
-      }
-	}
-}
-
-/*******************************************************************************
-********************************************************************************
-***************										Cancel Sensors 2        		   ***************	
+***************										Cancel Sensors        		   ***************	
 ********************************************************************************
 *******************************************************************************/
-void Battery_Pack_Control_Unit_Cancel_Sensors_2 (Control_Unit_TypeDef* Control_Unit)
+/**
+ * @brief Enables (0x01) or disables (0x02) the BPCU_CANCEL_SENSORS_PER_FRAME
+ * sensors starting at First_Sensor, one data byte each, other values leave the
+ * sensor as it is. The enabled sensors are kept in flash.
+ */
+static void Battery_Pack_Control_Unit_Cancel_Sensors (Control_Unit_TypeDef* Control_Unit, uint8_t First_Sensor)
 {
-	BoolTypeDef Changed=FALSE;
-	for(uint8_t i=0; i<8;i++)
+	if(First_Sensor+BPCU_CANCEL_SENSORS_PER_FRAME>BPCU_CHANNELS)
 	{
-		if (Control_Unit->Rx_Message.Data[i]==0x01)
-		{
-			Control_Unit->Status.Temperatures[i+8].Disabled=FALSE;
-			Changed=TRUE;
-		}
-		
-		if (Control_Unit->Rx_Message.Data[i]==0x02)
-		{
-				Control_Unit->Status.Temperatures[i+8].Disabled=TRUE;
-				Changed=TRUE;
-		}
-	}
-	
-	if(Changed==TRUE)
-	{
-			uint32_t Activated_Sensors= MCU_Flash_Read_Word(Address_APP_BPCU_Activated_Sensors);
-			uint32_t New_Activated_Sensors= Activated_Sensors;
-			for(uint8_t i=0; i<24 ; i++)
-			{
-					uint8_t bit_state = (Activated_Sensors >> i) & 0x01;
-					if(bit_state== 0x00 && Control_Unit->Status.Temperatures[i].Disabled==0x00)
-					{
-							//cambiar el bit i de 0 a 1
-							New_Activated_Sensors |= (1UL << i);
-
-					}
-					else 	if(bit_state== 0x01 && Control_Unit->Status.Temperatures[i].Disabled==0x01)
-					{
-							//cambiar el bit i de 1 a 0
-							New_Activated_Sensors &= ~(1UL << i);
-					}
-			}
-			// Si cambi el contenido, graba nueva configuracin en Flash
-      if (New_Activated_Sensors != Activated_Sensors)
-      {
-            MCU_Flash_Program_Word(Address_APP_BPCU_Activated_Sensors, New_Activated_Sensors);
-      }
+		return;
 	}
-}
 
-/*******************************************************************************
-********************************************************************************
-***************										Cancel Sensors 3        		   ***************	
-********************************************************************************
-*******************************************************************************/
-void Battery_Pack_Control_Unit_Cancel_Sensors_3 (Control_Unit_TypeDef* Control_Unit)
-{
 	BoolTypeDef Changed=FALSE;
-	for(uint8_t i=0; i<8;i++)
+	for(uint8_t i=0; i<BPCU_CANCEL_SENSORS_PER_FRAME;i++)
 	{
 		if (Control_Unit->Rx_Message.Data[i]==0x01)
 		{
-			Control_Unit->Status.Temperatures[i+16].Disabled=FALSE;
+			Control_Unit->Status.Temperatures.Disabled&=~(1UL<<(First_Sensor+i));
 			Changed=TRUE;
 		}
 		
 		if (Control_Unit->Rx_Message.Data[i]==0x02)
 		{
-				Control_Unit->Status.Temperatures[i+16].Disabled=TRUE;
+				Control_Unit->Status.Temperatures.Disabled|=1UL<<(First_Sensor+i);
 				Changed=TRUE;
 		}
 	}
 	
+	// Flash is written by the NVM task only, never from the deferred work
 	if(Changed==TRUE)
 	{
-			uint32_t Activated_Sensors= MCU_Flash_Read_Word(Address_APP_BPCU_Activated_Sensors);
-			uint32_t New_Activated_Sensors= Activated_Sensors;
-			for(uint8_t i=0; i<24 ; i++)
-			{
-					uint8_t bit_state = (Activated_Sensors >> i) & 0x01;
-					if(bit_state== 0 && Control_Unit->Status.Temperatures[i].Disabled==FALSE)
-					{
-							//cambiar el bit i de 0 a 1
-							New_Activated_Sensors |= (1UL << i);
-
-					}
-					else 	if(bit_state== 1 && Control_Unit->Status.Temperatures[i].Disabled==0x01)
-					{
-							//cambiar el bit i de 1 a 0
-							New_Activated_Sensors &= ~(1UL << i);
-					}
-			}
-			// Si cambi el contenido, graba nueva configuracin en Flash
-      if (New_Activated_Sensors != Activated_Sensors)
-      {
-            MCU_Flash_Program_Word(Address_APP_BPCU_Activated_Sensors, New_Activated_Sensors);
-      }
+		Control_Unit->NVM.Sensors_Pending=TRUE;
 	}
 }
 
@@ -663,13 +1111,21 @@ void Battery_Pack_Control_Unit_CAN1_Interrupt(Control_Unit_TypeDef* Control_Unit
 			{
 				Control_Unit->Status.Read_Temperatures=READ_RECEIVED;
 			}
+			else if(Control_Unit->Status.Read_Temperatures!=IDLE && Control_Unit->Scan_Scheduler.Local_Scan==TRUE)
+			{
+				Control_Unit->Scan_Scheduler.Remote_Request=TRUE;
+			}
+			else if(Control_Unit->State==LTC6811_FAIL_MODE)
+			{
+				Control_Unit->Recovery.Missed_Scans++;
+			}
 		break;
 			
 			
 		case BPCU_CANCEL_SENSOR_1_DEF:
 			if(Control_Unit->Rx_Message.Header.DLC==0x08)
 			{
-				Battery_Pack_Control_Unit_Cancel_Sensors_1(Control_Unit);
+				Battery_Pack_Control_Unit_Cancel_Sensors(Control_Unit,0*BPCU_CANCEL_SENSORS_PER_FRAME);
 			}
 		break;
 			
@@ -677,7 +1133,7 @@ void Battery_Pack_Control_Unit_CAN1_Interrupt(Control_Unit_TypeDef* Control_Unit
 		case BPCU_CANCEL_SENSOR_2_DEF:
 			if(Control_Unit->Rx_Message.Header.DLC==0x08)
 			{
-				Battery_Pack_Control_Unit_Cancel_Sensors_2(Control_Unit);
+				Battery_Pack_Control_Unit_Cancel_Sensors(Control_Unit,1*BPCU_CANCEL_SENSORS_PER_FRAME);
 			}
 		break;
 			
@@ -685,7 +1141,31 @@ void Battery_Pack_Control_Unit_CAN1_Interrupt(Control_Unit_TypeDef* Control_Unit
 		case BPCU_CANCEL_SENSOR_3_DEF:
 			if(Control_Unit->Rx_Message.Header.DLC==0x08)
 			{
-				Battery_Pack_Control_Unit_Cancel_Sensors_3(Control_Unit);
+				Battery_Pack_Control_Unit_Cancel_Sensors(Control_Unit,2*BPCU_CANCEL_SENSORS_PER_FRAME);
+			}
+		break;
+			
+			
+		case BPCU_DIAG_REQUEST_DEF:
+			Diagnostics_Request(Control_Unit);
+		break;
+			
+			
+		case BPCU_CALIBRATION_DEF:
+			Calibration_Request(Control_Unit);
+		break;
+			
+			
+		case BPCU_BALANCING_COMMAND_DEF:
+			Balancing_Command(Control_Unit);
+		break;
+			
+			
+		case BPCU_NVM_WINDOW_DEF:
+			if(Control_Unit->Rx_Message.Header.DLC==0x01 && Control_Unit->Rx_Message.Data[0]==0x01)
+			{
+				Control_Unit->NVM.Window_Tick=MCU_Get_Tick();
+				Control_Unit->NVM.Window=TRUE;
 			}
 		break;
 
@@ -32,10 +32,40 @@
 #include "State_LEDs.h"
 #include "Can_Bus.h"
 #include "LTC6811.h"
+#include "Power_Governor.h"
+#include "Diagnostics.h"
+#include "Snapshot.h"
+#include "Fault_Injection.h"
+#include "Scan_Scheduler.h"
+#include "Filter_Engine.h"
+#include "Calibration.h"
+#include "Balancing.h"
+#include "Open_Wire.h"
+#include "Self_Test.h"
+#include "Sum_Check.h"
 #include "MCU.h"
 #include <math.h>
 
-#define STM32F4_MCU
+// The host build selects its own backend with HOST_MCU
+#ifndef HOST_MCU
+	#define STM32F4_MCU
+#endif
+
+// INIT gives up and enters LTC6811_FAIL_MODE this long after boot
+#define BPCU_STARTUP_TIMEOUT_MS 1000
+
+// LTC6811_FAIL_MODE retries the wake, configuration and scan sequence this often
+#define BPCU_RECOVERY_BACKOFF_MS 200
+
+
+// Each cancel sensors frame carries one byte per sensor
+#define BPCU_CANCEL_SENSORS_PER_FRAME 8
+
+// Bits of the last failed invariant check
+#define BPCU_INVARIANT_STATE					0x01
+#define BPCU_INVARIANT_READ_STATUS		0x02
+#define BPCU_INVARIANT_FAIL_COUNT			0x04
+#define BPCU_INVARIANT_SENSOR					0x08
 
 /*******************************************************************************
 ********************************************************************************
@@ -53,6 +83,7 @@ void Battery_Pack_Control_Unit_Init(Control_Unit_TypeDef* Control_Unit);
 *******************************************************************************/
 void Generate_Status_Message(Control_Unit_TypeDef* Control_Unit);
 void Generate_Temp_Message(Control_Unit_TypeDef* Control_Unit);
+void Generate_Startup_Message(Control_Unit_TypeDef* Control_Unit);
 
 
 /*******************************************************************************
@@ -62,6 +93,13 @@ void Generate_Temp_Message(Control_Unit_TypeDef* Control_Unit);
 *******************************************************************************/
 void Battery_Pack_Control_Unit_WDT_Task(void);
 void Battery_Pack_Control_State_Machine_Task(Control_Unit_TypeDef* Control_Unit);
+void Battery_Pack_Control_Startup_Task(Control_Unit_TypeDef* Control_Unit);
+void Battery_Pack_Control_Recovery_Task(Control_Unit_TypeDef* Control_Unit);
+void Battery_Pack_Control_Unit_Check_Temperatures(Control_Unit_TypeDef* Control_Unit);
+void Battery_Pack_Control_Unit_Check_Limits(Temperatures_Typedef* Temperatures, uint32_t Updated);
+void Battery_Pack_Control_Check_Fails(Control_Unit_TypeDef* Control_Unit);
+void Battery_Pack_Control_Count_Fails(Control_Unit_Status_Typdef* Status, Control_Unit_State_Typdef* State);
+void Battery_Pack_Control_Unit_Check_Invariants(Control_Unit_TypeDef* Control_Unit);
 	
 
 /*******************************************************************************
@@ -72,7 +110,6 @@ void Battery_Pack_Control_State_Machine_Task(Control_Unit_TypeDef* Control_Unit)
 void CAN_Status_Send_Interrupt_Task(Control_Unit_TypeDef* Control_Unit);
 void CAN_Temp_Send_Interrupt_Task(Control_Unit_TypeDef* Control_Unit);
 void CAN_Temp_Timeout_Interrupt_Task(Control_Unit_TypeDef* Control_Unit);
-void Initialitation_Tim_Interrupt_Task(Control_Unit_TypeDef* Control_Unit);
 void Battery_Pack_Control_Interrupt_Task(Control_Unit_TypeDef* Control_Unit);
 void Battery_Pack_Control_Unit_10ms_Interrupt(Control_Unit_TypeDef* Control_Unit);
 
@@ -112,10 +149,34 @@ typedef enum
 	Address_APP0_CRC 										= (0x08004000U + 16),
 	Address_APP0_Code_Length						= (0x08004000U + 20),
 	
-	Address_APP_BPCU_Activated_Sensors  = (0x08004000U +24) 
+	Address_APP_BPCU_Activated_Sensors  = (0x08004000U +24),
+	Address_APP_BPCU_Filter_Config			= (0x08004000U +28),	//FILTER_CONFIG_WORDS words
+	Address_APP_BPCU_Calibration				= (0x08004000U +68),	//CALIBRATION_WORDS words
+	Address_APP_BPCU_Open_Wire_Period		= (0x08004000U +288),	//s
+	Address_APP_BPCU_Sum_Check_Tolerance	= (0x08004000U +292),	//mV
+	Address_APP_BPCU_Scan_Period_Slow		= (0x08004000U +296),	//ms
+	Address_APP_BPCU_Scan_Period_Fast		= (0x08004000U +300)	//ms
 	
 } Device_Addresses_Enum;
 
+// Words from the start of the sector to the last one in use, all of them are
+// rewritten when saving needs an erase
+#define BPCU_NVM_WORDS	((Address_APP_BPCU_Scan_Period_Fast-Address_Bootloader_Stay_Condition)/4+1)
+
+// Copy of those words in MCU_ADDRESS_BOOTLOADER_DATA_BKUP at the same offsets,
+// followed by its sequence, checksum and marker. The marker is programmed last
+#define BPCU_NVM_BACKUP_SEQUENCE	(MCU_ADDRESS_BOOTLOADER_DATA_BKUP+4*BPCU_NVM_WORDS)
+#define BPCU_NVM_BACKUP_CHECKSUM	(BPCU_NVM_BACKUP_SEQUENCE+4)
+#define BPCU_NVM_BACKUP_MARKER		(BPCU_NVM_BACKUP_SEQUENCE+8)
+#define BPCU_NVM_BACKUP_VALID			0x4E564D31U		//Copy complete, the data sector may not be
+#define BPCU_NVM_BACKUP_COMMITTED	0x00000000U		//Data sector rewritten, the copy is stale
+
+// A rewrite erases two sectors, the core stalls on every flash fetch for
+// about a second and the unit misses the bus meanwhile. It only runs in a
+// write window the master opens with BPCU_NVM_WINDOW_DEF (Data[0]=0x01)
+// once it stays off the unit, and the window closes after this long
+#define BPCU_NVM_WINDOW_MS				1000U
+
 #endif
 	/*****************************************************************************
 	** 																END OF FILE																**			
@@ -33,10 +33,13 @@
 #define BATTERY_PACK_CONTROL_UNIT
 
 #ifdef BATTERY_PACK_CONTROL_UNIT
-	#define BATTERY_PACK_CONTROL_UNIT_1
 	//#define BATTERY_PACK_CONTROL_UNIT_2
 	//#define BATTERY_PACK_CONTROL_UNIT_3
 	//#define BATTERY_PACK_CONTROL_UNIT_4
+	// Unit 1 unless another one is selected here or by the build (host images)
+	#if !defined(BATTERY_PACK_CONTROL_UNIT_1) && !defined(BATTERY_PACK_CONTROL_UNIT_2) && !defined(BATTERY_PACK_CONTROL_UNIT_3) && !defined(BATTERY_PACK_CONTROL_UNIT_4)
+		#define BATTERY_PACK_CONTROL_UNIT_1
+	#endif
 #endif
 
 
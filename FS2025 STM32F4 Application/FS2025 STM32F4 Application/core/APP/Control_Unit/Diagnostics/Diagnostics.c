@@ -0,0 +1,655 @@
+/**
+  ******************************************************************************
+  * @file           : Diagnostics.c
+  * @brief          : Diagnostic request/response
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Diagnostics.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Diagnostics Init      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+void Diagnostics_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	memset(&Control_Unit->Diagnostics, 0, sizeof(Diagnostics_TypeDef));
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Diagnostics Request      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Latches a request received by the deferred CAN dispatch, it is
+ * answered from the main task. Requests arriving before the previous one is
+ * answered are dropped.
+ */
+void Diagnostics_Request(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->Diagnostics.Pending==TRUE || Control_Unit->Rx_Message.Header.DLC==0 || Control_Unit->Rx_Message.Header.DLC>8)
+	{
+		return;
+	}
+
+	memset(Control_Unit->Diagnostics.Request, 0, sizeof(Control_Unit->Diagnostics.Request));
+	memcpy(Control_Unit->Diagnostics.Request, Control_Unit->Rx_Message.Data, Control_Unit->Rx_Message.Header.DLC);
+	Control_Unit->Diagnostics.Request_DLC=Control_Unit->Rx_Message.Header.DLC;
+	Control_Unit->Diagnostics.Pending=TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Response Helpers      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Positive(Control_Unit_TypeDef* Control_Unit, uint32_t Value)
+{
+	Control_Unit->Tx_Message.ID=BPCU_DIAG_RESPONSE_DEF;
+	Control_Unit->Tx_Message.DLC=8;
+	Control_Unit->Tx_Message.Data[0]=Control_Unit->Diagnostics.Request[0];
+	Control_Unit->Tx_Message.Data[1]=Control_Unit->Diagnostics.Request[1];
+	Control_Unit->Tx_Message.Data[2]=Control_Unit->Diagnostics.Request[2];
+	Control_Unit->Tx_Message.Data[3]=(uint8_t)(Value);
+	Control_Unit->Tx_Message.Data[4]=(uint8_t)(Value>>8);
+	Control_Unit->Tx_Message.Data[5]=(uint8_t)(Value>>16);
+	Control_Unit->Tx_Message.Data[6]=(uint8_t)(Value>>24);
+	Control_Unit->Tx_Message.Data[7]=(uint8_t)MCU_Get_Core_Clock_MHz();
+}
+
+static void Diagnostics_Negative(Control_Unit_TypeDef* Control_Unit, uint8_t Reason)
+{
+	Control_Unit->Tx_Message.ID=BPCU_DIAG_RESPONSE_DEF;
+	Control_Unit->Tx_Message.DLC=3;
+	Control_Unit->Tx_Message.Data[0]=DIAG_NEGATIVE_RESPONSE;
+	Control_Unit->Tx_Message.Data[1]=Control_Unit->Diagnostics.Request[0];
+	Control_Unit->Tx_Message.Data[2]=Reason;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Profiler Service      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Profiler(Control_Unit_TypeDef* Control_Unit)
+{
+	Profiler_Entry_TypeDef Entry=(Profiler_Entry_TypeDef)Control_Unit->Diagnostics.Request[1];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+	const Profiler_Record_TypeDef* Record=Profiler_Get(Entry);
+
+	if(Record==NULL)
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+		return;
+	}
+
+	if(Page==DIAG_PROFILER_PAGE_RESET)
+	{
+		Profiler_Reset(Entry);
+		Diagnostics_Positive(Control_Unit,0);
+	}
+	else if(Page==DIAG_PROFILER_PAGE_COUNT)
+	{
+		Diagnostics_Positive(Control_Unit,Record->Count);
+	}
+	else if(Page==DIAG_PROFILER_PAGE_MAX)
+	{
+		Diagnostics_Positive(Control_Unit,Record->Max);
+	}
+	else if(Page==DIAG_PROFILER_PAGE_LAST)
+	{
+		Diagnostics_Positive(Control_Unit,Record->Last);
+	}
+	else if(Page>=DIAG_PROFILER_PAGE_HISTOGRAM && Page<DIAG_PROFILER_PAGE_HISTOGRAM+PROFILER_BUCKETS/2)
+	{
+		uint8_t Bucket=(Page-DIAG_PROFILER_PAGE_HISTOGRAM)*2;
+		Diagnostics_Positive(Control_Unit,Record->Histogram[Bucket] | ((uint32_t)Record->Histogram[Bucket+1]<<16));
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Power Governor Service      	   ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Power_Governor(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_GOVERNOR_PAGES];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	Power_Governor_Update_Counters(Control_Unit);
+	Values[0]=Control_Unit->Power_Governor.Time_Low_Power;
+	Values[1]=Control_Unit->Power_Governor.Time_High_Speed;
+	Values[2]=Control_Unit->Power_Governor.Switch_Count;
+	Values[3]=Control_Unit->Power_Governor.Last_Switch_Latency;
+	Values[4]=Control_Unit->Power_Governor.Max_Switch_Latency;
+
+	if(Page<DIAG_GOVERNOR_PAGES)
+	{
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								CAN Service      	   					 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_CAN(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_CAN_PAGES];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	const CAN_Bus_Statistics_TypeDef* Statistics=CAN1_Get_Statistics();
+
+	Values[0]=CAN1_Rx_Overflows();
+	Values[1]=Statistics->Tx_Frames;
+	Values[2]=Statistics->Rx_Frames;
+	Values[3]=Statistics->Tx_Bits;
+	Values[4]=Statistics->Rx_Bits;
+	Values[5]=Statistics->Load;
+	Values[6]=Statistics->Peak_Load;
+	Values[7]=Statistics->Rx_Rejected;
+	Values[8]=Statistics->Tx_Dropped;
+	Values[9]=Statistics->Tx_Queue_Peak;
+	Values[10]=Statistics->Rx_Read_Errors;
+
+	if(Page<DIAG_CAN_PAGES)
+	{
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Benchmark Service      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Benchmark(Control_Unit_TypeDef* Control_Unit)
+{
+	Benchmark_Kernel_TypeDef Kernel=(Benchmark_Kernel_TypeDef)Control_Unit->Diagnostics.Request[1];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	if(Kernel>=BENCHMARK_KERNELS)
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+		return;
+	}
+
+	if(Page==DIAG_BENCHMARK_PAGE_RUN)
+	{
+		Benchmark_Run(Control_Unit,Kernel);
+		Diagnostics_Positive(Control_Unit,Benchmark_Get(Kernel)->Min);
+		return;
+	}
+
+	const Benchmark_Result_TypeDef* Result=Benchmark_Get(Kernel);
+	uint32_t Values[DIAG_BENCHMARK_PAGES];
+
+	Values[0]=Result->Runs;
+	Values[1]=Result->Min;
+	Values[2]=Result->Max;
+	Values[3]=(Result->Runs!=0) ? Result->Total/Result->Runs : 0;
+	Values[4]=Result->Clock_MHz;
+
+	if(Page<DIAG_BENCHMARK_PAGES)
+	{
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Capture Service      	  	   	 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Dumps the capture ring one 32 bit word per request. The first read of
+ * a record freezes the ring, so the dump responses do not overwrite it.
+ */
+static void Diagnostics_Capture(Control_Unit_TypeDef* Control_Unit)
+{
+	uint8_t Index=Control_Unit->Diagnostics.Request[1];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	if(Page==DIAG_CAPTURE_PAGE_CLEAR)
+	{
+		Capture_Init();
+		Diagnostics_Positive(Control_Unit,0);
+	}
+	else if(Page==DIAG_CAPTURE_PAGE_COUNT)
+	{
+		Diagnostics_Positive(Control_Unit,Capture_Count());
+	}
+	else if(Page==DIAG_CAPTURE_PAGE_TOTAL)
+	{
+		Diagnostics_Positive(Control_Unit,Capture_Total());
+	}
+	else if(Page<DIAG_CAPTURE_PAGE_WORDS)
+	{
+		Capture_Freeze();
+		const Capture_Record_TypeDef* Record=Capture_Get(Index);
+		if(Record==NULL)
+		{
+			Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+			return;
+		}
+
+		uint32_t Values[DIAG_CAPTURE_PAGE_WORDS];
+		Values[0]=Record->Timestamp;
+		Values[1]=Record->Source | ((uint32_t)Record->Flags<<8) | ((uint32_t)Record->Id<<16);
+		Values[2]=Record->Data[0] | ((uint32_t)Record->Data[1]<<8) | ((uint32_t)Record->Data[2]<<16) | ((uint32_t)Record->Data[3]<<24);
+		Values[3]=Record->Data[4] | ((uint32_t)Record->Data[5]<<8) | ((uint32_t)Record->Data[6]<<16) | ((uint32_t)Record->Data[7]<<24);
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Invariants Service      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Invariants(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_INVARIANT_PAGES];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	Values[0]=Control_Unit->Diagnostics.Invariant_Violations;
+	Values[1]=Control_Unit->Diagnostics.Invariant_Last;
+
+	if(Page<DIAG_INVARIANT_PAGES)
+	{
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Fault Injection Service      	 ***************
+********************************************************************************
+*******************************************************************************/
+#ifdef FAULT_INJECTION_ENABLED
+/**
+ * @brief Arms the requested faults and answers the faults injected so far.
+ */
+static void Diagnostics_Fault_Injection(Control_Unit_TypeDef* Control_Unit)
+{
+	Fault_Injection_Arm(Control_Unit->Diagnostics.Request[1],Control_Unit->Diagnostics.Request[2]);
+	Diagnostics_Positive(Control_Unit,Fault_Injection_Injected());
+}
+#endif
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Recovery Service      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Recovery(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_RECOVERY_PAGES];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	Values[0]=Control_Unit->Recovery.Attempts;
+	Values[1]=Control_Unit->Recovery.Recoveries;
+	Values[2]=Control_Unit->Recovery.Last_Time_To_Recover;
+	Values[3]=Control_Unit->Recovery.Max_Time_To_Recover;
+	Values[4]=Control_Unit->Recovery.Missed_Scans;
+
+	if(Page<DIAG_RECOVERY_PAGES)
+	{
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Scheduler Service      	   ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Scan_Scheduler(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_SCHEDULER_PAGES];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	Values[0]=Control_Unit->Scan_Scheduler.Scans[SCAN_BAND_SLOW];
+	Values[1]=Control_Unit->Scan_Scheduler.Scans[SCAN_BAND_NORMAL];
+	Values[2]=Control_Unit->Scan_Scheduler.Scans[SCAN_BAND_FAST];
+	Values[3]=Control_Unit->Scan_Scheduler.Local_Scans;
+	Values[4]=Control_Unit->Scan_Scheduler.Band;
+	Values[5]=Scan_Scheduler_Period(Control_Unit,Control_Unit->Scan_Scheduler.Band);
+	Values[6]=(uint32_t)(int32_t)(Control_Unit->Scan_Scheduler.Max_Temperature*10.0f);
+	Values[7]=(uint32_t)(int32_t)(Control_Unit->Scan_Scheduler.Max_Rate*1000.0f);
+
+	if(Page<DIAG_SCHEDULER_PAGES)
+	{
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibration Service      	   	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Calibration(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_CALIBRATION_PAGES];
+	uint8_t Channel=Control_Unit->Diagnostics.Request[1];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+	const Calibration_TypeDef* Calibration=&Control_Unit->Calibration;
+
+	if(Channel>=BPCU_CHANNELS || Page>=DIAG_CALIBRATION_PAGES)
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+		return;
+	}
+
+	Values[0]=(uint32_t)(int32_t)(Calibration->Temperature_Offset[Channel]/CALIBRATION_TEMPERATURE_LSB);
+	Values[1]=(uint32_t)(int32_t)((Calibration->Temperature_Gain[Channel]-1.0f)/CALIBRATION_GAIN_LSB);
+	Values[2]=Calibration->Curve[Channel];
+	Values[3]=(uint32_t)(int32_t)(Calibration->Voltage_Offset[Channel]/CALIBRATION_VOLTAGE_LSB);
+	Values[4]=(uint32_t)(int32_t)((Calibration->Voltage_Gain[Channel]-1.0f)/CALIBRATION_GAIN_LSB);
+	Values[5]=Calibration->Loaded;
+	Values[6]=Calibration->Saves;
+	Values[7]=Calibration->Rejected;
+
+	Diagnostics_Positive(Control_Unit,Values[Page]);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Cell Statistics Service      	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Cell_Stats(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_CELL_STATS_PAGES];
+	uint8_t Channel=Control_Unit->Diagnostics.Request[1];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+	const Cell_Stats_TypeDef* Stats=&Control_Unit->Cell_Stats;
+
+	if(Channel>=BPCU_CHANNELS || Page>=DIAG_CELL_STATS_PAGES)
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+		return;
+	}
+
+	Values[0]=Stats->Voltage_Lifetime[Channel].Count;
+	Values[1]=(uint32_t)(Stats->Voltage_Lifetime[Channel].Mean*10000.0f);
+	Values[2]=(uint32_t)(Cell_Stats_Deviation(&Stats->Voltage_Lifetime[Channel])*100000.0f);
+	Values[3]=Stats->Temperature_Lifetime[Channel].Count;
+	Values[4]=(uint32_t)(int32_t)(Stats->Temperature_Lifetime[Channel].Mean*100.0f);
+	Values[5]=(uint32_t)(Cell_Stats_Deviation(&Stats->Temperature_Lifetime[Channel])*1000.0f);
+	Values[6]=(uint32_t)(Stats->Voltage.Spread*10000.0f);
+	Values[7]=(uint32_t)(Stats->Temperature.Spread*100.0f);
+
+	Diagnostics_Positive(Control_Unit,Values[Page]);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Open Wire Service      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Open_Wire(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_OPEN_WIRE_PAGES];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+
+	Values[0]=Control_Unit->Open_Wire.Checks;
+	Values[1]=Control_Unit->Open_Wire.Aborts;
+	Values[2]=Control_Unit->Open_Wire.Timeouts;
+	Values[3]=Control_Unit->Open_Wire.Open;
+	Values[4]=Control_Unit->Open_Wire.Suspect;
+	Values[5]=Control_Unit->Open_Wire.Period/1000;
+	Values[6]=Control_Unit->Open_Wire.Last_Duration;
+
+	if(Page<DIAG_OPEN_WIRE_PAGES)
+	{
+		Diagnostics_Positive(Control_Unit,Values[Page]);
+	}
+	else
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Self Test Service      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Self_Test(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_SELF_TEST_PAGES];
+	uint8_t Chip=Control_Unit->Diagnostics.Request[1];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+	const Self_Test_TypeDef* Self_Test=&Control_Unit->Self_Test;
+
+	if(Chip>=2 || Page>=DIAG_SELF_TEST_PAGES)
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+		return;
+	}
+
+	Values[0]=Self_Test->Runs;
+	Values[1]=Self_Test->Aborts;
+	Values[2]=Self_Test->Timeouts;
+	Values[3]=Self_Test->Fault_Count;
+	Values[4]=Self_Test->Failing[Chip];
+	Values[5]=Self_Test->Faults[Chip];
+	Values[6]=Self_Test->Revision[Chip];
+	Values[7]=(uint32_t)(int32_t)Self_Test->Value[SELF_TEST_SUM_OF_CELLS][Chip];
+	Values[8]=(uint32_t)(int32_t)Self_Test->Value[SELF_TEST_DIE_TEMPERATURE][Chip];
+	Values[9]=(uint32_t)(int32_t)Self_Test->Value[SELF_TEST_ANALOG_SUPPLY][Chip];
+	Values[10]=(uint32_t)(int32_t)Self_Test->Value[SELF_TEST_DIGITAL_SUPPLY][Chip];
+
+	Diagnostics_Positive(Control_Unit,Values[Page]);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Sum Check Service      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+static void Diagnostics_Sum_Check(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Values[DIAG_SUM_CHECK_PAGES];
+	uint8_t Chip=Control_Unit->Diagnostics.Request[1];
+	uint8_t Page=Control_Unit->Diagnostics.Request[2];
+	const Sum_Check_TypeDef* Sum_Check=&Control_Unit->Sum_Check;
+
+	if(Chip>=2 || Page>=DIAG_SUM_CHECK_PAGES)
+	{
+		Diagnostics_Negative(Control_Unit,DIAG_NRC_OUT_OF_RANGE);
+		return;
+	}
+
+	Values[0]=Sum_Check->Checks;
+	Values[1]=Sum_Check->Mismatches;
+	Values[2]=Sum_Check->Voted;
+	Values[3]=Sum_Check->Discards;
+	Values[4]=Sum_Check->Disagreements;
+	Values[5]=Sum_Check->Faults;
+	Values[6]=(uint32_t)(Sum_Check->Tolerance*1000.0f+0.5f);
+	Values[7]=(uint32_t)(int32_t)(Sum_Check->Error[Chip]*1000.0f);
+	Values[8]=Sum_Check->Discarded[Chip];
+
+	Diagnostics_Positive(Control_Unit,Values[Page]);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Diagnostics Task      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+void Diagnostics_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->Diagnostics.Pending==FALSE)
+	{
+		return;
+	}
+
+	switch(Control_Unit->Diagnostics.Request[0])
+	{
+		case DIAG_SERVICE_PROFILER:
+			Diagnostics_Profiler(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_POWER_GOVERNOR:
+			Diagnostics_Power_Governor(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_CAN:
+			Diagnostics_CAN(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_BENCHMARK:
+			Diagnostics_Benchmark(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_CAPTURE:
+			Diagnostics_Capture(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_INVARIANTS:
+			Diagnostics_Invariants(Control_Unit);
+		break;
+
+#ifdef FAULT_INJECTION_ENABLED
+		case DIAG_SERVICE_FAULT_INJECTION:
+			Diagnostics_Fault_Injection(Control_Unit);
+		break;
+#endif
+
+		case DIAG_SERVICE_RECOVERY:
+			Diagnostics_Recovery(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_SCAN_SCHEDULER:
+			Diagnostics_Scan_Scheduler(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_CALIBRATION:
+			Diagnostics_Calibration(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_CELL_STATS:
+			Diagnostics_Cell_Stats(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_OPEN_WIRE:
+			Diagnostics_Open_Wire(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_SELF_TEST:
+			Diagnostics_Self_Test(Control_Unit);
+		break;
+
+		case DIAG_SERVICE_SUM_CHECK:
+			Diagnostics_Sum_Check(Control_Unit);
+		break;
+
+		default:
+			Diagnostics_Negative(Control_Unit,DIAG_NRC_UNKNOWN_SERVICE);
+		break;
+	}
+
+	CAN1_Send(&Control_Unit->Tx_Message);
+	Control_Unit->Diagnostics.Pending=FALSE;
+}
+
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Diagnostics.c
+  * @brief          : Diagnostic request/response
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,177 @@
+/**
+  ******************************************************************************
+  * @file           : Diagnostics.h
+  * @brief          : Diagnostic request/response header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "Can_Bus.h"
+#include "Profiler.h"
+#include "Power_Governor.h"
+#include "Benchmark.h"
+#include "Capture.h"
+#include "Fault_Injection.h"
+#include "Scan_Scheduler.h"
+#include "Filter_Engine.h"
+#include "Calibration.h"
+#include "Cell_Stats.h"
+#include "Open_Wire.h"
+#include "Self_Test.h"
+#include "Sum_Check.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Services      	  	  		 	 ***************
+********************************************************************************
+*******************************************************************************/
+/*
+ * Request:  Data[0]=Service Data[1]=Argument Data[2]=Page
+ * Response: Data[0]=Service Data[1]=Argument Data[2]=Page Data[3..6]=Value (little endian) Data[7]=Core MHz
+ * Refused:  Data[0]=DIAG_NEGATIVE_RESPONSE Data[1]=Service Data[2]=Reason
+ */
+typedef enum
+{
+	DIAG_SERVICE_PROFILER					=0x01,		//Argument: Profiler entry
+	DIAG_SERVICE_POWER_GOVERNOR		=0x02,
+	DIAG_SERVICE_CAN							=0x03,
+	DIAG_SERVICE_BENCHMARK				=0x04,		//Argument: Benchmark kernel
+	DIAG_SERVICE_CAPTURE					=0x05,		//Argument: Record, 0 is the oldest
+	DIAG_SERVICE_INVARIANTS				=0x06,
+	DIAG_SERVICE_FAULT_INJECTION	=0x07,		//Argument: Fault bits, Page: Transactions (0 disarms). Test builds only
+	DIAG_SERVICE_RECOVERY					=0x08,
+	DIAG_SERVICE_SCAN_SCHEDULER		=0x09,
+	//0x0A was the filter evaluation, now run on captured data by Host/Tools/Capture_Replay
+	DIAG_SERVICE_CALIBRATION			=0x0B,		//Argument: Channel
+	DIAG_SERVICE_CELL_STATS				=0x0C,		//Argument: Channel
+	DIAG_SERVICE_OPEN_WIRE				=0x0D,
+	DIAG_SERVICE_SELF_TEST				=0x0E,		//Argument: Chip
+	DIAG_SERVICE_SUM_CHECK				=0x0F,		//Argument: Chip
+} Diagnostics_Service_Enum;
+
+#define DIAG_NEGATIVE_RESPONSE			0x7F
+#define DIAG_NRC_UNKNOWN_SERVICE		0x01
+#define DIAG_NRC_OUT_OF_RANGE				0x02
+
+// Profiler pages: 0 Count, 1 Max, 2 Last, 3.. two histogram buckets per page, 0xFF resets the entry
+#define DIAG_PROFILER_PAGE_COUNT		0x00
+#define DIAG_PROFILER_PAGE_MAX			0x01
+#define DIAG_PROFILER_PAGE_LAST			0x02
+#define DIAG_PROFILER_PAGE_HISTOGRAM	0x03
+#define DIAG_PROFILER_PAGE_RESET		0xFF
+
+// Power governor pages: 0 Time low power (ms), 1 Time high speed (ms), 2 Switches, 3 Last latency (us), 4 Max latency (us)
+#define DIAG_GOVERNOR_PAGES					5
+
+// CAN pages: 0 Receive queue overflows, 1 Tx frames, 2 Rx frames, 3 Tx bits, 4 Rx bits,
+// 5 Bus load (per mille), 6 Peak bus load (per mille), 7 Rejected frames,
+// 8 Tx frames dropped on a full queue, 9 Most Tx frames queued at once,
+// 10 Rx FIFO read errors
+#define DIAG_CAN_PAGES							11
+
+// Benchmark pages (cycles): 0 Runs, 1 Min, 2 Max, 3 Mean, 4 Core MHz of the run, 0xFF runs the kernel
+#define DIAG_BENCHMARK_PAGES				5
+#define DIAG_BENCHMARK_PAGE_RUN			0xFF
+
+// Capture pages: 0..3 record words (Timestamp, Source|Flags<<8|Id<<16, Data[0..3], Data[4..7]),
+// reading a record freezes the capture. 0x10 Records held, 0x11 Records since the last clear,
+// 0xFF clears and resumes the capture
+#define DIAG_CAPTURE_PAGE_WORDS			4
+#define DIAG_CAPTURE_PAGE_COUNT			0x10
+#define DIAG_CAPTURE_PAGE_TOTAL			0x11
+#define DIAG_CAPTURE_PAGE_CLEAR			0xFF
+
+// Invariant pages: 0 Violations, 1 Failed invariant bits of the last one
+#define DIAG_INVARIANT_PAGES				2
+
+// Recovery pages: 0 Attempts, 1 Recoveries, 2 Last time to recover (ms), 3 Max time to recover (ms), 4 Missed scans
+#define DIAG_RECOVERY_PAGES					5
+
+// Scan scheduler pages: 0 Slow band scans, 1 Normal band scans, 2 Fast band scans, 3 Local scans,
+// 4 Band, 5 Period (ms), 6 Max temperature (0.1 degC, signed), 7 Max rise rate (mdegC/s, signed)
+#define DIAG_SCHEDULER_PAGES				8
+
+// Calibration pages: 0 Temperature offset (0.01 degC), 1 Temperature gain error (1/65536), 2 Curve,
+// 3 Voltage offset (100 uV), 4 Voltage gain error (1/65536), 5 Loaded from NVM, 6 Saves, 7 Rejected commands
+#define DIAG_CALIBRATION_PAGES			8
+
+// Cell statistics pages, lifetime of the channel: 0 Voltage readings, 1 Voltage mean (100 uV),
+// 2 Voltage deviation (10 uV), 3 Temperature readings, 4 Temperature mean (0.01 degC, signed),
+// 5 Temperature deviation (0.001 degC). Last scan: 6 Voltage spread (100 uV), 7 Temperature spread (0.01 degC)
+#define DIAG_CELL_STATS_PAGES				8
+
+// Open wire pages: 0 Checks, 1 Sequences cut by a scan, 2 Timeouts, 3 Open cells, 4 Suspect cells,
+// 5 Check period (s), 6 Last sequence duration (ms)
+#define DIAG_OPEN_WIRE_PAGES				7
+
+// Self-test pages: 0 Runs, 1 Runs cut by a scan, 2 Timeouts, 3 Chip faults raised, 4 Failing items,
+// 5 Confirmed items, 6 Revision. Last status of the chip: 7 Sum of cells (10 mV),
+// 8 Die temperature (0.1 degC, signed), 9 Analog supply (mV), 10 Digital supply (mV)
+#define DIAG_SELF_TEST_PAGES				11
+
+// Sum check pages: 0 Checks, 1 Phases re-measured, 2 Phases settled by the vote, 3 Phases discarded,
+// 4 Cells outvoted, 5 Chips failed, 6 Tolerance (mV, 0 disabled). Of the chip:
+// 7 Last cells minus SC (mV, signed), 8 Phases in a row without majority
+#define DIAG_SUM_CHECK_PAGES				9
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Diagnostics_Init(Control_Unit_TypeDef* Control_Unit);
+void Diagnostics_Request(Control_Unit_TypeDef* Control_Unit);
+void Diagnostics_Task(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Diagnostics.h
+  * @brief          : Diagnostic request/response header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,204 @@
+/**
+  ******************************************************************************
+  * @file           : Fault_Injection.c
+  * @brief          : LTC6811 communication fault injection
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Fault_Injection.h"
+#include "LTC6811.h"
+
+/*******************************************************************************
+********************************************************************************
+***************									Fault Injection Data      	   ***************
+********************************************************************************
+*******************************************************************************/
+static Fault_Injection_TypeDef Fault_Injection;
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Fault Injection Init      	   ***************
+********************************************************************************
+*******************************************************************************/
+void Fault_Injection_Init(void)
+{
+	memset(&Fault_Injection, 0, sizeof(Fault_Injection_TypeDef));
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Arm      	  	   		 		 	 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Corrupts the next Transactions transactions the armed faults apply
+ * to, 0 disarms. Runs from the main task, as the SPI traffic.
+ */
+void Fault_Injection_Arm(uint8_t Faults, uint8_t Transactions)
+{
+	Fault_Injection.Armed=(Transactions!=0) ? Faults : 0;
+	Fault_Injection.Remaining=Transactions;
+	Fault_Injection.Asleep=FALSE;
+	Fault_Injection.Random=MCU_Cycle_Counter_Get() | 1U;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Helpers      	  	   		 		 	 ***************
+********************************************************************************
+*******************************************************************************/
+static uint32_t Fault_Injection_Random(void)
+{
+	uint32_t x=Fault_Injection.Random;
+	x^=x<<13;
+	x^=x>>17;
+	x^=x<<5;
+	Fault_Injection.Random=x;
+	return x;
+}
+
+static void Fault_Injection_Used(void)
+{
+	Fault_Injection.Injected++;
+	Fault_Injection.Remaining--;
+	if(Fault_Injection.Remaining==0)
+	{
+		Fault_Injection.Armed=0;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Write      	  	   		 		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+BoolTypeDef Fault_Injection_Write(uint8_t* Tx, uint16_t Length)
+{
+	if(Fault_Injection.Armed==0 || Length<2)
+	{
+		return FALSE;
+	}
+
+	uint16_t Command=(uint16_t)((Tx[0]<<8) | Tx[1]);
+
+	if((Fault_Injection.Armed & FAULT_STUCK_ADC) && ((Command & LTC6811_ADCV_MASK)==LTC6811_CMD_ADCV ||
+		 (Command & LTC6811_ADCVSC_MASK)==LTC6811_CMD_ADCVSC))
+	{
+		Fault_Injection_Used();
+		return TRUE;
+	}
+	if((Fault_Injection.Armed & FAULT_WAKE) && Length==2 && Command==0)
+	{
+		Fault_Injection.Asleep=TRUE;
+		Fault_Injection_Used();
+		return TRUE;
+	}
+	return FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Read      	  	   		 		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Applies the armed read faults to a received frame, the last two bytes
+ * of a register group are its PEC.
+ */
+void Fault_Injection_Read(uint8_t* Rx, uint16_t Length, BoolTypeDef* Status)
+{
+	if(Fault_Injection.Asleep==TRUE)
+	{
+		memset(Rx, 0xFF, Length);
+		Fault_Injection.Asleep=FALSE;
+		return;
+	}
+
+	if(Fault_Injection.Armed==0 || Length<3)
+	{
+		return;
+	}
+
+	BoolTypeDef Used=FALSE;
+
+	if(Fault_Injection.Armed & FAULT_SPI_TIMEOUT)
+	{
+		*Status=FALSE;
+		Used=TRUE;
+	}
+	if(Fault_Injection.Armed & FAULT_PEC_CORRUPTION)
+	{
+		Rx[Length-1]^=0x02;
+		Used=TRUE;
+	}
+	if(Fault_Injection.Armed & FAULT_BIT_FLIP)
+	{
+		uint32_t Bit=Fault_Injection_Random() % ((uint32_t)(Length-2)*8U);
+		Rx[Bit/8U]^=(uint8_t)(1U<<(Bit%8U));
+		Used=TRUE;
+	}
+
+	if(Used==TRUE)
+	{
+		Fault_Injection_Used();
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Injected      	  	   		 		 ***************
+********************************************************************************
+*******************************************************************************/
+uint32_t Fault_Injection_Injected(void)
+{
+	return Fault_Injection.Injected;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Fault_Injection.c
+  * @brief          : LTC6811 communication fault injection
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file           : Fault_Injection.h
+  * @brief          : LTC6811 communication fault injection header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef FAULT_INJECTION_H
+#define FAULT_INJECTION_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include <string.h>
+
+// Uncomment on test builds only, the hooks compile to nothing otherwise
+//#define FAULT_INJECTION_ENABLED
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Hooks      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// WRITE gives TRUE when the frame must not be sent
+#ifdef FAULT_INJECTION_ENABLED
+	#define FAULT_INJECTION_WRITE(Tx,Length)				Fault_Injection_Write(Tx,Length)
+	#define FAULT_INJECTION_READ(Rx,Length,Status)	Fault_Injection_Read(Rx,Length,Status)
+#else
+	#define FAULT_INJECTION_WRITE(Tx,Length)				FALSE
+	#define FAULT_INJECTION_READ(Rx,Length,Status)
+#endif
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Fault_Injection_Init(void);
+void Fault_Injection_Arm(uint8_t Faults, uint8_t Transactions);
+BoolTypeDef Fault_Injection_Write(uint8_t* Tx, uint16_t Length);
+void Fault_Injection_Read(uint8_t* Rx, uint16_t Length, BoolTypeDef* Status);
+uint32_t Fault_Injection_Injected(void);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Fault_Injection.h
+  * @brief          : LTC6811 communication fault injection header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
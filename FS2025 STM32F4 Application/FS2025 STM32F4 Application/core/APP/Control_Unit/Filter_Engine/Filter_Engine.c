@@ -0,0 +1,262 @@
+/**
+  ******************************************************************************
+  * @file           : Filter_Engine.c
+  * @brief          : Per channel temperature filters
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Filter_Engine.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Config Float      	  	   			 ***************
+********************************************************************************
+*******************************************************************************/
+static float Filter_Engine_Config_Float(uint32_t Word, float Default)
+{
+	float Value;
+
+	memcpy(&Value, &Word, sizeof(Value));
+	if(isfinite(Value)==0 || Value<=0.0f)
+	{
+		return Default;
+	}
+	return Value;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Filter Engine Reset      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+static void Filter_Engine_Reset(Filter_Engine_TypeDef* Engine)
+{
+	memset(Engine->History, 0, sizeof(Engine->History));
+	Engine->History_Head=0;
+	Engine->History_Count=0;
+	Engine->Primed=0;
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Engine->Covariance[i]=Engine->Kalman_R;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Filter Engine Alpha      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+static void Filter_Engine_Set_Alpha(Filter_Engine_TypeDef* Engine, uint8_t Channel, uint16_t Alpha)
+{
+	uint8_t Shift=(Channel & 1U) ? 16 : 0;
+
+	Engine->Alpha[Channel/2]=(Engine->Alpha[Channel/2] & ~(0xFFFFUL<<Shift)) | ((uint32_t)Alpha<<Shift);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Filter Engine Init      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+void Filter_Engine_Init(Filter_Engine_TypeDef* Engine, const uint32_t* Config)
+{
+	uint32_t Alpha_Word=Config[FILTER_CONFIG_IIR_ALPHA];
+
+	Engine->IIR_Alpha=CHANNEL_FILTER_Q15(FILTER_DEFAULT_IIR_ALPHA);
+	if(Alpha_Word>0 && Alpha_Word<=0x7FFF)
+	{
+		Engine->IIR_Alpha=(uint16_t)Alpha_Word;
+	}
+
+	Engine->Median_Length=FILTER_DEFAULT_MEDIAN_LENGTH;
+	if(Config[FILTER_CONFIG_MEDIAN_LENGTH]>=2 && Config[FILTER_CONFIG_MEDIAN_LENGTH]<=FILTER_MEDIAN_MAX)
+	{
+		Engine->Median_Length=(uint8_t)Config[FILTER_CONFIG_MEDIAN_LENGTH];
+	}
+	Engine->Kalman_Q=Filter_Engine_Config_Float(Config[FILTER_CONFIG_KALMAN_Q],FILTER_DEFAULT_KALMAN_Q);
+	Engine->Kalman_R=Filter_Engine_Config_Float(Config[FILTER_CONFIG_KALMAN_R],FILTER_DEFAULT_KALMAN_R);
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		uint8_t Type=(uint8_t)(Config[i/4]>>(8*(i%4)));
+
+		Engine->Type[i]=(Type<FILTER_TYPES) ? Type : FILTER_DEFAULT;
+		Filter_Engine_Set_Alpha(Engine,i,(Engine->Type[i]==FILTER_IIR) ? Engine->IIR_Alpha : CHANNEL_FILTER_Q15(FILTER_SMOOTHING_ALPHA));
+	}
+
+	Filter_Engine_Reset(Engine);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Median      	  	   						 ***************
+********************************************************************************
+*******************************************************************************/
+static float Filter_Engine_Median(const Filter_Engine_TypeDef* Engine, uint8_t Channel)
+{
+	float Window[FILTER_MEDIAN_MAX];
+	uint8_t Length=(Engine->History_Count<Engine->Median_Length) ? Engine->History_Count : Engine->Median_Length;
+	uint8_t Slot=Engine->History_Head;
+
+	// Newest readings first, insertion sort of at most FILTER_MEDIAN_MAX values
+	for(uint8_t k=0; k<Length; k++)
+	{
+		Slot=(Slot==0) ? FILTER_HISTORY_LENGTH-1 : Slot-1;
+
+		float Sample=Engine->History[Slot][Channel];
+		uint8_t j=k;
+		while(j>0 && Window[j-1]>Sample)
+		{
+			Window[j]=Window[j-1];
+			j--;
+		}
+		Window[j]=Sample;
+	}
+	return Window[(Length-1)/2];
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Filter Engine Run      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief The IIR of every channel runs first in the packed filter, two
+ * channels per instruction, the default rule uses it for its smoothing. Then
+ * a single loop applies the filter of each channel.
+ */
+uint32_t Filter_Engine_Run(Filter_Engine_TypeDef* Engine, const float* Input, float* Value, uint32_t Skip)
+{
+	uint32_t Packed_Input[CHANNEL_FILTER_PAIRS];
+	uint32_t Packed_State[CHANNEL_FILTER_PAIRS];
+	float Smoothed[BPCU_CHANNELS];
+	uint32_t Updated=0;
+
+	Channel_Filter_Pack(Input, Packed_Input, CHANNEL_FILTER_PAIRS);
+	Channel_Filter_Pack(Value, Packed_State, CHANNEL_FILTER_PAIRS);
+	Channel_Filter_Run(Packed_Input, Packed_State, Engine->Alpha, CHANNEL_FILTER_PAIRS);
+	Channel_Filter_Unpack(Packed_State, Smoothed, CHANNEL_FILTER_PAIRS);
+
+	memcpy(Engine->History[Engine->History_Head], Input, sizeof(Engine->History[0]));
+	Engine->History_Head=(Engine->History_Head+1)%FILTER_HISTORY_LENGTH;
+	if(Engine->History_Count<FILTER_HISTORY_LENGTH)
+	{
+		Engine->History_Count++;
+	}
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		uint32_t Bit=1UL<<i;
+		float Reading=Input[i];
+
+		if(Skip & Bit)
+		{
+			continue;
+		}
+
+		// The filters with a state start from the first reading
+		if((Engine->Primed & Bit)==0 && Engine->Type[i]!=FILTER_DEFAULT)
+		{
+			Engine->Primed|=Bit;
+			Engine->Covariance[i]=Engine->Kalman_R;
+			Value[i]=Reading;
+			Updated|=Bit;
+			continue;
+		}
+
+		switch(Engine->Type[i])
+		{
+			case FILTER_IIR:
+				Value[i]=Smoothed[i];
+			break;
+
+			case FILTER_MEDIAN:
+				Value[i]=Filter_Engine_Median(Engine,i);
+			break;
+
+			case FILTER_KALMAN:
+			{
+				float Covariance=Engine->Covariance[i]+Engine->Kalman_Q;
+				float Gain=Covariance/(Covariance+Engine->Kalman_R);
+
+				Value[i]+=Gain*(Reading-Value[i]);
+				Engine->Covariance[i]=(1.0f-Gain)*Covariance;
+			}
+			break;
+
+			case FILTER_RAW:
+				Value[i]=Reading;
+			break;
+
+			default:
+			{
+				float Change=fabsf(Reading-Value[i]);
+
+				if(Change<=FILTER_DEADBAND)
+				{
+					continue;
+				}
+				if(Change>FILTER_JUMP && (Reading>FILTER_CRITICAL_HIGH || Reading<FILTER_CRITICAL_LOW))
+				{
+					Value[i]=Smoothed[i];
+				}
+				else
+				{
+					Value[i]=Reading;
+				}
+			}
+			break;
+		}
+		Updated|=Bit;
+	}
+	return Updated;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Filter_Engine.c
+  * @brief          : Per channel temperature filters
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
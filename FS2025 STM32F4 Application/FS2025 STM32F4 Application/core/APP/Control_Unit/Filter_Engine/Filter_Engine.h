@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file           : Filter_Engine.h
+  * @brief          : Per channel temperature filters header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef FILTER_ENGINE_H
+#define FILTER_ENGINE_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "Channel_Filter.h"
+#include <math.h>
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Configuration      	  	  	 ***************
+********************************************************************************
+*******************************************************************************/
+// NVM words: 0..5 filter type of each channel, one byte each, channel 4k in
+// the low byte of word k. 6 IIR factor (Q15), 7 median length, 8 Kalman Q and
+// 9 Kalman R (float). Erased or out of range words take the defaults
+#define FILTER_CONFIG_WORDS						10
+#define FILTER_CONFIG_TYPE_WORDS			6
+#define FILTER_CONFIG_IIR_ALPHA				6
+#define FILTER_CONFIG_MEDIAN_LENGTH		7
+#define FILTER_CONFIG_KALMAN_Q				8
+#define FILTER_CONFIG_KALMAN_R				9
+
+#define FILTER_DEFAULT_IIR_ALPHA			0.1f
+#define FILTER_DEFAULT_MEDIAN_LENGTH	3
+#define FILTER_DEFAULT_KALMAN_Q				0.01f
+#define FILTER_DEFAULT_KALMAN_R				0.25f
+
+// Default rule
+#define FILTER_DEADBAND								0.5f		//degC, smaller changes are ignored
+#define FILTER_JUMP										5.0f		//degC
+#define FILTER_CRITICAL_HIGH					60.0f		//degC
+#define FILTER_CRITICAL_LOW						0.0f		//degC
+#define FILTER_SMOOTHING_ALPHA				0.1f		//Weight of a jump to a critical value
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Filter_Engine_Init(Filter_Engine_TypeDef* Engine, const uint32_t* Config);
+
+// Filters every channel not in Skip in one pass, Value holds the filtered
+// temperatures. Returns the channels whose value was updated
+uint32_t Filter_Engine_Run(Filter_Engine_TypeDef* Engine, const float* Input, float* Value, uint32_t Skip);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Filter_Engine.h
+  * @brief          : Per channel temperature filters header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
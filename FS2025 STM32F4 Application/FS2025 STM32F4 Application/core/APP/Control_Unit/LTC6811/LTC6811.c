@@ -23,6 +23,10 @@
   */
 	
 #include "LTC6811.h"
+#include "Fault_Injection.h"
+#include "Cell_Stats.h"
+#include "Balancing.h"
+#include "Sum_Check.h"
 
 /*******************************************************************************
 ********************************************************************************
@@ -43,6 +47,16 @@ const int8_t Temp_Table_C[] = {
      60,  65,  70,  75,  80,  85,  90,  95, 100, 105,
     110, 115, 120
 };
+
+// Thermistor curves a channel can select, unknown curves use the first one
+static const struct
+{
+    const float* Volts;
+    const int8_t* Degrees;
+    uint8_t Points;
+} LTC6811_Temperature_Curves[LTC6811_TEMPERATURE_CURVES] = {
+    {Temp_Table_V, Temp_Table_C, sizeof(Temp_Table_V) / sizeof(float)}
+};
 /*******************************************************************************
 ********************************************************************************
 ***************									LTC6811 Init      	  			   ***************	
@@ -62,30 +76,13 @@ void LTC6811_SPI_Init()
 *******************************************************************************/
 void LTC6811_Init(Control_Unit_TypeDef* Control_Unit)
 {		
-	Control_Unit->Status.LTC6811_1.SPI_Handler=&STM32_SPI1;
-	Control_Unit->Status.LTC6811_1.CS_PORT=GPIOA;
-	Control_Unit->Status.LTC6811_1.CS_PIN=GPIO_PIN_4;
-	
-	Control_Unit->Status.LTC6811_2.SPI_Handler=&STM32_SPI2;
-	Control_Unit->Status.LTC6811_2.CS_PORT=GPIOA;
-	Control_Unit->Status.LTC6811_2.CS_PIN=GPIO_PIN_15;
+	Control_Unit->Status.LTC6811_1.SPI=MCU_SPI_1;
+	Control_Unit->Status.LTC6811_2.SPI=MCU_SPI_2;
 	
 	Control_Unit->Status.LTC6811_1.Fail=FALSE;
 	Control_Unit->Status.LTC6811_2.Fail=FALSE;
 	
-	// Despierta ambos LTC6811
-  LTC6811_Wake_Up(&Control_Unit->Status.LTC6811_1);
-  LTC6811_Wake_Up(&Control_Unit->Status.LTC6811_2);
-  HAL_Delay(1);
-
-  // Desactiva balanceo al final (por seguridad)
-  LTC_Disable_Balancing(&Control_Unit->Status.LTC6811_1);
-  LTC_Disable_Balancing(&Control_Unit->Status.LTC6811_2);
-		
-	if(Control_Unit->Status.LTC6811_1.Fail==TRUE || Control_Unit->Status.LTC6811_2.Fail==TRUE)
-	{
-		Control_Unit->State=LTC6811_FAIL_MODE;
-	}	
+	// Wake up and configuration are done by the startup sequencer
 }
 
 
@@ -122,15 +119,61 @@ uint8_t LTC6811_Enconde_Temp(float Temp)
 ********************************************************************************
 *******************************************************************************/
 float LTC_Voltage_to_Temperature(float v) {
-    for (uint8_t i = 0; i < sizeof(Temp_Table_V) / sizeof(float) - 1; i++) {
-        if (v <= Temp_Table_V[i] && v >= Temp_Table_V[i + 1]) {
-            float t = Temp_Table_C[i] + (v - Temp_Table_V[i]) /
-                      (Temp_Table_V[i + 1] - Temp_Table_V[i]) *
-                      (Temp_Table_C[i + 1] - Temp_Table_C[i]);
+    return LTC_Voltage_to_Temperature_Curve(0, v);
+}
+
+float LTC_Voltage_to_Temperature_Curve(uint8_t Curve, float v) {
+    if (Curve >= LTC6811_TEMPERATURE_CURVES) Curve = 0;
+
+    const float* Volts = LTC6811_Temperature_Curves[Curve].Volts;
+    const int8_t* Degrees = LTC6811_Temperature_Curves[Curve].Degrees;
+
+    for (uint8_t i = 0; i < LTC6811_Temperature_Curves[Curve].Points - 1; i++) {
+        if (v <= Volts[i] && v >= Volts[i + 1]) {
+            float t = Degrees[i] + (v - Volts[i]) /
+                      (Volts[i + 1] - Volts[i]) *
+                      (Degrees[i + 1] - Degrees[i]);
             return t;
         }
     }
-    return -100.0f;  // fuera de rango
+    return LTC6811_TEMPERATURE_OUT_OF_RANGE;  // fuera de rango
+}
+
+/*******************************************************************************
+********************************************************************************
+***************								SPI Capture					      	  	   ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Records a transaction in the capture ring: the command, up to 8 bytes
+ * of the response (reads) or of the payload after the command (writes), the
+ * transfer result and, for register group reads, the PEC check.
+ */
+static void LTC6811_Capture(LTC6811_Typdef* LTC6811, uint8_t *tx, uint16_t len_tx, uint8_t *rx, uint16_t len_rx, BoolTypeDef Status)
+{
+#ifdef CAPTURE_ENABLED
+	Capture_Source_TypeDef Source=(LTC6811->SPI==MCU_SPI_1) ? CAPTURE_SPI_1 : CAPTURE_SPI_2;
+	uint16_t Command=(len_tx>=2) ? (uint16_t)((tx[0]<<8) | tx[1]) : 0;
+	uint8_t Flags=(Status==TRUE) ? CAPTURE_FLAG_TRANSFER_OK : 0;
+
+	if(len_rx!=0)
+	{
+		Flags|=CAPTURE_FLAG_READ;
+		if(len_rx==LTC6811_REG_FRAME_SIZE && LTC6811_PEC15_Calc(rx, LTC6811_REG_GROUP_SIZE)==(uint16_t)((rx[6]<<8) | rx[7]))
+		{
+			Flags|=CAPTURE_FLAG_PEC_OK;
+		}
+		CAPTURE(Source, MCU_Get_Tick(), Command, Flags, rx, len_rx);
+	}
+	else if(len_tx>4)
+	{
+		CAPTURE(Source, MCU_Get_Tick(), Command, Flags, &tx[4], len_tx-4);
+	}
+	else
+	{
+		CAPTURE(Source, MCU_Get_Tick(), Command, Flags, NULL, 0);
+	}
+#endif
 }
 
 /*******************************************************************************
@@ -140,28 +183,33 @@ float LTC_Voltage_to_Temperature(float v) {
 *******************************************************************************/
 void LTC6811_SPI_Transfer(LTC6811_Typdef* LTC6811,uint8_t *tx, uint16_t len) 
 {
-	HAL_GPIO_WritePin(LTC6811->CS_PORT, LTC6811->CS_PIN, GPIO_PIN_RESET);
+	MCU_SPI_Chip_Select(LTC6811->SPI, TRUE);
 	// Espera corta antes de transmisin SPI
-	for (volatile int i = 0; i < 500; i++) __NOP();
-	HAL_StatusTypeDef Status;
-	Status = HAL_SPI_Transmit(LTC6811->SPI_Handler, tx, len, SPI_MAX_DELAY);  // Timeout de 100 ms
+	MCU_Delay_us(LTC6811_CS_GUARD_US);
+	BoolTypeDef Status=TRUE;
+	if(FAULT_INJECTION_WRITE(tx, len)==FALSE)
+	{
+		Status = MCU_SPI_Transmit(LTC6811->SPI, tx, len, SPI_MAX_DELAY);
+	}
 	
 	// Espera corta antes de liberar CS
-	for (volatile int i = 0; i < 500; i++) __NOP();
-	HAL_GPIO_WritePin(LTC6811->CS_PORT, LTC6811->CS_PIN, GPIO_PIN_SET);
+	MCU_Delay_us(LTC6811_CS_GUARD_US);
+	MCU_SPI_Chip_Select(LTC6811->SPI, FALSE);
 
-	if (Status != HAL_OK) 
+	if (Status != TRUE) 
 	{
 			LTC6811->Fail=TRUE;
 	}
+
+	LTC6811_Capture(LTC6811, tx, len, NULL, 0, Status);
 }
 
 void LTC6811_SPI_Transfer_No_CS(LTC6811_Typdef* LTC6811,uint8_t *tx, uint16_t len) 
 {
-	HAL_StatusTypeDef Status;
-	Status = HAL_SPI_Transmit(LTC6811->SPI_Handler, tx, len, SPI_MAX_DELAY);  // Timeout de 100 ms
+	BoolTypeDef Status;
+	Status = MCU_SPI_Transmit(LTC6811->SPI, tx, len, SPI_MAX_DELAY);
 
-	if (Status != HAL_OK) 
+	if (Status != TRUE) 
 	{
      LTC6811->Fail=TRUE;
 	}
@@ -173,23 +221,26 @@ void LTC6811_SPI_Transfer_No_CS(LTC6811_Typdef* LTC6811,uint8_t *tx, uint16_t le
 *******************************************************************************/
 void LTC6811_SPI_Transmit_Receive(LTC6811_Typdef* LTC6811, uint8_t *tx, uint8_t *rx, uint16_t len_tx, uint16_t len_rx)
 {
-    HAL_GPIO_WritePin(LTC6811->CS_PORT, LTC6811->CS_PIN, GPIO_PIN_RESET);
+    MCU_SPI_Chip_Select(LTC6811->SPI, TRUE);
 		// Espera corta antes de transmisin SPI
-		for (volatile int i = 0; i < 500; i++) __NOP();
+		MCU_Delay_us(LTC6811_CS_GUARD_US);
 	
-		HAL_StatusTypeDef Status,Status1;
+		BoolTypeDef Status,Status1;
 
-		Status=HAL_SPI_Transmit(LTC6811->SPI_Handler, tx, len_tx, SPI_MAX_DELAY);
-    Status1=HAL_SPI_Receive(LTC6811->SPI_Handler, rx, len_rx, SPI_MAX_DELAY);
+		Status=MCU_SPI_Transmit(LTC6811->SPI, tx, len_tx, SPI_MAX_DELAY);
+    Status1=MCU_SPI_Receive(LTC6811->SPI, rx, len_rx, SPI_MAX_DELAY);
+    FAULT_INJECTION_READ(rx, len_rx, &Status1);
 	
 		// Espera corta antes de liberar CS
-		for (volatile int i = 0; i < 500; i++) __NOP();
-    HAL_GPIO_WritePin(LTC6811->CS_PORT, LTC6811->CS_PIN, GPIO_PIN_SET);
+		MCU_Delay_us(LTC6811_CS_GUARD_US);
+    MCU_SPI_Chip_Select(LTC6811->SPI, FALSE);
 
-    if (Status != HAL_OK || Status1!=HAL_OK)
+    if (Status != TRUE || Status1!=TRUE)
     {
         LTC6811->Fail=TRUE;
     }
+
+    LTC6811_Capture(LTC6811, tx, len_tx, rx, len_rx, (Status==TRUE && Status1==TRUE) ? TRUE : FALSE);
 }
 
 /*******************************************************************************
@@ -197,6 +248,10 @@ void LTC6811_SPI_Transmit_Receive(LTC6811_Typdef* LTC6811, uint8_t *tx, uint8_t
 ***************								  	 PEC Calc			 					 	 	 	 ***************	
 ********************************************************************************
 *******************************************************************************/
+/**
+ * @brief CRC15 of the datasheet, the 15 bit remainder is sent shifted left
+ * with a 0 LSB (WRCFG gives 0x3D6E, ADCV 0x0360 gives 0xF46C).
+ */
 uint16_t LTC6811_PEC15_Calc(uint8_t *data, uint8_t len) {
     uint16_t remainder = 16; // PEC seed
     uint16_t POLY = 0x4599; // PEC polynomial
@@ -209,17 +264,33 @@ uint16_t LTC6811_PEC15_Calc(uint8_t *data, uint8_t len) {
             } else {
                 remainder <<= 1;
             }
+            remainder &= 0x7FFF;
         }
     }
-    return (remainder >> 1);
+    return (uint16_t)(remainder << 1);
+}
+
+/*******************************************************************************
+********************************************************************************
+***************								  	 Build Command			 		 	 	 	 ***************	
+********************************************************************************
+*******************************************************************************/
+void LTC6811_Build_Command(uint16_t Command, uint8_t* cmd)
+{
+    cmd[0] = (uint8_t)(Command >> 8);
+    cmd[1] = (uint8_t)(Command & 0xFF);
+    uint16_t pec = LTC6811_PEC15_Calc(cmd, 2);
+    cmd[2] = (uint8_t)(pec >> 8);
+    cmd[3] = (uint8_t)(pec & 0xFF);
 }
 
 BoolTypeDef LTC6811_Read_CFG(LTC6811_Typdef* LTC6811, uint8_t* config_out)
 {
-    uint8_t cmd[4] = { 0x02, 0x00, 0xB2, 0x2B }; // RDCFG + PEC15
-    uint8_t rx[8] = {0};
+    uint8_t cmd[4];
+    uint8_t rx[LTC6811_REG_FRAME_SIZE] = {0};
 
-    LTC6811_SPI_Transmit_Receive(LTC6811, cmd, rx, 4, 8);
+    LTC6811_Build_Command(LTC6811_CMD_RDCFG, cmd);
+    LTC6811_SPI_Transmit_Receive(LTC6811, cmd, rx, 4, LTC6811_REG_FRAME_SIZE);
 
     // Verificacin de PEC recibido
     uint16_t received_pec = (rx[6] << 8) | rx[7];
@@ -252,6 +323,46 @@ void LTC6811_Wake_Up(LTC6811_Typdef* LTC6811)
 
 }
 
+/*******************************************************************************
+********************************************************************************
+***************								Wake Up Pulse				      	  	   ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Only sends the wake up activity, so several chips can be woken and
+ * then waited for LTC6811_WAKE_TIME_MS once.
+ */
+void LTC6811_Wake_Up_Pulse(LTC6811_Typdef* LTC6811) 
+{
+    uint8_t wake_frame[2] = { 0x00, 0x00 };
+    LTC6811_SPI_Transfer(LTC6811, wake_frame, 2);
+}
+
+/*******************************************************************************
+********************************************************************************
+***************							WRITE DEFAULT CFG				      	  	 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Writes the power up configuration (no balancing) whatever the cached
+ * balancing state is, and checks it reading it back.
+ */
+void LTC6811_Write_Default_Config(LTC6811_Typdef* LTC6811) 
+{
+    memset(LTC6811->Config, 0, 6);
+    LTC6811_Write_CFG(LTC6811);
+
+    uint8_t read_cfg[6] = {0};
+    if (LTC6811_Read_CFG(LTC6811, read_cfg) && read_cfg[4] == 0x00 && (read_cfg[5] & LTC6811_CFGR5_DCC_MASK) == 0x00)
+    {
+        LTC6811->Balancing = NO_BALANCING;
+    }
+    else
+    {
+        LTC6811->Fail = TRUE;
+    }
+}
+
 /*******************************************************************************
 ********************************************************************************
 ***************								WRITE CFG					      	  	   ***************	
@@ -266,10 +377,7 @@ void LTC6811_Write_CFG(LTC6811_Typdef* LTC6811)
     uint8_t tx[12];
 
     // Comando WRCFG con su PEC15
-    tx[0] = 0x00;
-    tx[1] = 0x01;
-    tx[2] = 0x3D; // PEC15 MSB para 0x0001
-    tx[3] = 0x6E; // PEC15 LSB
+    LTC6811_Build_Command(LTC6811_CMD_WRCFG, tx);
 
     // Configuracin
     memcpy(&tx[4], LTC6811->Config, 6);
@@ -279,59 +387,75 @@ void LTC6811_Write_CFG(LTC6811_Typdef* LTC6811)
     tx[11] = pec & 0xFF;
 
     // Transmisin con CS bajo durante todo el mensaje
-    HAL_GPIO_WritePin(LTC6811->CS_PORT, LTC6811->CS_PIN, GPIO_PIN_RESET);
-    for (volatile int i = 0; i < 500; i++) __NOP();
-
-    HAL_StatusTypeDef status = HAL_SPI_Transmit(LTC6811->SPI_Handler, tx, 12, HAL_MAX_DELAY);
-
-    for (volatile int i = 0; i < 500; i++) __NOP();
-    HAL_GPIO_WritePin(LTC6811->CS_PORT, LTC6811->CS_PIN, GPIO_PIN_SET);
-
-    if (status != HAL_OK)
-		{
-        LTC6811->Fail = TRUE;
-		}
-
+    LTC6811_SPI_Transfer(LTC6811, tx, 12);
 }
 
 
 /*******************************************************************************
 ********************************************************************************
-***************										wait ADC				      	  	   ***************	
+***************										ADC Done				      	  	   ***************	
 ********************************************************************************
 *******************************************************************************/
-BoolTypeDef LTC6811_Wait_ADC_Completion(LTC6811_Typdef* LTC6811, uint16_t timeout_ms)
+/**
+ * @brief One PLADC poll, SDO is held low while the conversion is running.
+ */
+BoolTypeDef LTC6811_ADC_Done(LTC6811_Typdef* LTC6811)
 {
-    uint8_t cmd[4] = { 0x07, 0x14, 0x65, 0xAF }; // PLADC + PEC15
+    uint8_t cmd[4];
     uint8_t response[4] = {0};
-    uint8_t dummy_tx[4] = {0x00, 0x00, 0x00, 0x00};
 
-    uint32_t start = HAL_GetTick();
+    LTC6811_Build_Command(LTC6811_CMD_PLADC, cmd);
+    LTC6811_SPI_Transmit_Receive(LTC6811, cmd, response, 4, 4);
 
-    while ((HAL_GetTick() - start) < timeout_ms)
-    {
-        // Enviar comando PLADC y leer 4 bytes
-        LTC6811_SPI_Transmit_Receive(LTC6811, cmd, response, 4, 4);
-
-        // response[0] = status byte (otros son padding y PEC)
-        if (response[0] & 0x01)
-            return TRUE; // ADC termin
+    // response[0] = status byte (otros son padding y PEC)
+    return (response[0] & 0x01) ? TRUE : FALSE;
+}
+/*******************************************************************************
+********************************************************************************
+***************								START ADC				      	  	   ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Starts the all cell conversion, LTC6811_ADC_Done tells when it ends.
+ * With Sum_Of_Cells the same conversion also measures SC (ADCVSC).
+ */
+void LTC6811_Start_ADC_Conv(LTC6811_Typdef* LTC6811, BoolTypeDef Sum_Of_Cells) {
+    uint8_t cmd[4];
+    if (Sum_Of_Cells == TRUE) {
+        LTC6811_Build_Command(LTC6811_ADCVSC(LTC6811_ADC_MODE, 0), cmd);
+    } else {
+        LTC6811_Build_Command(LTC6811_ADCV(LTC6811_ADC_MODE, 0, 0), cmd); // ADCV: All cells, no discharge
     }
+    LTC6811_SPI_Transfer(LTC6811, cmd, 4);
+}
 
-    return FALSE; // timeout
+/*******************************************************************************
+********************************************************************************
+***************								SEND COMMAND				      	  	   ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Sends a command without data, the self-tests and status conversions.
+ */
+void LTC6811_Send_Command(LTC6811_Typdef* LTC6811, uint16_t Command) {
+    uint8_t cmd[4];
+    LTC6811_Build_Command(Command, cmd);
+    LTC6811_SPI_Transfer(LTC6811, cmd, 4);
 }
+
 /*******************************************************************************
 ********************************************************************************
-***************								START ADC				      	  	   ***************	
+***************								START OPEN WIRE				      	  	 ***************	
 ********************************************************************************
 *******************************************************************************/
-void LTC6811_Start_ADC_Conv(LTC6811_Typdef* LTC6811) {
-    uint8_t cmd[4] = { 0x03, 0x60, 0xF4, 0x6C }; // ADCV: All cells
+/**
+ * @brief Starts an all cell conversion with the ADOW pull-up or pull-down
+ * current on the inputs, LTC6811_ADC_Done tells when it ends.
+ */
+void LTC6811_Start_Open_Wire_Conv(LTC6811_Typdef* LTC6811, BoolTypeDef Pull_Up) {
+    uint8_t cmd[4];
+    LTC6811_Build_Command(LTC6811_ADOW(LTC6811_ADC_MODE, (Pull_Up == TRUE) ? 1 : 0, 0, 0), cmd);
     LTC6811_SPI_Transfer(LTC6811, cmd, 4);
-		
-		if (!LTC6811_Wait_ADC_Completion(LTC6811, 5)) { // espera hasta 5 ms
-        LTC6811->Fail = TRUE; // ADC no respondi a tiempo
-    }
 }
 
 /*******************************************************************************
@@ -344,7 +468,7 @@ void LTC_Active_Even_Balancing(LTC6811_Typdef* LTC6811)
 		if(LTC6811->Balancing!=EVEN_BALANCING)
 		{
 			memset(LTC6811->Config, 0, 6);
-			LTC6811->Config[0] = 0b00000001; // REFON = 1, ADCOPT = 0
+			LTC6811->Config[0] = LTC6811_CFGR0_REFON; // REFON = 1, ADCOPT = 0
 			LTC6811->Config[4] = 0b10101010; // DCC bits pares: 2,4,6,8,10,12
 			LTC6811->Config[5] = 0b00001010;
 			LTC6811_Write_CFG(LTC6811);
@@ -353,7 +477,7 @@ void LTC_Active_Even_Balancing(LTC6811_Typdef* LTC6811)
 			// Confirmacin con RDCFG
         uint8_t read_cfg[6];
         if (LTC6811_Read_CFG(LTC6811, read_cfg)) {
-            if (read_cfg[4] == 0xAA && (read_cfg[5] & 0x0F) == 0x0A) {
+            if (read_cfg[4] == 0xAA && (read_cfg[5] & LTC6811_CFGR5_DCC_MASK) == 0x0A) {
                 LTC6811->Balancing = EVEN_BALANCING;
             } else {
                 LTC6811->Fail = TRUE;
@@ -378,7 +502,7 @@ void LTC_Active_Odd_Balancing(LTC6811_Typdef* LTC6811)
 		if(LTC6811->Balancing!=ODD_BALANCING)
 		{
 			memset(LTC6811->Config, 0, 6);
-			LTC6811->Config[0] = 0b00000001; // REFON = 1, ADCOPT = 0
+			LTC6811->Config[0] = LTC6811_CFGR0_REFON; // REFON = 1, ADCOPT = 0
 			LTC6811->Config[4] = 0b01010101; // DCC bits impares
 			LTC6811->Config[5] = 0b00000101;
 			LTC6811_Write_CFG(LTC6811);
@@ -387,7 +511,7 @@ void LTC_Active_Odd_Balancing(LTC6811_Typdef* LTC6811)
 			// Confirmar que se aplic correctamente
         uint8_t read_cfg[6];
         if (LTC6811_Read_CFG(LTC6811, read_cfg)) {
-            if (read_cfg[4] == 0x55 && (read_cfg[5] & 0x0F) == 0x05) {
+            if (read_cfg[4] == 0x55 && (read_cfg[5] & LTC6811_CFGR5_DCC_MASK) == 0x05) {
                 LTC6811->Balancing = ODD_BALANCING;
             } else {
                 LTC6811->Fail = TRUE;
@@ -422,7 +546,7 @@ void LTC_Disable_Balancing(LTC6811_Typdef* LTC6811)
         if (LTC6811_Read_CFG(LTC6811, read_cfg))
         {
             // Comprobamos que DCC bits (bytes 4 y 5) estn en 0
-            if (read_cfg[4] == 0x00 && (read_cfg[5] & 0x0F) == 0x00) {
+            if (read_cfg[4] == 0x00 && (read_cfg[5] & LTC6811_CFGR5_DCC_MASK) == 0x00) {
                 // Confirmacin OK
                 LTC6811->Balancing = NO_BALANCING;
             } else {
@@ -442,17 +566,45 @@ void LTC_Disable_Balancing(LTC6811_Typdef* LTC6811)
 			
 }
 
+/*******************************************************************************
+********************************************************************************
+***************								Cell Discharge				     		 		 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Turns on the discharge of the given cells (bit 0 is cell 1) with the
+ * DCTO timeout, so the chip stops it alone if it is not written again. The
+ * measurement phases overwrite it. Returns FALSE if the read back differs.
+ */
+BoolTypeDef LTC6811_Write_Discharge(LTC6811_Typdef* LTC6811, uint16_t Cells, uint8_t Timeout)
+{
+    memset(LTC6811->Config, 0, 6);
+    // The reference stays up, a conversion right after does not wait tREFUP
+    LTC6811->Config[0] = LTC6811_CFGR0_REFON;
+    LTC6811->Config[4] = (uint8_t)Cells;
+    LTC6811->Config[5] = (uint8_t)((Cells >> 8) & LTC6811_CFGR5_DCC_MASK);
+    if (Cells != 0)
+    {
+        LTC6811->Config[5] |= LTC6811_CFGR5_DCTO(Timeout);
+    }
+    LTC6811_Write_CFG(LTC6811);
+    LTC6811->Balancing = (Cells != 0) ? CELL_BALANCING : NO_BALANCING;
+
+    uint8_t read_cfg[6] = {0};
+    return (LTC6811_Read_CFG(LTC6811, read_cfg) && read_cfg[4] == LTC6811->Config[4] &&
+            (read_cfg[5] & LTC6811_CFGR5_DCC_MASK) == (LTC6811->Config[5] & LTC6811_CFGR5_DCC_MASK)) ? TRUE : FALSE;
+}
+
 /*******************************************************************************
 ********************************************************************************
 ***************								Read Cell Block				     		 ***************	
 ********************************************************************************
 *******************************************************************************/
-BoolTypeDef LTC6811_Read_Cell_Block(LTC6811_Typdef* LTC6811,uint8_t cmd1, uint8_t cmd2, uint16_t *cell_voltages) {
-    uint8_t tx[2] = {cmd1, cmd2};
-    uint8_t rx[8] = {0}; // 6 data + 2 PEC
+BoolTypeDef LTC6811_Read_Cell_Block(LTC6811_Typdef* LTC6811, uint16_t Command, uint16_t *cell_voltages) {
+    uint8_t rx[LTC6811_REG_FRAME_SIZE] = {0}; // 6 data + 2 PEC
+    uint8_t cmd[4];
 
-    uint16_t pec = LTC6811_PEC15_Calc(tx, 2);
-    uint8_t cmd[4] = {cmd1, cmd2, (uint8_t)(pec >> 8), (uint8_t)(pec & 0xFF)};
+    LTC6811_Build_Command(Command, cmd);
 
 		LTC6811_SPI_Transmit_Receive(LTC6811,cmd,rx,sizeof(cmd),sizeof(rx));
 
@@ -472,157 +624,336 @@ BoolTypeDef LTC6811_Read_Cell_Block(LTC6811_Typdef* LTC6811,uint8_t cmd1, uint8_
 }
 /*******************************************************************************
 ********************************************************************************
+***************								Read Sum Of Cells			     		 	 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief SC of the last ADCVSC or ADSTAT, in V.
+ */
+BoolTypeDef LTC6811_Read_Sum_Of_Cells(LTC6811_Typdef* LTC6811, float* Sum_Of_Cells) {
+    uint16_t Status[3];
+
+    if (LTC6811_Read_Cell_Block(LTC6811, LTC6811_CMD_RDSTATA, Status) == FALSE) {
+        return FALSE;
+    }
+    *Sum_Of_Cells = Status[0] * LTC6811_SC_LSB;
+    return TRUE;
+}
+/*******************************************************************************
+********************************************************************************
 ***************									Read_Voltages				     		 		***************	
 ********************************************************************************
 *******************************************************************************/
-void LTC_Read_All_Voltages(LTC6811_Typdef *LTC6811, float *voltages) 
-{
-    const struct {
-        uint8_t cmd1;
-        uint8_t cmd2;
-        uint8_t index;
-    } blocks[] = {
-        {0x04, 0x00, 0}, // RDCVA: C1C3
-        {0x06, 0x00, 3}, // RDCVB: C4C6
-        {0x08, 0x00, 6}, // RDCVC: C7C9
-        {0x0A, 0x00, 9}  // RDCVD: C10C12
-    };
+static const uint16_t LTC6811_Cell_Group_Commands[LTC6811_CELL_GROUPS] = {
+    LTC6811_CMD_RDCVA, // RDCVA: C1C3
+    LTC6811_CMD_RDCVB, // RDCVB: C4C6
+    LTC6811_CMD_RDCVC, // RDCVC: C7C9
+    LTC6811_CMD_RDCVD  // RDCVD: C10C12
+};
 
+/**
+ * @brief One register group, three cells from voltages[3*Group], in V. A
+ * single transfer, the caller decides on the retry.
+ */
+BoolTypeDef LTC6811_Read_Cell_Group(LTC6811_Typdef* LTC6811, uint8_t Group, float *voltages)
+{
     uint16_t buf[3];
 
-    for (int i = 0; i < 4; i++) {
-        BoolTypeDef success = FALSE;
+    if (LTC6811_Read_Cell_Block(LTC6811, LTC6811_Cell_Group_Commands[Group], buf) == FALSE) {
+        return FALSE;
+    }
+    voltages[3*Group + 0] = buf[0] * 0.0001f;
+    voltages[3*Group + 1] = buf[1] * 0.0001f;
+    voltages[3*Group + 2] = buf[2] * 0.0001f;
+    return TRUE;
+}
 
+void LTC_Read_All_Voltages(LTC6811_Typdef *LTC6811, float *voltages) 
+{
+    for (uint8_t i = 0; i < LTC6811_CELL_GROUPS; i++) {
         // Hasta 2 intentos
-        for (int attempt = 0; attempt < 2; attempt++) {
-            if (LTC6811_Read_Cell_Block(LTC6811, blocks[i].cmd1, blocks[i].cmd2, buf)) {
-                voltages[blocks[i].index + 0] = buf[0] * 0.0001f;
-                voltages[blocks[i].index + 1] = buf[1] * 0.0001f;
-                voltages[blocks[i].index + 2] = buf[2] * 0.0001f;
-                success = TRUE;
-                break;
-            }
+        if (LTC6811_Read_Cell_Group(LTC6811, i, voltages) == FALSE &&
+            LTC6811_Read_Cell_Group(LTC6811, i, voltages) == FALSE) {
+            LTC6811->Fail = TRUE;
         }
+    }
+}
 
-        if (!success) {
-            LTC6811->Fail = TRUE;
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibrated Temperature			     	 ***************	
+********************************************************************************
+*******************************************************************************/
+// Readings out of the table keep the out of range value, the checks rely on it
+static float LTC6811_Calibrated_Temperature(const Calibration_TypeDef* Calibration, uint8_t Channel, float v)
+{
+    float Temperature = LTC_Voltage_to_Temperature_Curve(Calibration->Curve[Channel], v);
+
+    if (Temperature == LTC6811_TEMPERATURE_OUT_OF_RANGE)
+    {
+        return Temperature;
+    }
+    return Temperature * Calibration->Temperature_Gain[Channel] + Calibration->Temperature_Offset[Channel];
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Acquisition Store			     	 	 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief The cells with their discharge switch on read the temperature
+ * sensors, the others the cell voltages. The even phase balances the even
+ * cells (odd indexes), the odd phase the odd ones.
+ */
+static void LTC6811_Acquisition_Store(Control_Unit_TypeDef* Control_Unit)
+{
+    Acquisition_TypeDef* Acquisition=&Control_Unit->Acquisition;
+    uint8_t First_Temperature=(Acquisition->Phase==ACQUISITION_EVEN_PHASE) ? 1 : 0;
+    uint32_t Read=0;
+
+    // Each phase reads half of the sensors, the scan is complete after both.
+    // The scan statistics are gathered as the values are converted
+    for (int i = First_Temperature; i < 24; i += 2) 
+		{
+        const float* Voltages = (i < 12) ? Acquisition->Voltages_1 : Acquisition->Voltages_2;
+        float Temperature = LTC6811_Calibrated_Temperature(&Control_Unit->Calibration, i, Voltages[i % 12]);
+        Control_Unit->Status.Temperatures.Readed_Value[i] = Temperature;
+        Read |= (1UL<<i);
+        if ((Control_Unit->Status.Temperatures.Disabled & (1UL<<i)) == 0 && Temperature != LTC6811_TEMPERATURE_OUT_OF_RANGE)
+        {
+            Cell_Stats_Add(&Control_Unit->Cell_Stats.Temperature, i, Temperature);
         }
     }
+    Control_Unit->Status.Temperatures.Stale &= ~Read;
+
+    Read=0;
+    for (int i = 1-First_Temperature; i < 24; i += 2) 
+		{
+        const float* Voltages = (i < 12) ? Acquisition->Voltages_1 : Acquisition->Voltages_2;
+        float Voltage = Voltages[i % 12] * Control_Unit->Calibration.Voltage_Gain[i] + Control_Unit->Calibration.Voltage_Offset[i];
+        Control_Unit->Status.Voltages[i] = Voltage;
+        Read |= (1UL<<i);
+        Cell_Stats_Add(&Control_Unit->Cell_Stats.Voltage, i, Voltage);
+    }
+    Control_Unit->Status.Voltages_Stale &= ~Read;
 }
 
 
 /*******************************************************************************
 ********************************************************************************
-***************									LTC Measure (UNUSED)			     	 ***************	
+***************									Acquisition Fail			     	 	 ***************	
+********************************************************************************
+*******************************************************************************/
+static Acquisition_Step_TypeDef LTC6811_Acquisition_Fail(Control_Unit_TypeDef* Control_Unit)
+{
+    Control_Unit->Acquisition.Step=ACQUISITION_FAILED;
+    Control_Unit->State=LTC6811_FAIL_MODE;
+    return ACQUISITION_FAILED;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Acquisition Start			     	 	 ***************	
+********************************************************************************
+*******************************************************************************/
+void LTC6811_Acquisition_Start(Control_Unit_TypeDef* Control_Unit)
+{
+    Control_Unit->Acquisition.Step=ACQUISITION_WAKE;
+    Control_Unit->Acquisition.Phase=ACQUISITION_EVEN_PHASE;
+    Control_Unit->Acquisition.Start_Tick=MCU_Get_Tick();
+    Control_Unit->Status.Temperatures.Stale=BPCU_CHANNEL_MASK;
+    Control_Unit->Status.Voltages_Stale=BPCU_CHANNEL_MASK;
+    Control_Unit->Sum_Check.Vote=0;
+    Cell_Stats_Scan_Start(Control_Unit);
+    Balancing_Pause(Control_Unit);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Acquisition Task			     	 	 ***************	
 ********************************************************************************
 *******************************************************************************/
 /**
  * @brief Mide las temperaturas y voltajes de las celdas conectadas a dos LTC6811
  * 
- * Esta funcin activa el balanceo de celdas de manera alterna (pares/impares), 
- * mide los voltajes de las 12 celdas por LTC, convierte las lecturas a temperaturas 
- * (para las celdas pares en una pasada y las impares en la otra) y almacena 
- * los resultados en los arreglos TempArray y VoltajeArray.
+ * Cada fase (pares e impares) activa el balanceo, deja estabilizar, convierte,
+ * lee las 12 celdas de cada LTC y desactiva el balanceo. Called from the main
+ * loop until it gives ACQUISITION_DONE or ACQUISITION_FAILED, each call runs
+ * at most one step: the waits return at once and the ADC is polled once per
+ * call, with a timeout. On failure the unit enters LTC6811_FAIL_MODE.
  *
  * @param[in,out] Control_Unit   Puntero a la unidad de control que contiene el estado de los dos LTC6811.
- * @param[out]    TempArray      Arreglo de 24 elementos donde se guardan temperaturas codificadas. 
- *                               Las primeras 12 son del LTC6811_1, las ltimas 12 del LTC6811_2.
- * @param[out]    VoltajeArray   Arreglo de 24 elementos donde se guardan voltajes. 
- *                               Misma distribucin que TempArray.
  */
-void LTC6811_Measure_Temperatures_and_Voltages(Control_Unit_TypeDef* Control_Unit)
+Acquisition_Step_TypeDef LTC6811_Acquisition_Task(Control_Unit_TypeDef* Control_Unit)
 {
-    float voltages_1[12]; // Voltajes de las 12 celdas del LTC6811_1
-    float voltages_2[12]; // Voltajes de las 12 celdas del LTC6811_2
-
-    // Despierta ambos LTC6811
-    LTC6811_Wake_Up(&Control_Unit->Status.LTC6811_1);
-    LTC6811_Wake_Up(&Control_Unit->Status.LTC6811_2);
-    HAL_Delay(1); 
-
-    // === Medicin de celdas pares ===
-    // Activa el balanceo de celdas pares
-    LTC_Active_Even_Balancing(&Control_Unit->Status.LTC6811_1);
-    LTC_Active_Even_Balancing(&Control_Unit->Status.LTC6811_2);
-    HAL_Delay(5); // Permite estabilizacin
-
-    // Inicia conversin ADC en ambos LTC
-    LTC6811_Start_ADC_Conv(&Control_Unit->Status.LTC6811_1);
-    LTC6811_Start_ADC_Conv(&Control_Unit->Status.LTC6811_2);
-    HAL_Delay(3); // Espera la finalizacin de la conversin
-
-    // Lee los voltajes
-    LTC_Read_All_Voltages(&Control_Unit->Status.LTC6811_1, voltages_1);
-    LTC_Read_All_Voltages(&Control_Unit->Status.LTC6811_2, voltages_2);
-
-    // Convertir voltajes pares a temperaturas (ndices impares)
-    for (int i = 1; i < 12; i += 2) 
-		{
-        Control_Unit->Status.Temperatures[i].Readed_Value = LTC_Voltage_to_Temperature(voltages_1[i]);
-        Control_Unit->Status.Temperatures[i+12].Readed_Value = LTC_Voltage_to_Temperature(voltages_2[i]);
-    }
+    Acquisition_TypeDef* Acquisition=&Control_Unit->Acquisition;
+    LTC6811_Typdef* LTC6811_1=&Control_Unit->Status.LTC6811_1;
+    LTC6811_Typdef* LTC6811_2=&Control_Unit->Status.LTC6811_2;
+    uint32_t Now=MCU_Get_Tick();
 
-    // Guardar voltajes de celdas impares (ndices pares)
-    for (int i = 0; i < 12; i += 2) 
-		{
-        Control_Unit->Status.Voltages[i] = voltages_1[i];
-        Control_Unit->Status.Voltages[i + 12] = voltages_2[i];
-    }
+    switch(Acquisition->Step)
+    {
+        case ACQUISITION_WAKE:
+            LTC6811_Wake_Up_Pulse(LTC6811_1);
+            LTC6811_Wake_Up_Pulse(LTC6811_2);
+            Acquisition->Step_Tick=Now;
+            Acquisition->Step=ACQUISITION_CONFIG;
+        break;
+
+        case ACQUISITION_CONFIG:
+            if(Acquisition->Phase==ACQUISITION_EVEN_PHASE && Now-Acquisition->Step_Tick<LTC6811_WAKE_TIME_MS)
+            {
+                break;
+            }
+            if(Acquisition->Phase==ACQUISITION_ODD_PHASE && Now-Acquisition->Step_Tick<LTC6811_SETTLE_TIME_MS)
+            {
+                break;
+            }
+            if(Acquisition->Phase==ACQUISITION_EVEN_PHASE)
+            {
+                LTC_Active_Even_Balancing(LTC6811_1);
+                LTC_Active_Even_Balancing(LTC6811_2);
+            }
+            else
+            {
+                LTC_Active_Odd_Balancing(LTC6811_1);
+                LTC_Active_Odd_Balancing(LTC6811_2);
+            }
+            if(LTC6811_1->Fail==TRUE || LTC6811_2->Fail==TRUE)
+            {
+                return LTC6811_Acquisition_Fail(Control_Unit);
+            }
+            Acquisition->Step_Tick=Now;
+            Acquisition->Step=ACQUISITION_SETTLE;
+        break;
+
+        case ACQUISITION_SETTLE:
+            if(Now-Acquisition->Step_Tick>=LTC6811_SETTLE_TIME_MS)
+            {
+                LTC6811_Start_ADC_Conv(LTC6811_1, Sum_Check_Enabled(Control_Unit));
+                LTC6811_Start_ADC_Conv(LTC6811_2, Sum_Check_Enabled(Control_Unit));
+                Acquisition->ADC_Done_1=FALSE;
+                Acquisition->ADC_Done_2=FALSE;
+                Acquisition->Step_Tick=Now;
+                Acquisition->Step=ACQUISITION_CONVERT;
+            }
+        break;
 
-		
-    // Desactiva balanceo
-    LTC_Disable_Balancing(&Control_Unit->Status.LTC6811_1);
-    LTC_Disable_Balancing(&Control_Unit->Status.LTC6811_2);
-    HAL_Delay(5);
+        case ACQUISITION_CONVERT:
+            if(Now-Acquisition->Step_Tick<LTC6811_ADCV_TIME_MS)
+            {
+                break;
+            }
+            if(Acquisition->ADC_Done_1==FALSE)
+            {
+                Acquisition->ADC_Done_1=LTC6811_ADC_Done(LTC6811_1);
+            }
+            if(Acquisition->ADC_Done_2==FALSE)
+            {
+                Acquisition->ADC_Done_2=LTC6811_ADC_Done(LTC6811_2);
+            }
+            if(Acquisition->ADC_Done_1==TRUE && Acquisition->ADC_Done_2==TRUE)
+            {
+                Acquisition->Read=0;
+                Acquisition->Read_Retry=FALSE;
+                Acquisition->Step=ACQUISITION_READ;
+            }
+            else if(Now-Acquisition->Step_Tick>=LTC6811_ADC_TIMEOUT_MS)
+            {
+                // ADC no respondi a tiempo
+                Acquisition->Timeouts++;
+                return LTC6811_Acquisition_Fail(Control_Unit);
+            }
+        break;
 
-		//Si ha fallado algo dejamos de medir
-		if(Control_Unit->Status.LTC6811_1.Fail==TRUE || Control_Unit->Status.LTC6811_2.Fail==TRUE)
-		{
-			Control_Unit->State=LTC6811_FAIL_MODE;
-			return;
-		}
-		
-    // === Medicin de celdas impares ===
-		// Activa el balanceo de celdas impares
-    LTC_Active_Odd_Balancing(&Control_Unit->Status.LTC6811_1);
-    LTC_Active_Odd_Balancing(&Control_Unit->Status.LTC6811_2);
-    HAL_Delay(5);
-
-		// Inicia conversin ADC en ambos LTC
-    LTC6811_Start_ADC_Conv(&Control_Unit->Status.LTC6811_1);
-    LTC6811_Start_ADC_Conv(&Control_Unit->Status.LTC6811_2);
-    HAL_Delay(3);
-
-    // Lee los voltajes
-    LTC_Read_All_Voltages(&Control_Unit->Status.LTC6811_1, voltages_1);
-    LTC_Read_All_Voltages(&Control_Unit->Status.LTC6811_2, voltages_2);
-
-    // Convertir voltajes impares a temperatura (ndices pares)
-    for (int i = 0; i < 12; i += 2) 
-		{
-        Control_Unit->Status.Temperatures[i].Readed_Value = LTC_Voltage_to_Temperature(voltages_1[i]);
-        Control_Unit->Status.Temperatures[i+12].Readed_Value = LTC_Voltage_to_Temperature(voltages_2[i]);
-    }
+        case ACQUISITION_READ:
+        {
+            // One register group of one chip per call, a single transfer of
+            // about 200 us. The cell groups come first, then the status group
+            // with SC when the sum check is on. A PEC error is read again on
+            // the next call, a second one fails the chip.
+            uint8_t Chip=Acquisition->Read & 1U;
+            uint8_t Group=Acquisition->Read >> 1;
+            uint8_t Groups=LTC6811_CELL_GROUPS+((Sum_Check_Enabled(Control_Unit)==TRUE) ? 1 : 0);
+            LTC6811_Typdef* LTC6811=(Chip==0) ? LTC6811_1 : LTC6811_2;
+
+            if(Group<LTC6811_CELL_GROUPS)
+            {
+                BoolTypeDef Read=LTC6811_Read_Cell_Group(LTC6811, Group, (Chip==0) ? Acquisition->Voltages_1 : Acquisition->Voltages_2);
+                if(Read==FALSE && Acquisition->Read_Retry==FALSE)
+                {
+                    Acquisition->Read_Retry=TRUE;
+                    break;
+                }
+                if(Read==FALSE)
+                {
+                    LTC6811->Fail=TRUE;
+                }
+            }
+            else if(LTC6811_Read_Sum_Of_Cells(LTC6811, &Acquisition->Sum_Of_Cells[Chip])==FALSE)
+            {
+                Acquisition->Sum_Of_Cells[Chip]=SUM_CHECK_NO_SC;
+            }
+            Acquisition->Read_Retry=FALSE;
+            if(++Acquisition->Read<2*Groups)
+            {
+                break;
+            }
 
-    // Guardar voltajes de celdas pares (ndices impares)
-    for (int i = 1; i < 12; i += 2) 
-		{
-        Control_Unit->Status.Voltages[i] = voltages_1[i];
-        Control_Unit->Status.Voltages[i + 12] = voltages_2[i];
+            // Readings not adding up to SC convert the same phase again for the vote
+            Sum_Check_Result_TypeDef Result=Sum_Check_Phase(Control_Unit);
+            if(Result==SUM_CHECK_REMEASURE)
+            {
+                LTC6811_Start_ADC_Conv(LTC6811_1, TRUE);
+                LTC6811_Start_ADC_Conv(LTC6811_2, TRUE);
+                Acquisition->ADC_Done_1=FALSE;
+                Acquisition->ADC_Done_2=FALSE;
+                Acquisition->Step_Tick=Now;
+                Acquisition->Step=ACQUISITION_CONVERT;
+                break;
+            }
+
+            if(Result==SUM_CHECK_STORE)
+            {
+                LTC6811_Acquisition_Store(Control_Unit);
+            }
+            Acquisition->Step=ACQUISITION_DISABLE;
+        }
+        break;
+
+        case ACQUISITION_DISABLE:
+            LTC_Disable_Balancing(LTC6811_1);
+            LTC_Disable_Balancing(LTC6811_2);
+
+            //Si ha fallado algo dejamos de medir
+            if(LTC6811_1->Fail==TRUE || LTC6811_2->Fail==TRUE)
+            {
+                return LTC6811_Acquisition_Fail(Control_Unit);
+            }
+            if(Acquisition->Phase==ACQUISITION_EVEN_PHASE)
+            {
+                Acquisition->Phase=ACQUISITION_ODD_PHASE;
+                Acquisition->Step_Tick=Now;
+                Acquisition->Step=ACQUISITION_CONFIG;
+            }
+            else
+            {
+                Acquisition->Last_Duration=Now-Acquisition->Start_Tick;
+                Cell_Stats_Scan_End(Control_Unit);
+                Acquisition->Step=ACQUISITION_DONE;
+            }
+        break;
+
+        default:
+        break;
     }
 
-		
-		
-    // Desactiva balanceo al final (por seguridad)
-    LTC_Disable_Balancing(&Control_Unit->Status.LTC6811_1);
-    LTC_Disable_Balancing(&Control_Unit->Status.LTC6811_2);
-		
-		
-		//Si ha fallado algo dejamos de medir
-		if(Control_Unit->Status.LTC6811_1.Fail==TRUE || Control_Unit->Status.LTC6811_2.Fail==TRUE)
-		{
-			Control_Unit->State=LTC6811_FAIL_MODE;
-		}
+    return Acquisition->Step;
 }
 
 
@@ -31,11 +31,105 @@
 *******************************************************************************/
 #include "MCU.h"
 #include "Typedefs.h"
+#include "Capture.h"
 #include <stdint.h>
 #include <string.h>
 
 #define SPI_MAX_DELAY 200
 
+/*******************************************************************************
+********************************************************************************
+***************										Device Model      	  			 ***************	
+********************************************************************************
+*******************************************************************************/
+// Commands, sent MSB first followed by their PEC15 (datasheet command codes)
+#define LTC6811_CMD_WRCFG						0x0001
+#define LTC6811_CMD_RDCFG						0x0002
+#define LTC6811_CMD_RDCVA						0x0004		//C1-C3
+#define LTC6811_CMD_RDCVB						0x0006		//C4-C6
+#define LTC6811_CMD_RDCVC						0x0008		//C7-C9
+#define LTC6811_CMD_RDCVD						0x000A		//C10-C12
+#define LTC6811_CMD_PLADC						0x0714
+#define LTC6811_CMD_ADCV						0x0260
+#define LTC6811_ADCV(MD,DCP,CH)			(LTC6811_CMD_ADCV | ((MD)<<7) | ((DCP)<<4) | (CH))
+#define LTC6811_CMD_ADCVSC					0x0467		//All cells and the sum of cells
+#define LTC6811_ADCVSC(MD,DCP)			(LTC6811_CMD_ADCVSC | ((MD)<<7) | ((DCP)<<4))
+#define LTC6811_CMD_ADOW						0x0228
+#define LTC6811_ADOW(MD,PUP,DCP,CH)	(LTC6811_CMD_ADOW | ((MD)<<7) | ((PUP)<<6) | ((DCP)<<4) | (CH))
+#define LTC6811_CMD_RDAUXA					0x000C		//G1-G3
+#define LTC6811_CMD_RDAUXB					0x000E		//G4, G5, REF
+#define LTC6811_CMD_RDSTATA					0x0010		//SC, ITMP, VA
+#define LTC6811_CMD_RDSTATB					0x0012		//VD, CV flags, REV, MUXFAIL, THSD
+#define LTC6811_CVST(MD,ST)					(0x0207 | ((MD)<<7) | ((ST)<<5))
+#define LTC6811_AXST(MD,ST)					(0x0407 | ((MD)<<7) | ((ST)<<5))
+#define LTC6811_ADSTAT(MD,CHST)			(0x0468 | ((MD)<<7) | (CHST))
+#define LTC6811_CMD_DIAGN						0x0715
+
+// Status register group: SC is 20 times the ADC LSB, ITMP 7.5 mV/K from 0 K,
+// last byte REV[7:4] MUXFAIL[1] THSD[0]
+#define LTC6811_ADC_LSB							0.0001f		//V
+#define LTC6811_SC_LSB							(20.0f*LTC6811_ADC_LSB)
+#define LTC6811_ITMP_TO_C(Code)			((Code)*LTC6811_ADC_LSB/0.0075f-273.0f)
+#define LTC6811_STBR5_REV(Byte)			((uint8_t)((Byte)>>4))
+#define LTC6811_STBR5_MUXFAIL				0x02
+#define LTC6811_STBR5_THSD					0x01
+#define LTC6811_ADCV_MASK						0xFE68		//Clears MD, DCP and CH
+#define LTC6811_ADCVSC_MASK					0xFE6F		//Clears MD and DCP
+
+// Register groups are 6 data bytes plus the PEC15
+#define LTC6811_REG_GROUP_SIZE			6
+#define LTC6811_REG_FRAME_SIZE			8
+#define LTC6811_CELL_GROUPS					4					//RDCVA to RDCVD, three cells each
+
+// CFGR0 bits, CFGR4 holds DCC8-DCC1 and the low nibble of CFGR5 DCC12-DCC9
+#define LTC6811_CFGR0_ADCOPT				0x01
+#define LTC6811_CFGR0_DTEN					0x02
+#define LTC6811_CFGR0_REFON					0x04
+#define LTC6811_CFGR5_DCC_MASK			0x0F
+#define LTC6811_CFGR5_DCTO(Code)		((uint8_t)((Code)<<4))	//Discharge timeout, 0 disabled
+#define LTC6811_DCTO_30S						0x1
+
+// ADC modes with ADCOPT=0 and their all cell conversion time (tCYCLE)
+#define LTC6811_MD_FAST							1					//27 kHz
+#define LTC6811_MD_NORMAL						2					//7 kHz
+#define LTC6811_MD_FILTERED					3					//26 Hz
+#define LTC6811_ADCV_TIME_US_FAST		1113
+#define LTC6811_ADCV_TIME_US_NORMAL	2335
+#define LTC6811_ADCV_TIME_US_FILTERED	201317
+
+#define LTC6811_ADC_MODE						LTC6811_MD_NORMAL
+#define LTC6811_ADCV_TIME_US				LTC6811_ADCV_TIME_US_NORMAL
+#define LTC6811_ADCV_TIME_MS				((LTC6811_ADCV_TIME_US+999)/1000)
+// ADCVSC adds the sum of cells as one more conversion slot to the six of ADCV
+#define LTC6811_ADCVSC_TIME_US			(LTC6811_ADCV_TIME_US+LTC6811_ADCV_TIME_US/6)
+#define LTC6811_ADC_TIMEOUT_MS			((LTC6811_ADCVSC_TIME_US+999)/1000+2)
+
+// Digital filter self-test results of the selected mode, ST=1 and ST=2. Only
+// 27 kHz (ADCOPT=0) differs, 7 kHz and 26 Hz give the same codes
+#if LTC6811_ADC_MODE==LTC6811_MD_FAST
+#define LTC6811_SELF_TEST_1					0x9565
+#define LTC6811_SELF_TEST_2					0x6A9A
+#else
+#define LTC6811_SELF_TEST_1					0x9555
+#define LTC6811_SELF_TEST_2					0x6AAA
+#endif
+
+// Settling after a balancing change, before converting or changing it again
+#define LTC6811_SETTLE_TIME_MS			5
+
+// Chip select guard before the first and after the last SCK edge, covers the
+// isoSPI tREADY (10 us) with margin
+#define LTC6811_CS_GUARD_US					20
+
+// Thermistor tables available for the per channel calibration
+#define LTC6811_TEMPERATURE_CURVES	1
+#define LTC6811_TEMPERATURE_OUT_OF_RANGE	-100.0f
+
+// tWAKE is 400 us max, two ticks guarantee at least one full ms
+#define LTC6811_WAKE_TIME_MS 2
+// The core goes back to sleep after tSLEEP (1.8 s min) without valid commands
+#define LTC6811_SLEEP_TIMEOUT_MS 1800
+
 
 
 /*******************************************************************************
@@ -54,6 +148,7 @@ void LTC6811_Init(Control_Unit_TypeDef* Control_Unit);
 *******************************************************************************/
 uint8_t LTC6811_Enconde_Temp(float Temp);
 float LTC_Voltage_to_Temperature(float v);
+float LTC_Voltage_to_Temperature_Curve(uint8_t Curve, float v);
 uint8_t LTC6811_Encode_Volt_10mV(float volt);
 
 
@@ -73,13 +168,23 @@ void LTC6811_SPI_Transmit_Receive(LTC6811_Typdef* LTC6811, uint8_t *tx, uint8_t
 ********************************************************************************
 *******************************************************************************/
 uint16_t LTC6811_PEC15_Calc(uint8_t *data, uint8_t len);
+void LTC6811_Build_Command(uint16_t Command, uint8_t* cmd);
 void LTC6811_Wake_Up(LTC6811_Typdef* LTC6811); 
+void LTC6811_Wake_Up_Pulse(LTC6811_Typdef* LTC6811);
+void LTC6811_Write_Default_Config(LTC6811_Typdef* LTC6811);
 void LTC6811_Write_CFG(LTC6811_Typdef* LTC6811); 
-void LTC6811_Start_ADC_Conv(LTC6811_Typdef* LTC6811);
+void LTC6811_Start_ADC_Conv(LTC6811_Typdef* LTC6811, BoolTypeDef Sum_Of_Cells);
+void LTC6811_Start_Open_Wire_Conv(LTC6811_Typdef* LTC6811, BoolTypeDef Pull_Up);
+void LTC6811_Send_Command(LTC6811_Typdef* LTC6811, uint16_t Command);
+BoolTypeDef LTC6811_ADC_Done(LTC6811_Typdef* LTC6811);
 void LTC_Active_Even_Balancing(LTC6811_Typdef* LTC6811); 
 void LTC_Active_Odd_Balancing(LTC6811_Typdef* LTC6811);
 void LTC_Disable_Balancing(LTC6811_Typdef* LTC6811);
-BoolTypeDef LTC6811_Read_Cell_Block(LTC6811_Typdef* LTC6811,uint8_t cmd1, uint8_t cmd2, uint16_t *cell_voltages);
+BoolTypeDef LTC6811_Write_Discharge(LTC6811_Typdef* LTC6811, uint16_t Cells, uint8_t Timeout);
+BoolTypeDef LTC6811_Read_Cell_Block(LTC6811_Typdef* LTC6811, uint16_t Command, uint16_t *cell_voltages);
+BoolTypeDef LTC6811_Read_Cell_Group(LTC6811_Typdef* LTC6811, uint8_t Group, float *voltages);
+
+BoolTypeDef LTC6811_Read_Sum_Of_Cells(LTC6811_Typdef* LTC6811, float* Sum_Of_Cells);
 
 /*******************************************************************************
 ********************************************************************************
@@ -94,7 +199,8 @@ void LTC_Read_All_Voltages(LTC6811_Typdef *LTC6811, float *voltages);
 ***************							Funciones de Lectura Combinada			 ***************	
 ********************************************************************************
 *******************************************************************************/
-void LTC6811_Measure_Temperatures_and_Voltages(Control_Unit_TypeDef* Control_Unit);
+void LTC6811_Acquisition_Start(Control_Unit_TypeDef* Control_Unit);
+Acquisition_Step_TypeDef LTC6811_Acquisition_Task(Control_Unit_TypeDef* Control_Unit);
 
 
 #endif	
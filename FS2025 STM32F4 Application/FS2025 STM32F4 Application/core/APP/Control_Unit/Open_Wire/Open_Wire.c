@@ -0,0 +1,264 @@
+/**
+  ******************************************************************************
+  * @file           : Open_Wire.c
+  * @brief          : Open wire detection
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Open_Wire.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Open Wire Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Open_Wire_Init(Control_Unit_TypeDef* Control_Unit, uint32_t Period_Word)
+{
+	memset(&Control_Unit->Open_Wire, 0, sizeof(Open_Wire_TypeDef));
+	Control_Unit->Open_Wire.Step=OPEN_WIRE_IDLE;
+
+	uint32_t Period_S=(Period_Word<=OPEN_WIRE_MAX_PERIOD_S) ? Period_Word : OPEN_WIRE_DEFAULT_PERIOD_S;
+	Control_Unit->Open_Wire.Period=Period_S*1000;
+	Control_Unit->Open_Wire.Last_Check_Tick=MCU_Get_Tick();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Evaluate      	  	   				 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Open wires of one chip, bit n for Cn. Cell n is measured between
+ * Cn-1 and Cn, so each open wire flags the cells on both sides of it.
+ */
+static uint32_t Open_Wire_Evaluate(const float* Pull_Up, const float* Pull_Down)
+{
+	uint32_t Wires=0;
+	uint32_t Cells=0;
+
+	if(Pull_Up[0]<OPEN_WIRE_ZERO)
+	{
+		Wires|=1UL<<0;
+	}
+	if(Pull_Down[11]<OPEN_WIRE_ZERO)
+	{
+		Wires|=1UL<<12;
+	}
+	for(uint8_t n=1; n<12; n++)
+	{
+		if(Pull_Up[n]-Pull_Down[n]<OPEN_WIRE_DELTA_LIMIT)
+		{
+			Wires|=1UL<<n;
+		}
+	}
+
+	for(uint8_t n=0; n<=12; n++)
+	{
+		if(Wires & (1UL<<n))
+		{
+			Cells|=(n>0) ? 1UL<<(n-1) : 0;
+			Cells|=(n<12) ? 1UL<<n : 0;
+		}
+	}
+	return Cells;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Start      	  	   				 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+static BoolTypeDef Open_Wire_Can_Start(Control_Unit_TypeDef* Control_Unit)
+{
+	Open_Wire_TypeDef* Open_Wire=&Control_Unit->Open_Wire;
+
+	return (Open_Wire->Period!=0 &&
+		(Control_Unit->State==NORMAL_OPERATION || Control_Unit->State==TEMP_FAIL_MODE || Control_Unit->State==TEMP_PLUS_60_FAIL_MODE) &&
+		MCU_Get_Tick()-Open_Wire->Last_Check_Tick>=Open_Wire->Period &&
+		(Control_Unit->Balancing.Step==BALANCING_IDLE || Control_Unit->Balancing.Step==BALANCING_ON) &&
+		Control_Unit->Self_Test.Step==SELF_TEST_IDLE &&
+		Scan_Scheduler_Time_To_Scan(Control_Unit)>=OPEN_WIRE_WINDOW_MS) ? TRUE : FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Open Wire Task      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Runs the ADOW sequence one step per call in the gaps between scans:
+ * pull-up conversions and read, pull-down conversions and read, compare. A
+ * scan starting meanwhile cuts it, its own conversion overwrites the results,
+ * and the sequence starts again in the next gap. Balancing is paused for the
+ * sequence and selected again after the next scan.
+ */
+void Open_Wire_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	Open_Wire_TypeDef* Open_Wire=&Control_Unit->Open_Wire;
+	LTC6811_Typdef* LTC6811_1=&Control_Unit->Status.LTC6811_1;
+	LTC6811_Typdef* LTC6811_2=&Control_Unit->Status.LTC6811_2;
+	uint32_t Now=MCU_Get_Tick();
+
+	if(Control_Unit->Status.Read_Temperatures!=IDLE)
+	{
+		if(Open_Wire->Step!=OPEN_WIRE_IDLE)
+		{
+			Open_Wire->Aborts++;
+			Open_Wire->Step=OPEN_WIRE_IDLE;
+		}
+		return;
+	}
+
+	switch(Open_Wire->Step)
+	{
+		case OPEN_WIRE_IDLE:
+			if(Open_Wire_Can_Start(Control_Unit)==FALSE)
+			{
+				break;
+			}
+			Balancing_Pause(Control_Unit);
+			Open_Wire->Start_Tick=Now;
+			Open_Wire->Step=OPEN_WIRE_WAKE;
+		break;
+
+		case OPEN_WIRE_WAKE:
+			LTC6811_Wake_Up_Pulse(LTC6811_1);
+			LTC6811_Wake_Up_Pulse(LTC6811_2);
+			Open_Wire->Step_Tick=Now;
+			Open_Wire->Step=OPEN_WIRE_CONFIG;
+		break;
+
+		case OPEN_WIRE_CONFIG:
+			if(Now-Open_Wire->Step_Tick<LTC6811_WAKE_TIME_MS)
+			{
+				break;
+			}
+			if(LTC6811_Write_Discharge(LTC6811_1,0,0)==FALSE || LTC6811_Write_Discharge(LTC6811_2,0,0)==FALSE)
+			{
+				Open_Wire->Aborts++;
+				Open_Wire->Step=OPEN_WIRE_IDLE;
+				break;
+			}
+			Open_Wire->Pull_Up=TRUE;
+			Open_Wire->Conversions=0;
+			Open_Wire->Step=OPEN_WIRE_CONVERT;
+		break;
+
+		case OPEN_WIRE_CONVERT:
+			LTC6811_Start_Open_Wire_Conv(LTC6811_1,Open_Wire->Pull_Up);
+			LTC6811_Start_Open_Wire_Conv(LTC6811_2,Open_Wire->Pull_Up);
+			Open_Wire->Done_1=FALSE;
+			Open_Wire->Done_2=FALSE;
+			Open_Wire->Step_Tick=Now;
+			Open_Wire->Step=OPEN_WIRE_WAIT;
+		break;
+
+		case OPEN_WIRE_WAIT:
+			if(Now-Open_Wire->Step_Tick<LTC6811_ADCV_TIME_MS)
+			{
+				break;
+			}
+			if(Open_Wire->Done_1==FALSE)
+			{
+				Open_Wire->Done_1=LTC6811_ADC_Done(LTC6811_1);
+			}
+			if(Open_Wire->Done_2==FALSE)
+			{
+				Open_Wire->Done_2=LTC6811_ADC_Done(LTC6811_2);
+			}
+			if(Open_Wire->Done_1==TRUE && Open_Wire->Done_2==TRUE)
+			{
+				Open_Wire->Conversions++;
+				Open_Wire->Step=(Open_Wire->Conversions<OPEN_WIRE_CONVERSIONS) ? OPEN_WIRE_CONVERT : OPEN_WIRE_READ;
+			}
+			else if(Now-Open_Wire->Step_Tick>=LTC6811_ADC_TIMEOUT_MS)
+			{
+				Open_Wire->Timeouts++;
+				Open_Wire->Step=OPEN_WIRE_IDLE;
+			}
+		break;
+
+		case OPEN_WIRE_READ:
+		{
+			float* Voltages=(Open_Wire->Pull_Up==TRUE) ? Open_Wire->Pull_Up_Voltages : Open_Wire->Pull_Down_Voltages;
+
+			LTC_Read_All_Voltages(LTC6811_1,&Voltages[0]);
+			LTC_Read_All_Voltages(LTC6811_2,&Voltages[12]);
+			if(LTC6811_1->Fail==TRUE || LTC6811_2->Fail==TRUE)
+			{
+				// The next scan finds the link down and enters the fail mode
+				Open_Wire->Step=OPEN_WIRE_IDLE;
+				break;
+			}
+
+			if(Open_Wire->Pull_Up==TRUE)
+			{
+				Open_Wire->Pull_Up=FALSE;
+				Open_Wire->Conversions=0;
+				Open_Wire->Step=OPEN_WIRE_CONVERT;
+				break;
+			}
+
+			uint32_t Cells=Open_Wire_Evaluate(&Open_Wire->Pull_Up_Voltages[0],&Open_Wire->Pull_Down_Voltages[0]) |
+				(Open_Wire_Evaluate(&Open_Wire->Pull_Up_Voltages[12],&Open_Wire->Pull_Down_Voltages[12])<<12);
+
+			// A single check is not trusted, the cell must be open twice in a row
+			Open_Wire->Open=Cells & Open_Wire->Suspect;
+			Open_Wire->Suspect=Cells;
+			Open_Wire->Checks++;
+			Open_Wire->Last_Duration=Now-Open_Wire->Start_Tick;
+			Open_Wire->Last_Check_Tick=Now;
+			Open_Wire->Step=OPEN_WIRE_IDLE;
+		}
+		break;
+
+		default:
+		break;
+	}
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Open_Wire.c
+  * @brief          : Open wire detection
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file           : Open_Wire.h
+  * @brief          : Open wire detection header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef OPEN_WIRE_H
+#define OPEN_WIRE_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "LTC6811.h"
+#include "Balancing.h"
+#include "Scan_Scheduler.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Limits      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// Check period kept in NVM in seconds, erased takes the default and 0 disables
+#define OPEN_WIRE_DEFAULT_PERIOD_S		10
+#define OPEN_WIRE_MAX_PERIOD_S				3600
+
+// ADOW conversions with each current before reading, two in the normal mode
+#define OPEN_WIRE_CONVERSIONS					2
+
+// The sequence only starts with this time left before the next local scan
+#define OPEN_WIRE_WINDOW_MS						40
+
+// C0 open reads 0 on cell 1 with pull-up, C12 open reads 0 on cell 12 with
+// pull-down, Cn open drops cell n+1 by more than the limit from pull-up to pull-down
+#define OPEN_WIRE_ZERO								0.0001f	//V
+#define OPEN_WIRE_DELTA_LIMIT					-0.400f	//V
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Open_Wire_Init(Control_Unit_TypeDef* Control_Unit, uint32_t Period_Word);
+void Open_Wire_Task(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Open_Wire.h
+  * @brief          : Open wire detection header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,163 @@
+/**
+  ******************************************************************************
+  * @file           : Power_Governor.c
+  * @brief          : Clock profile governor
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Power_Governor.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Power Governor Init      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+void Power_Governor_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	memset(&Control_Unit->Power_Governor, 0, sizeof(Power_Governor_TypeDef));
+	Control_Unit->Power_Governor.Profile=POWER_PROFILE_LOW_POWER;
+	Control_Unit->Power_Governor.Profile_Start_Tick=MCU_Get_Tick();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Update Counters      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Adds the time spent since the last update to the active profile.
+ */
+void Power_Governor_Update_Counters(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Now=MCU_Get_Tick();
+	uint32_t Elapsed=Now-Control_Unit->Power_Governor.Profile_Start_Tick;
+
+	if(Control_Unit->Power_Governor.Profile==POWER_PROFILE_HIGH_SPEED)
+	{
+		Control_Unit->Power_Governor.Time_High_Speed+=Elapsed;
+	}
+	else
+	{
+		Control_Unit->Power_Governor.Time_Low_Power+=Elapsed;
+	}
+	Control_Unit->Power_Governor.Profile_Start_Tick=Now;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Switch Profile      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Changes the clock profile and records the switch latency.
+ *
+ * Most of the switch is spent waiting for the PLL or the flash latency at the
+ * clock in force before the switch, so the cycles are converted with it.
+ */
+static void Power_Governor_Switch(Control_Unit_TypeDef* Control_Unit, Power_Profile_TypeDef Profile)
+{
+	Power_Governor_Update_Counters(Control_Unit);
+
+	uint32_t Clock_MHz=MCU_Get_Core_Clock_MHz();
+	uint32_t Start=MCU_Cycle_Counter_Get();
+
+	if(Profile==POWER_PROFILE_HIGH_SPEED)
+	{
+		MCU_Clock_High_Speed();
+	}
+	else
+	{
+		MCU_Clock_Low_Power();
+	}
+
+	uint32_t Latency=(MCU_Cycle_Counter_Get()-Start)/Clock_MHz;
+
+	Control_Unit->Power_Governor.Profile=Profile;
+	Control_Unit->Power_Governor.Switch_Count++;
+	Control_Unit->Power_Governor.Last_Switch_Latency=Latency;
+	if(Latency>Control_Unit->Power_Governor.Max_Switch_Latency)
+	{
+		Control_Unit->Power_Governor.Max_Switch_Latency=Latency;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Enter Burst      	  	   		 		 ***************
+********************************************************************************
+*******************************************************************************/
+void Power_Governor_Enter_Burst(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->Power_Governor.Burst_Depth==0)
+	{
+		Power_Governor_Switch(Control_Unit,POWER_PROFILE_HIGH_SPEED);
+	}
+	Control_Unit->Power_Governor.Burst_Depth++;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Exit Burst      	  	   		 		 ***************
+********************************************************************************
+*******************************************************************************/
+void Power_Governor_Exit_Burst(Control_Unit_TypeDef* Control_Unit)
+{
+	if(Control_Unit->Power_Governor.Burst_Depth==0)
+	{
+		return;
+	}
+
+	Control_Unit->Power_Governor.Burst_Depth--;
+	if(Control_Unit->Power_Governor.Burst_Depth==0)
+	{
+		Power_Governor_Switch(Control_Unit,POWER_PROFILE_LOW_POWER);
+	}
+}
+
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Power_Governor.c
+  * @brief          : Clock profile governor
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file           : Power_Governor.h
+  * @brief          : Clock profile governor header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef POWER_GOVERNOR_H
+#define POWER_GOVERNOR_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Init      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+void Power_Governor_Init(Control_Unit_TypeDef* Control_Unit);
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Burst      	  	  		 	   ***************
+********************************************************************************
+*******************************************************************************/
+// Every Enter must be paired with an Exit, bursts may be nested
+void Power_Governor_Enter_Burst(Control_Unit_TypeDef* Control_Unit);
+void Power_Governor_Exit_Burst(Control_Unit_TypeDef* Control_Unit);
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Counters      	  	  		 	   ***************
+********************************************************************************
+*******************************************************************************/
+void Power_Governor_Update_Counters(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Power_Governor.h
+  * @brief          : Clock profile governor header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,177 @@
+/**
+  ******************************************************************************
+  * @file           : Profiler.c
+  * @brief          : Execution time profiler
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Profiler.h"
+
+/*******************************************************************************
+********************************************************************************
+***************									Profiler Data      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+// Written from the interrupts, each entry is only recorded from one context
+static volatile Profiler_Record_TypeDef Profiler_Records[PROFILER_ENTRIES];
+static uint32_t Profiler_Last_Mark[PROFILER_ENTRIES];
+static BoolTypeDef Profiler_Marked[PROFILER_ENTRIES];
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Profiler Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Profiler_Init(void)
+{
+	for(uint8_t i=0; i<PROFILER_ENTRIES; i++)
+	{
+		Profiler_Reset((Profiler_Entry_TypeDef)i);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Record      	  	   		 		 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Adds one sample to the entry histogram.
+ *
+ * Bucket n counts the samples between 2^n and 2^(n+1)-1 cycles, so the index
+ * is the position of the highest set bit. Bucket counters saturate.
+ */
+void Profiler_Record(Profiler_Entry_TypeDef Entry, uint32_t Cycles)
+{
+	if(Entry>=PROFILER_ENTRIES)
+	{
+		return;
+	}
+
+	volatile Profiler_Record_TypeDef* Record=&Profiler_Records[Entry];
+	uint32_t Bucket=0;
+
+	if(Cycles!=0)
+	{
+		Bucket=31U-__CLZ(Cycles);
+		if(Bucket>=PROFILER_BUCKETS)
+		{
+			Bucket=PROFILER_BUCKETS-1;
+		}
+	}
+
+	if(Record->Histogram[Bucket]<0xFFFF)
+	{
+		Record->Histogram[Bucket]++;
+	}
+	if(Cycles>Record->Max)
+	{
+		Record->Max=Cycles;
+	}
+	Record->Last=Cycles;
+	Record->Count++;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Mark      	  	   		 		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Records the cycles elapsed since the previous mark of the entry,
+ * used to measure periods and their jitter.
+ */
+void Profiler_Mark(Profiler_Entry_TypeDef Entry)
+{
+	if(Entry>=PROFILER_ENTRIES)
+	{
+		return;
+	}
+
+	uint32_t Now=MCU_Cycle_Counter_Get();
+	if(Profiler_Marked[Entry]==TRUE)
+	{
+		Profiler_Record(Entry,Now-Profiler_Last_Mark[Entry]);
+	}
+	Profiler_Last_Mark[Entry]=Now;
+	Profiler_Marked[Entry]=TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Reset      	  	   		 		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+void Profiler_Reset(Profiler_Entry_TypeDef Entry)
+{
+	if(Entry>=PROFILER_ENTRIES)
+	{
+		return;
+	}
+
+	memset((void*)&Profiler_Records[Entry], 0, sizeof(Profiler_Record_TypeDef));
+	Profiler_Marked[Entry]=FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Get      	  	   		 		 	 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+const Profiler_Record_TypeDef* Profiler_Get(Profiler_Entry_TypeDef Entry)
+{
+	if(Entry>=PROFILER_ENTRIES)
+	{
+		return NULL;
+	}
+	return (const Profiler_Record_TypeDef*)&Profiler_Records[Entry];
+}
+
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Profiler.c
+  * @brief          : Execution time profiler
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
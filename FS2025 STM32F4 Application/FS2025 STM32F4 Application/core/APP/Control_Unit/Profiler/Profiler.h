@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file           : Profiler.h
+  * @brief          : Execution time profiler header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include <string.h>
+
+// Comment to remove the profiler from the build, the hooks compile to nothing
+#define PROFILER_ENABLED
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Hooks      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// Times are recorded in core cycles read from the DWT cycle counter
+#ifdef PROFILER_ENABLED
+	#define PROFILER_START(Entry)		uint32_t Profiler_Start_##Entry=MCU_Cycle_Counter_Get()
+	#define PROFILER_STOP(Entry)		Profiler_Record(Entry,MCU_Cycle_Counter_Get()-Profiler_Start_##Entry)
+	#define PROFILER_MARK(Entry)		Profiler_Mark(Entry)
+#else
+	#define PROFILER_START(Entry)
+	#define PROFILER_STOP(Entry)
+	#define PROFILER_MARK(Entry)
+#endif
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Profiler_Init(void);
+void Profiler_Record(Profiler_Entry_TypeDef Entry, uint32_t Cycles);
+void Profiler_Mark(Profiler_Entry_TypeDef Entry);
+void Profiler_Reset(Profiler_Entry_TypeDef Entry);
+const Profiler_Record_TypeDef* Profiler_Get(Profiler_Entry_TypeDef Entry);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Profiler.h
+  * @brief          : Execution time profiler header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,265 @@
+/**
+  ******************************************************************************
+  * @file           : Scan_Scheduler.c
+  * @brief          : Adaptive scan scheduler
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Scan_Scheduler.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Configure      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+static uint32_t Scan_Scheduler_Clamp(uint32_t Value, uint32_t Min, uint32_t Max)
+{
+	return (Value<Min) ? Min : ((Value>Max) ? Max : Value);
+}
+
+/**
+ * @brief Periods of the slow and fast bands from their NVM words, in ms. An
+ * erased word keeps the default, any other value is clamped to the bounds and
+ * the fast period is never longer than the slow one. The normal band stays at
+ * its default within them.
+ */
+void Scan_Scheduler_Configure(Control_Unit_TypeDef* Control_Unit, uint32_t Slow_Word, uint32_t Fast_Word)
+{
+	uint32_t* Period=Control_Unit->Scan_Scheduler.Period;
+
+	Period[SCAN_BAND_SLOW]=(Slow_Word==0xFFFFFFFFU) ? SCAN_PERIOD_SLOW_MS : Scan_Scheduler_Clamp(Slow_Word,SCAN_PERIOD_MIN_MS,SCAN_PERIOD_MAX_MS);
+	Period[SCAN_BAND_FAST]=(Fast_Word==0xFFFFFFFFU) ? SCAN_PERIOD_FAST_MS : Scan_Scheduler_Clamp(Fast_Word,SCAN_PERIOD_MIN_MS,SCAN_PERIOD_MAX_MS);
+	if(Period[SCAN_BAND_FAST]>Period[SCAN_BAND_SLOW])
+	{
+		Period[SCAN_BAND_FAST]=Period[SCAN_BAND_SLOW];
+	}
+	Period[SCAN_BAND_NORMAL]=Scan_Scheduler_Clamp(SCAN_PERIOD_NORMAL_MS,Period[SCAN_BAND_FAST],Period[SCAN_BAND_SLOW]);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Scheduler Init      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+// The periods are configured before, with the rest of the NVM words
+void Scan_Scheduler_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Period[SCAN_BANDS];
+
+	memcpy(Period, Control_Unit->Scan_Scheduler.Period, sizeof(Period));
+	memset(&Control_Unit->Scan_Scheduler, 0, sizeof(Scan_Scheduler_TypeDef));
+	memcpy(Control_Unit->Scan_Scheduler.Period, Period, sizeof(Period));
+	Control_Unit->Scan_Scheduler.Band=SCAN_BAND_NORMAL;
+	Control_Unit->Scan_Scheduler.Last_Sequence=Control_Unit->Snapshot.Sequence;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Period      	  	   				 ***************
+********************************************************************************
+*******************************************************************************/
+uint32_t Scan_Scheduler_Period(const Control_Unit_TypeDef* Control_Unit, Scan_Band_TypeDef Band)
+{
+	return Control_Unit->Scan_Scheduler.Period[(Band<SCAN_BANDS) ? Band : SCAN_BAND_NORMAL];
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Time To Scan      	  	   			 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Time left until the next local scan, 0 if it is due. Idle time work
+ * uses it to fit in the gap, an INIT_MEASURE can still arrive sooner.
+ */
+uint32_t Scan_Scheduler_Time_To_Scan(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Elapsed=MCU_Get_Tick()-Control_Unit->Scan_Scheduler.Last_Scan_Tick;
+	uint32_t Period=Scan_Scheduler_Period(Control_Unit,Control_Unit->Scan_Scheduler.Band);
+
+	return (Elapsed<Period) ? Period-Elapsed : 0;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Update      	  	   				 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Counts the scan in the band it ran at, refits the temperature trends,
+ * queues the scan reports and picks the band of the next scan from the hottest enabled sensor and the
+ * fastest rising one.
+ */
+static void Scan_Scheduler_Update(Control_Unit_TypeDef* Control_Unit)
+{
+	Scan_Scheduler_TypeDef* Scheduler=&Control_Unit->Scan_Scheduler;
+	Measurement_Snapshot_TypeDef Snapshot;
+
+	Snapshot_Read(Control_Unit,&Snapshot);
+	Thermal_Trend_Update(Control_Unit,&Snapshot);
+	Scheduler->Reports_Pending=(Control_Unit->State!=INIT) ? SCAN_REPORTS : 0;
+
+	float Max_Temperature=-1000.0f;
+	float Max_Rate=0.0f;
+
+	if(Control_Unit->Thermal_Trend.Worst_Slope_Channel!=THERMAL_TREND_NO_CHANNEL)
+	{
+		Max_Rate=Control_Unit->Thermal_Trend.Slope[Control_Unit->Thermal_Trend.Worst_Slope_Channel];
+	}
+
+	uint32_t Skipped=Control_Unit->Status.Temperatures.Disabled | Control_Unit->Status.Temperatures.Failed;
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		if((Skipped>>i) & 1UL)
+		{
+			continue;
+		}
+		if(Snapshot.Temperatures[i]>Max_Temperature)
+		{
+			Max_Temperature=Snapshot.Temperatures[i];
+		}
+	}
+
+	Scheduler->Scans[Scheduler->Band]++;
+	Scheduler->Max_Temperature=Max_Temperature;
+	Scheduler->Max_Rate=Max_Rate;
+
+	if(Max_Temperature>=SCAN_FAST_TEMPERATURE || Max_Rate>=SCAN_FAST_RATE)
+	{
+		Scheduler->Band=SCAN_BAND_FAST;
+	}
+	else if(Max_Temperature<SCAN_SLOW_TEMPERATURE && Max_Rate<SCAN_SLOW_RATE)
+	{
+		Scheduler->Band=SCAN_BAND_SLOW;
+	}
+	else
+	{
+		Scheduler->Band=SCAN_BAND_NORMAL;
+	}
+
+	Scheduler->Last_Scan_Tick=Snapshot.Scan_Tick;
+	Scheduler->Last_Sequence=Snapshot.Scan_Count;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Report      	  	   				 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Sends the next pending report of the last scan, at most one frame per
+ * call.
+ */
+static void Scan_Scheduler_Report(Control_Unit_TypeDef* Control_Unit)
+{
+	Scan_Scheduler_TypeDef* Scheduler=&Control_Unit->Scan_Scheduler;
+
+	if(Scheduler->Reports_Pending & SCAN_REPORT_TREND)
+	{
+		Scheduler->Reports_Pending&=~SCAN_REPORT_TREND;
+		Thermal_Trend_Send(Control_Unit);
+	}
+	else if(Scheduler->Reports_Pending & SCAN_REPORT_VOLTAGE)
+	{
+		Scheduler->Reports_Pending&=~SCAN_REPORT_VOLTAGE;
+		Cell_Stats_Send(Control_Unit,CELL_STATS_VOLTAGE);
+	}
+	else if(Scheduler->Reports_Pending & SCAN_REPORT_TEMPERATURE)
+	{
+		Scheduler->Reports_Pending&=~SCAN_REPORT_TEMPERATURE;
+		Cell_Stats_Send(Control_Unit,CELL_STATS_TEMPERATURE);
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Scheduler Task      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Follows every published scan, local or requested by INIT_MEASURE,
+ * and requests a local one when the period of the band runs out without any.
+ * The request is taken under a critical section, so an INIT_MEASURE arriving
+ * at the same time is seen either as the scan owner or as a remote request.
+ */
+void Scan_Scheduler_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	Scan_Scheduler_TypeDef* Scheduler=&Control_Unit->Scan_Scheduler;
+
+	// Reports of a new scan start on the next pass, away from its finish frame
+	Scan_Scheduler_Report(Control_Unit);
+	if(Control_Unit->Snapshot.Sequence!=Scheduler->Last_Sequence)
+	{
+		Scan_Scheduler_Update(Control_Unit);
+	}
+
+	if(Control_Unit->State==INIT || Control_Unit->State==LTC6811_FAIL_MODE)
+	{
+		return;
+	}
+	if(MCU_Get_Tick()-Scheduler->Last_Scan_Tick<Scan_Scheduler_Period(Control_Unit,Scheduler->Band))
+
+	{
+		return;
+	}
+
+	uint32_t State=MCU_Critical_Enter();
+	if(Control_Unit->Status.Read_Temperatures==IDLE)
+	{
+		Scheduler->Local_Scan=TRUE;
+		Scheduler->Remote_Request=FALSE;
+		Scheduler->Local_Scans++;
+		Control_Unit->Status.Read_Temperatures=READ_RECEIVED;
+	}
+	MCU_Critical_Exit(State);
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Scan_Scheduler.c
+  * @brief          : Adaptive scan scheduler
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file           : Scan_Scheduler.h
+  * @brief          : Adaptive scan scheduler header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef SCAN_SCHEDULER_H
+#define SCAN_SCHEDULER_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "Snapshot.h"
+#include "Thermal_Trend.h"
+#include "Cell_Stats.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Bands      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// Local scan period of each band, slow is the minimum rate and fast the
+// maximum. Slow and fast are read from NVM, these are the erased values
+#define SCAN_PERIOD_SLOW_MS					1000
+#define SCAN_PERIOD_NORMAL_MS				500
+#define SCAN_PERIOD_FAST_MS					100
+
+// Periods from NVM are clamped to these, a scan of both phases takes about 35 ms
+#define SCAN_PERIOD_MIN_MS					50
+#define SCAN_PERIOD_MAX_MS					10000
+
+// Fast band: any enabled sensor at or over the temperature, or rising at or over the rate
+#define SCAN_FAST_TEMPERATURE				55.0f		//degC, 5 degC under the hot limit
+#define SCAN_FAST_RATE							0.5f		//degC/s
+
+// Slow band: every enabled sensor under the temperature and rising slower than the rate
+#define SCAN_SLOW_TEMPERATURE				40.0f		//degC
+#define SCAN_SLOW_RATE							0.05f		//degC/s
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Reports      	  	  		 	 ***************
+********************************************************************************
+*******************************************************************************/
+// Frames sent after every scan, one per main loop pass so they never meet the
+// finish and status frames in the transmit mailboxes
+#define SCAN_REPORT_TREND						0x01
+#define SCAN_REPORT_VOLTAGE					0x02
+#define SCAN_REPORT_TEMPERATURE			0x04
+#define SCAN_REPORTS								(SCAN_REPORT_TREND | SCAN_REPORT_VOLTAGE | SCAN_REPORT_TEMPERATURE)
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Scan_Scheduler_Configure(Control_Unit_TypeDef* Control_Unit, uint32_t Slow_Word, uint32_t Fast_Word);
+void Scan_Scheduler_Init(Control_Unit_TypeDef* Control_Unit);
+void Scan_Scheduler_Task(Control_Unit_TypeDef* Control_Unit);
+uint32_t Scan_Scheduler_Period(const Control_Unit_TypeDef* Control_Unit, Scan_Band_TypeDef Band);
+
+uint32_t Scan_Scheduler_Time_To_Scan(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Scan_Scheduler.h
+  * @brief          : Adaptive scan scheduler header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
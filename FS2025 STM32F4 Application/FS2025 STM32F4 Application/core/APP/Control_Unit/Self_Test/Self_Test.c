@@ -0,0 +1,387 @@
+/**
+  ******************************************************************************
+  * @file           : Self_Test.c
+  * @brief          : LTC6811 self-test and status diagnostics
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Self_Test.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Self Test Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Self_Test_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	memset(&Control_Unit->Self_Test, 0, sizeof(Self_Test_TypeDef));
+	Control_Unit->Self_Test.Step=SELF_TEST_IDLE;
+	Control_Unit->Self_Test.Run=SELF_TEST_RUN_CVST;
+	Control_Unit->Self_Test.Pattern=1;
+	Control_Unit->Self_Test.Last_Run_Tick=MCU_Get_Tick();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Commands      	  	   				 	 ***************
+********************************************************************************
+*******************************************************************************/
+static uint16_t Self_Test_Command(const Self_Test_TypeDef* Self_Test)
+{
+	switch(Self_Test->Run)
+	{
+		case SELF_TEST_RUN_CVST:
+			return LTC6811_CVST(LTC6811_ADC_MODE,Self_Test->Pattern);
+
+		case SELF_TEST_RUN_AXST:
+			return LTC6811_AXST(LTC6811_ADC_MODE,Self_Test->Pattern);
+
+		case SELF_TEST_RUN_ADSTAT:
+			return LTC6811_ADSTAT(LTC6811_ADC_MODE,0);
+
+		default:
+			return LTC6811_CMD_DIAGN;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Read Back      	  	   				 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Registers of the groups not holding the expected pattern, a group
+ * failing its PEC counts as not matching.
+ */
+static int16_t Self_Test_Mismatches(LTC6811_Typdef* LTC6811, const uint16_t* Groups, uint8_t Count, uint16_t Expected)
+{
+	int16_t Mismatches=0;
+	uint16_t Registers[3];
+
+	for(uint8_t i=0; i<Count; i++)
+	{
+		if(LTC6811_Read_Cell_Block(LTC6811,Groups[i],Registers)==FALSE)
+		{
+			Mismatches+=3;
+			continue;
+		}
+		for(uint8_t j=0; j<3; j++)
+		{
+			Mismatches+=(Registers[j]!=Expected) ? 1 : 0;
+		}
+	}
+	return Mismatches;
+}
+
+static void Self_Test_Set(Self_Test_TypeDef* Self_Test, uint8_t Chip, Self_Test_Item_TypeDef Item, int16_t Value, BoolTypeDef Failing)
+{
+	Self_Test->Value[Item][Chip]=Value;
+	if(Failing==TRUE)
+	{
+		Self_Test->Failing[Chip]|=1U<<Item;
+	}
+	else
+	{
+		Self_Test->Failing[Chip]&=~(1U<<Item);
+	}
+}
+
+static int16_t Self_Test_Scale(float Value, float LSB)
+{
+	float Steps=Value/LSB;
+	return (Steps>32767.0f) ? 32767 : (Steps<-32768.0f) ? -32768 : (int16_t)Steps;
+}
+
+/**
+ * @brief Reads the results of the run on one chip. Returns the checked items.
+ */
+static uint8_t Self_Test_Read(Control_Unit_TypeDef* Control_Unit, LTC6811_Typdef* LTC6811, uint8_t Chip)
+{
+	static const uint16_t Cell_Groups[]={LTC6811_CMD_RDCVA,LTC6811_CMD_RDCVB,LTC6811_CMD_RDCVC,LTC6811_CMD_RDCVD};
+	static const uint16_t Aux_Groups[]={LTC6811_CMD_RDAUXA,LTC6811_CMD_RDAUXB};
+	Self_Test_TypeDef* Self_Test=&Control_Unit->Self_Test;
+	uint16_t Expected=(Self_Test->Pattern==1) ? LTC6811_SELF_TEST_1 : LTC6811_SELF_TEST_2;
+	uint16_t Status_A[3];
+	uint16_t Status_B[3];
+	int16_t Mismatches;
+
+	switch(Self_Test->Run)
+	{
+		case SELF_TEST_RUN_CVST:
+			Mismatches=Self_Test_Mismatches(LTC6811,Cell_Groups,4,Expected);
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_CVST,Mismatches,(Mismatches!=0) ? TRUE : FALSE);
+			return 1U<<SELF_TEST_CVST;
+
+		case SELF_TEST_RUN_AXST:
+			Mismatches=Self_Test_Mismatches(LTC6811,Aux_Groups,2,Expected);
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_AXST,Mismatches,(Mismatches!=0) ? TRUE : FALSE);
+			return 1U<<SELF_TEST_AXST;
+
+		case SELF_TEST_RUN_ADSTAT:
+		{
+			if(LTC6811_Read_Cell_Block(LTC6811,LTC6811_CMD_RDSTATA,Status_A)==FALSE ||
+				 LTC6811_Read_Cell_Block(LTC6811,LTC6811_CMD_RDSTATB,Status_B)==FALSE)
+			{
+				// Unreadable status counts against every supply and temperature item
+				memset(Status_A,0,sizeof(Status_A));
+				memset(Status_B,0xFF,sizeof(Status_B));
+			}
+			float Sum_Of_Cells=Status_A[0]*LTC6811_SC_LSB;
+			float Die_Temperature=LTC6811_ITMP_TO_C(Status_A[1]);
+			float Analog_Supply=Status_A[2]*LTC6811_ADC_LSB;
+			float Digital_Supply=Status_B[0]*LTC6811_ADC_LSB;
+			uint8_t Flags=(uint8_t)(Status_B[2]>>8);
+
+			Self_Test->Sum_Of_Cells[Chip]=Sum_Of_Cells;
+			Self_Test->Revision[Chip]=LTC6811_STBR5_REV(Flags);
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_SUM_OF_CELLS,Self_Test_Scale(Sum_Of_Cells,0.01f),FALSE);
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_DIE_TEMPERATURE,Self_Test_Scale(Die_Temperature,0.1f),
+				(Die_Temperature>=SELF_TEST_DIE_LIMIT) ? TRUE : FALSE);
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_ANALOG_SUPPLY,Self_Test_Scale(Analog_Supply,0.001f),
+				(Analog_Supply<SELF_TEST_VA_MIN || Analog_Supply>SELF_TEST_VA_MAX) ? TRUE : FALSE);
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_DIGITAL_SUPPLY,Self_Test_Scale(Digital_Supply,0.001f),
+				(Digital_Supply<SELF_TEST_VD_MIN || Digital_Supply>SELF_TEST_VD_MAX) ? TRUE : FALSE);
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_THERMAL_SHUTDOWN,(Flags & LTC6811_STBR5_THSD) ? 1 : 0,
+				(Flags & LTC6811_STBR5_THSD) ? TRUE : FALSE);
+			return (1U<<SELF_TEST_SUM_OF_CELLS) | (1U<<SELF_TEST_DIE_TEMPERATURE) | (1U<<SELF_TEST_ANALOG_SUPPLY) |
+				(1U<<SELF_TEST_DIGITAL_SUPPLY) | (1U<<SELF_TEST_THERMAL_SHUTDOWN);
+		}
+
+		default:
+		{
+			BoolTypeDef Readed=LTC6811_Read_Cell_Block(LTC6811,LTC6811_CMD_RDSTATB,Status_B) ? TRUE : FALSE;
+			BoolTypeDef Mux_Fail=(Readed==FALSE || ((Status_B[2]>>8) & LTC6811_STBR5_MUXFAIL)) ? TRUE : FALSE;
+			Self_Test_Set(Self_Test,Chip,SELF_TEST_MUX,(Mux_Fail==TRUE) ? 1 : 0,Mux_Fail);
+			return 1U<<SELF_TEST_MUX;
+		}
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Report      	  	   				 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+static void Self_Test_Send(Control_Unit_TypeDef* Control_Unit, Self_Test_Item_TypeDef Item)
+{
+	Self_Test_TypeDef* Self_Test=&Control_Unit->Self_Test;
+
+	Control_Unit->Tx_Message.ID=BPCU_SELF_TEST_DEF;
+	Control_Unit->Tx_Message.DLC=8;
+	Control_Unit->Tx_Message.Data[0]=Item;
+	Control_Unit->Tx_Message.Data[1]=((Self_Test->Failing[0]>>Item) & 1U) | (((Self_Test->Failing[1]>>Item) & 1U)<<1);
+	for(uint8_t Chip=0; Chip<2; Chip++)
+	{
+		Control_Unit->Tx_Message.Data[2+2*Chip]=(uint8_t)Self_Test->Value[Item][Chip];
+		Control_Unit->Tx_Message.Data[3+2*Chip]=(uint8_t)((uint16_t)Self_Test->Value[Item][Chip]>>8);
+	}
+	Control_Unit->Tx_Message.Data[6]=Self_Test->Faults[0] | Self_Test->Faults[1];
+	Control_Unit->Tx_Message.Data[7]=(uint8_t)((Self_Test->Revision[0]<<4) | (Self_Test->Revision[1] & 0x0F));
+	CAN1_Send(&Control_Unit->Tx_Message);
+}
+
+/**
+ * @brief Sends the lowest pending item of the last run, one frame per call.
+ */
+static void Self_Test_Report(Control_Unit_TypeDef* Control_Unit)
+{
+	Self_Test_TypeDef* Self_Test=&Control_Unit->Self_Test;
+
+	for(uint8_t Item=0; Item<SELF_TEST_ITEMS; Item++)
+	{
+		if(Self_Test->Reports_Pending & (1U<<Item))
+		{
+			Self_Test->Reports_Pending&=~(1U<<Item);
+			Self_Test_Send(Control_Unit,(Self_Test_Item_TypeDef)Item);
+			return;
+		}
+	}
+}
+
+/**
+ * @brief An item failing two checks in a row is a fault. Faults other than
+ * the sum of cells mark the chip as failed, so the next scan enters the
+ * LTC6811 fail mode and the recovery sequencer takes over.
+ */
+static void Self_Test_Faults(Control_Unit_TypeDef* Control_Unit, uint8_t Chip, uint8_t Checked, uint8_t Previous)
+{
+	Self_Test_TypeDef* Self_Test=&Control_Unit->Self_Test;
+	LTC6811_Typdef* LTC6811=(Chip==0) ? &Control_Unit->Status.LTC6811_1 : &Control_Unit->Status.LTC6811_2;
+	uint8_t Faults=Self_Test->Failing[Chip] & Previous & Checked;
+
+	Self_Test->Faults[Chip]=(Self_Test->Faults[Chip] & ~Checked) | Faults;
+	if(Faults & SELF_TEST_HARD_ITEMS)
+	{
+		LTC6811->Fail=TRUE;
+		Self_Test->Fault_Count++;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Self Test Task      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Runs one self-test every SELF_TEST_INTERVAL_MS in the gaps between
+ * scans, one step per call, so the checks are spread over many scan cycles.
+ * A scan starting meanwhile cuts the run, which is repeated in the next gap.
+ * The digital filter tests swap their pattern every round. The results of a
+ * run are sent one item per call.
+ */
+void Self_Test_Task(Control_Unit_TypeDef* Control_Unit)
+{
+	Self_Test_TypeDef* Self_Test=&Control_Unit->Self_Test;
+	LTC6811_Typdef* LTC6811_1=&Control_Unit->Status.LTC6811_1;
+	LTC6811_Typdef* LTC6811_2=&Control_Unit->Status.LTC6811_2;
+	uint32_t Now=MCU_Get_Tick();
+
+	Self_Test_Report(Control_Unit);
+
+	if(Control_Unit->Status.Read_Temperatures!=IDLE)
+	{
+		if(Self_Test->Step!=SELF_TEST_IDLE)
+		{
+			Self_Test->Aborts++;
+			Self_Test->Step=SELF_TEST_IDLE;
+		}
+		return;
+	}
+
+	switch(Self_Test->Step)
+	{
+		case SELF_TEST_IDLE:
+			if(Control_Unit->State==INIT || Control_Unit->State==LTC6811_FAIL_MODE ||
+				 Control_Unit->Open_Wire.Step!=OPEN_WIRE_IDLE ||
+				 Now-Self_Test->Last_Run_Tick<SELF_TEST_INTERVAL_MS ||
+				 Scan_Scheduler_Time_To_Scan(Control_Unit)<SELF_TEST_WINDOW_MS)
+			{
+				break;
+			}
+			Self_Test->Step=SELF_TEST_WAKE;
+		break;
+
+		case SELF_TEST_WAKE:
+			LTC6811_Wake_Up_Pulse(LTC6811_1);
+			LTC6811_Wake_Up_Pulse(LTC6811_2);
+			Self_Test->Step_Tick=Now;
+			Self_Test->Step=SELF_TEST_START;
+		break;
+
+		case SELF_TEST_START:
+			if(Now-Self_Test->Step_Tick<LTC6811_WAKE_TIME_MS)
+			{
+				break;
+			}
+			LTC6811_Send_Command(LTC6811_1,Self_Test_Command(Self_Test));
+			LTC6811_Send_Command(LTC6811_2,Self_Test_Command(Self_Test));
+			Self_Test->Done_1=FALSE;
+			Self_Test->Done_2=FALSE;
+			Self_Test->Step_Tick=Now;
+			Self_Test->Step=SELF_TEST_WAIT;
+		break;
+
+		case SELF_TEST_WAIT:
+			if(Now-Self_Test->Step_Tick<LTC6811_ADCV_TIME_MS)
+			{
+				break;
+			}
+			if(Self_Test->Done_1==FALSE)
+			{
+				Self_Test->Done_1=LTC6811_ADC_Done(LTC6811_1);
+			}
+			if(Self_Test->Done_2==FALSE)
+			{
+				Self_Test->Done_2=LTC6811_ADC_Done(LTC6811_2);
+			}
+			if(Self_Test->Done_1==TRUE && Self_Test->Done_2==TRUE)
+			{
+				Self_Test->Step=SELF_TEST_READ;
+			}
+			else if(Now-Self_Test->Step_Tick>=SELF_TEST_TIMEOUT_MS)
+			{
+				Self_Test->Timeouts++;
+				Self_Test->Last_Run_Tick=Now;
+				Self_Test->Step=SELF_TEST_IDLE;
+			}
+		break;
+
+		case SELF_TEST_READ:
+		{
+			uint8_t Previous[2]={Self_Test->Failing[0],Self_Test->Failing[1]};
+			uint8_t Checked=Self_Test_Read(Control_Unit,LTC6811_1,0);
+			Self_Test_Read(Control_Unit,LTC6811_2,1);
+
+			if(Self_Test->Run==SELF_TEST_RUN_ADSTAT)
+			{
+				Self_Test->Sum_Of_Cells_Tick=Now;
+			}
+			Self_Test_Faults(Control_Unit,0,Checked,Previous[0]);
+			Self_Test_Faults(Control_Unit,1,Checked,Previous[1]);
+			if(Control_Unit->State!=INIT)
+			{
+				Self_Test->Reports_Pending=Checked;
+			}
+
+			Self_Test->Runs++;
+			Self_Test->Run=(Self_Test_Run_TypeDef)((Self_Test->Run+1)%SELF_TEST_RUNS);
+			if(Self_Test->Run==SELF_TEST_RUN_CVST)
+			{
+				Self_Test->Pattern=(Self_Test->Pattern==1) ? 2 : 1;
+			}
+			Self_Test->Last_Run_Tick=Now;
+			Self_Test->Step=SELF_TEST_IDLE;
+		}
+		break;
+
+		default:
+		break;
+	}
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Self_Test.c
+  * @brief          : LTC6811 self-test and status diagnostics
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
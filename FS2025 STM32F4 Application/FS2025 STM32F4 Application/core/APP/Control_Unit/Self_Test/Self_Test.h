@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file           : Self_Test.h
+  * @brief          : LTC6811 self-test and status diagnostics header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef SELF_TEST_H
+#define SELF_TEST_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "Can_Bus.h"
+#include "LTC6811.h"
+#include "Scan_Scheduler.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Limits      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// One run every interval, the four runs take SELF_TEST_RUNS intervals
+#define SELF_TEST_INTERVAL_MS					2000
+// A run only starts with this time left before the next local scan
+#define SELF_TEST_WINDOW_MS						20
+// DIAGN and the status conversion are not longer than a cell conversion
+#define SELF_TEST_TIMEOUT_MS					(LTC6811_ADC_TIMEOUT_MS+2)
+
+#define SELF_TEST_DIE_LIMIT						85.0f		//degC
+#define SELF_TEST_VA_MIN							4.5f		//V
+#define SELF_TEST_VA_MAX							5.5f		//V
+#define SELF_TEST_VD_MIN							2.7f		//V
+#define SELF_TEST_VD_MAX							3.6f		//V
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Frame      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// One frame per checked item (BPCU_SELF_TEST_DEF): 0 Item, 1 Failing chips
+// (bit 0 first chip), 2..3 and 4..5 Value of each chip (signed, little endian),
+// 6 Items with a fault on either chip, 7 Revision of each chip (first in the high nibble)
+#define SELF_TEST_HARD_ITEMS					((uint8_t)~(1U<<SELF_TEST_SUM_OF_CELLS))
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Self_Test_Init(Control_Unit_TypeDef* Control_Unit);
+void Self_Test_Task(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Self_Test.h
+  * @brief          : LTC6811 self-test and status diagnostics header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,117 @@
+/**
+  ******************************************************************************
+  * @file           : Snapshot.c
+  * @brief          : Measurement snapshot
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Snapshot.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Snapshot Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Snapshot_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	memset(&Control_Unit->Snapshot, 0, sizeof(Snapshot_TypeDef));
+	Snapshot_Publish(Control_Unit);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Snapshot Publish      	  	   	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Copies the current scan into the unpublished buffer and then
+ * publishes it by advancing the sequence.
+ */
+void Snapshot_Publish(Control_Unit_TypeDef* Control_Unit)
+{
+	uint32_t Sequence=Control_Unit->Snapshot.Sequence+1;
+	Measurement_Snapshot_TypeDef* Next=&Control_Unit->Snapshot.Buffer[Sequence & 1U];
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Next->Temperatures[i]=Control_Unit->Status.Temperatures.Actual_Value[i];
+		Next->Voltages[i]=Control_Unit->Status.Voltages[i];
+	}
+	Next->Voltages_Stale=Control_Unit->Status.Voltages_Stale;
+	Next->Temperatures_Hot=Control_Unit->Status.Temperatures_Hot;
+	Next->Temperatures_Failed=Control_Unit->Status.Temperatures_Failed;
+	Next->Scan_Tick=MCU_Get_Tick();
+	Next->Scan_Count=Sequence;
+
+	MCU_Memory_Barrier();
+	Control_Unit->Snapshot.Sequence=Sequence;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Snapshot Read      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Copies the published buffer. If a publish happened during the copy
+ * the buffer may have been reused, so the copy is repeated. The writer never
+ * waits on readers, so a reader interrupting it always finishes.
+ */
+void Snapshot_Read(Control_Unit_TypeDef* Control_Unit, Measurement_Snapshot_TypeDef* Snapshot)
+{
+	uint32_t Sequence;
+
+	do
+	{
+		Sequence=Control_Unit->Snapshot.Sequence;
+		MCU_Memory_Barrier();
+		memcpy(Snapshot, &Control_Unit->Snapshot.Buffer[Sequence & 1U], sizeof(Measurement_Snapshot_TypeDef));
+		MCU_Memory_Barrier();
+	} while(Sequence!=Control_Unit->Snapshot.Sequence);
+}
+
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Snapshot.c
+  * @brief          : Measurement snapshot
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
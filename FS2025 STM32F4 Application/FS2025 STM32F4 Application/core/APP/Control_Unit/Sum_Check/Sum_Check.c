@@ -0,0 +1,236 @@
+/**
+  ******************************************************************************
+  * @file           : Sum_Check.c
+  * @brief          : Sum of cells cross-check and re-measure vote
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Sum_Check.h"
+#include <math.h>
+
+/*******************************************************************************
+********************************************************************************
+***************								Sum Check Init      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+void Sum_Check_Init(Control_Unit_TypeDef* Control_Unit, uint32_t Tolerance_Word)
+{
+	memset(&Control_Unit->Sum_Check, 0, sizeof(Sum_Check_TypeDef));
+
+	uint32_t Tolerance_mV=(Tolerance_Word<=SUM_CHECK_MAX_TOLERANCE_MV) ? Tolerance_Word : SUM_CHECK_DEFAULT_TOLERANCE_MV;
+	Control_Unit->Sum_Check.Tolerance=Tolerance_mV*0.001f;
+}
+
+BoolTypeDef Sum_Check_Enabled(const Control_Unit_TypeDef* Control_Unit)
+{
+	return (Control_Unit->Sum_Check.Tolerance>0.0f) ? TRUE : FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Helpers      	  	   				 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+// The twelve inputs are differences of consecutive pins, their sum is C12-C0
+// whatever each input is wired to, so it matches SC on both phases
+static float Sum_Check_Sum(const float* Voltages)
+{
+	float Sum=0.0f;
+
+	for(uint8_t i=0; i<12; i++)
+	{
+		Sum+=Voltages[i];
+	}
+	return Sum;
+}
+
+static float Sum_Check_Median(float a, float b, float c)
+{
+	if(a>b)
+	{
+		float t=a; a=b; b=t;
+	}
+	if(b>c)
+	{
+		b=c;
+	}
+	return (a>b) ? a : b;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Vote      	  	   				 	 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Median of the three readings of each input of one chip, written
+ * back to Voltages. The median wins when another reading agrees with it, so
+ * a single bad reading is outvoted. The voted inputs must still add up to the
+ * median SC.
+ */
+static BoolTypeDef Sum_Check_Vote(Sum_Check_TypeDef* Sum_Check, uint8_t Chip, float* Voltages)
+{
+	const float (*Readings)[12]=Sum_Check->Readings[Chip];
+	BoolTypeDef Majority=TRUE;
+
+	for(uint8_t i=0; i<12; i++)
+	{
+		float Median=Sum_Check_Median(Readings[0][i],Readings[1][i],Readings[2][i]);
+		uint8_t Agree=0;
+
+		for(uint8_t Vote=0; Vote<SUM_CHECK_VOTES; Vote++)
+		{
+			Agree+=(fabsf(Readings[Vote][i]-Median)<=SUM_CHECK_CELL_TOLERANCE) ? 1 : 0;
+		}
+		if(Agree<2)
+		{
+			Majority=FALSE;
+		}
+		if(fabsf(Readings[0][i]-Median)>SUM_CHECK_CELL_TOLERANCE)
+		{
+			Sum_Check->Disagreements++;
+		}
+		Voltages[i]=Median;
+	}
+
+	float Sum_Of_Cells=Sum_Check_Median(Sum_Check->Sum_Of_Cells[Chip][0],Sum_Check->Sum_Of_Cells[Chip][1],Sum_Check->Sum_Of_Cells[Chip][2]);
+	Sum_Check->Error[Chip]=Sum_Check_Sum(Voltages)-Sum_Of_Cells;
+	return (Majority==TRUE && fabsf(Sum_Check->Error[Chip])<=Sum_Check->Tolerance) ? TRUE : FALSE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Sum Check Phase      	  	   		 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Called with the raw readings of a phase and their SC in the
+ * acquisition buffers, converted with ADCVSC. It makes no transfer, the
+ * acquisition reads SC after the cell groups. When the readings of both
+ * chips add up to their SC the phase is stored as it is, the nominal path
+ * stays at one conversion.
+
+ * Otherwise the phase is converted until SUM_CHECK_VOTES readings are taken
+ * and the vote settles each input. A phase without majority is not stored,
+ * SUM_CHECK_DISCARD_LIMIT of them in a row fail the chip.
+ */
+Sum_Check_Result_TypeDef Sum_Check_Phase(Control_Unit_TypeDef* Control_Unit)
+{
+	Sum_Check_TypeDef* Sum_Check=&Control_Unit->Sum_Check;
+	LTC6811_Typdef* LTC6811[2]={&Control_Unit->Status.LTC6811_1,&Control_Unit->Status.LTC6811_2};
+	float* Voltages[2]={Control_Unit->Acquisition.Voltages_1,Control_Unit->Acquisition.Voltages_2};
+	const float* Phase_Sum_Of_Cells=Control_Unit->Acquisition.Sum_Of_Cells;
+	Sum_Check_Result_TypeDef Result=SUM_CHECK_STORE;
+	BoolTypeDef Match=TRUE;
+
+	if(Sum_Check_Enabled(Control_Unit)==FALSE)
+	{
+		return SUM_CHECK_STORE;
+	}
+
+	for(uint8_t Chip=0; Chip<2; Chip++)
+	{
+		memcpy(Sum_Check->Readings[Chip][Sum_Check->Vote],Voltages[Chip],12*sizeof(float));
+		Sum_Check->Sum_Of_Cells[Chip][Sum_Check->Vote]=Phase_Sum_Of_Cells[Chip];
+	}
+
+	Sum_Check->Vote++;
+
+	if(Sum_Check->Vote==1)
+	{
+		Sum_Check->Checks++;
+		for(uint8_t Chip=0; Chip<2; Chip++)
+		{
+			Sum_Check->Error[Chip]=Sum_Check_Sum(Voltages[Chip])-Sum_Check->Sum_Of_Cells[Chip][0];
+			if(fabsf(Sum_Check->Error[Chip])>Sum_Check->Tolerance)
+			{
+				Match=FALSE;
+			}
+		}
+		if(Match==TRUE)
+		{
+			Sum_Check->Vote=0;
+			Sum_Check->Discarded[0]=0;
+			Sum_Check->Discarded[1]=0;
+			return SUM_CHECK_STORE;
+		}
+		Sum_Check->Mismatches++;
+	}
+	if(Sum_Check->Vote<SUM_CHECK_VOTES)
+	{
+		return SUM_CHECK_REMEASURE;
+	}
+
+	Sum_Check->Vote=0;
+	for(uint8_t Chip=0; Chip<2; Chip++)
+	{
+		if(Sum_Check_Vote(Sum_Check,Chip,Voltages[Chip])==TRUE)
+		{
+			Sum_Check->Discarded[Chip]=0;
+			continue;
+		}
+		Result=SUM_CHECK_DISCARD;
+		if(++Sum_Check->Discarded[Chip]>=SUM_CHECK_DISCARD_LIMIT)
+		{
+			Sum_Check->Discarded[Chip]=0;
+			LTC6811[Chip]->Fail=TRUE;
+			Sum_Check->Faults++;
+		}
+	}
+
+	if(Result==SUM_CHECK_STORE)
+	{
+		Sum_Check->Voted++;
+	}
+	else
+	{
+		Sum_Check->Discards++;
+	}
+	return Result;
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Sum_Check.c
+  * @brief          : Sum of cells cross-check and re-measure vote
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file           : Sum_Check.h
+  * @brief          : Sum of cells cross-check and re-measure vote header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef SUM_CHECK_H
+#define SUM_CHECK_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "LTC6811.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Limits      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+// Tolerance kept in flash in mV, 0 disables the check and the scans use ADCV
+#define SUM_CHECK_DEFAULT_TOLERANCE_MV		100
+#define SUM_CHECK_MAX_TOLERANCE_MV				5000		//Above it (erased flash) the default is used
+
+#define SUM_CHECK_CELL_TOLERANCE				0.005f	//V, two readings of an input agree
+#define SUM_CHECK_DISCARD_LIMIT					3				//Phases in a row without majority before failing the chip
+#define SUM_CHECK_NO_SC									-1000.0f	//V, unreadable SC, never matches
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Sum_Check_Init(Control_Unit_TypeDef* Control_Unit, uint32_t Tolerance_Word);
+BoolTypeDef Sum_Check_Enabled(const Control_Unit_TypeDef* Control_Unit);
+Sum_Check_Result_TypeDef Sum_Check_Phase(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Sum_Check.h
+  * @brief          : Sum of cells cross-check and re-measure vote header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
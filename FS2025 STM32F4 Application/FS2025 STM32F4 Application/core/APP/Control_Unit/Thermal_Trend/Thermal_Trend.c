@@ -0,0 +1,254 @@
+/**
+  ******************************************************************************
+  * @file           : Thermal_Trend.c
+  * @brief          : Temperature trend estimator
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#include "Thermal_Trend.h"
+
+/*******************************************************************************
+********************************************************************************
+***************								Thermal Trend Init      	  	   ***************
+********************************************************************************
+*******************************************************************************/
+void Thermal_Trend_Init(Control_Unit_TypeDef* Control_Unit)
+{
+	memset(&Control_Unit->Thermal_Trend, 0, sizeof(Thermal_Trend_TypeDef));
+	Control_Unit->Thermal_Trend.Worst_Time_Channel=THERMAL_TREND_NO_CHANNEL;
+	Control_Unit->Thermal_Trend.Worst_Slope_Channel=THERMAL_TREND_NO_CHANNEL;
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Control_Unit->Thermal_Trend.Time_To_Limit[i]=0xFFFF;
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Resync Sums      	  	   				 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Rebuilds the sums from the window, so the rounding left by the
+ * running updates does not build up. Runs once every window, when the ring
+ * wraps.
+ */
+static void Thermal_Trend_Resync(Thermal_Trend_TypeDef* Trend, uint32_t Now)
+{
+	Trend->Sum_t=0.0f;
+	Trend->Sum_tt=0.0f;
+	memset(Trend->Sum_T, 0, sizeof(Trend->Sum_T));
+	memset(Trend->Sum_tT, 0, sizeof(Trend->Sum_tT));
+
+	for(uint8_t k=0; k<Trend->Count; k++)
+	{
+		float t=-(float)(Now-Trend->Ticks[k])*0.001f;
+		Trend->Sum_t+=t;
+		Trend->Sum_tt+=t*t;
+		for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+		{
+			Trend->Sum_T[i]+=Trend->Temperatures[k][i];
+			Trend->Sum_tT[i]+=t*Trend->Temperatures[k][i];
+		}
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Trend Update      	  	   				 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Adds a scan to the window and refits every channel.
+ *
+ * The time origin is kept on the newest scan: moving it, dropping the oldest
+ * scan and adding the new one only touch the running sums, so the cost does
+ * not depend on the window length.
+ */
+void Thermal_Trend_Update(Control_Unit_TypeDef* Control_Unit, const Measurement_Snapshot_TypeDef* Snapshot)
+{
+	Thermal_Trend_TypeDef* Trend=&Control_Unit->Thermal_Trend;
+	float Count;
+
+	// Move the origin to the new scan
+	if(Trend->Count>0)
+	{
+		float Shift=(float)(Snapshot->Scan_Tick-Trend->Last_Tick)*0.001f;
+		Count=(float)Trend->Count;
+
+		Trend->Sum_tt+=Count*Shift*Shift-2.0f*Shift*Trend->Sum_t;
+		Trend->Sum_t-=Count*Shift;
+		for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+		{
+			Trend->Sum_tT[i]-=Shift*Trend->Sum_T[i];
+		}
+	}
+
+	// Drop the oldest scan, it is in the slot about to be written
+	if(Trend->Count==THERMAL_TREND_WINDOW)
+	{
+		float t=-(float)(Snapshot->Scan_Tick-Trend->Ticks[Trend->Head])*0.001f;
+
+		Trend->Sum_t-=t;
+		Trend->Sum_tt-=t*t;
+		for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+		{
+			Trend->Sum_T[i]-=Trend->Temperatures[Trend->Head][i];
+			Trend->Sum_tT[i]-=t*Trend->Temperatures[Trend->Head][i];
+		}
+		Trend->Count--;
+	}
+
+	// Add the new scan at t=0
+	memcpy(Trend->Temperatures[Trend->Head], Snapshot->Temperatures, sizeof(Trend->Temperatures[0]));
+	Trend->Ticks[Trend->Head]=Snapshot->Scan_Tick;
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		Trend->Sum_T[i]+=Snapshot->Temperatures[i];
+	}
+	Trend->Count++;
+	Trend->Last_Tick=Snapshot->Scan_Tick;
+	Trend->Head++;
+	if(Trend->Head>=THERMAL_TREND_WINDOW)
+	{
+		Trend->Head=0;
+		Thermal_Trend_Resync(Trend,Snapshot->Scan_Tick);
+	}
+
+	// Fit and project to the limit
+	Count=(float)Trend->Count;
+	float Denominator=Count*Trend->Sum_tt-Trend->Sum_t*Trend->Sum_t;
+	BoolTypeDef Valid=(Trend->Count>=THERMAL_TREND_MIN_SAMPLES && Denominator>1e-6f) ? TRUE : FALSE;
+	uint32_t Skipped=Control_Unit->Status.Temperatures.Disabled | Control_Unit->Status.Temperatures.Failed;
+	uint16_t Worst_Time=0xFFFF;
+	float Worst_Slope=0.0f;
+
+	Trend->Worst_Time_Channel=THERMAL_TREND_NO_CHANNEL;
+	Trend->Worst_Slope_Channel=THERMAL_TREND_NO_CHANNEL;
+	Trend->Channels_Warning=0;
+
+	for(uint8_t i=0; i<BPCU_CHANNELS; i++)
+	{
+		float Temperature=Snapshot->Temperatures[i];
+		float Slope=(Valid==TRUE) ? (Count*Trend->Sum_tT[i]-Trend->Sum_t*Trend->Sum_T[i])/Denominator : 0.0f;
+		uint16_t Time_To_Limit=0xFFFF;
+
+		if(Temperature>=THERMAL_TREND_LIMIT)
+		{
+			Time_To_Limit=0;
+		}
+		else if(Slope>THERMAL_TREND_MIN_SLOPE)
+		{
+			float Seconds=(THERMAL_TREND_LIMIT-Temperature)/Slope;
+			Time_To_Limit=(Seconds<65535.0f) ? (uint16_t)Seconds : 0xFFFF;
+		}
+
+		Trend->Slope[i]=Slope;
+		Trend->Time_To_Limit[i]=Time_To_Limit;
+
+		if((Skipped>>i) & 1UL)
+		{
+			continue;
+		}
+		if(Time_To_Limit<THERMAL_TREND_WARNING_S)
+		{
+			Trend->Channels_Warning++;
+		}
+		if(Time_To_Limit<Worst_Time || Trend->Worst_Time_Channel==THERMAL_TREND_NO_CHANNEL)
+		{
+			Worst_Time=Time_To_Limit;
+			Trend->Worst_Time_Channel=i;
+		}
+		if(Slope>Worst_Slope || Trend->Worst_Slope_Channel==THERMAL_TREND_NO_CHANNEL)
+		{
+			Worst_Slope=Slope;
+			Trend->Worst_Slope_Channel=i;
+		}
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Trend Message      	  	   			 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Worst channels frame: 0 Channel closest to the limit, 1..2 Its time
+ * to limit (s), 3 Fastest rising channel, 4..5 Its slope (0.01 degC/s, signed),
+ * 6 Channels under THERMAL_TREND_WARNING_S, 7 Scans in the window.
+ * Channels are 0xFF when every sensor is disabled or failed.
+ */
+void Thermal_Trend_Send(Control_Unit_TypeDef* Control_Unit)
+{
+	Thermal_Trend_TypeDef* Trend=&Control_Unit->Thermal_Trend;
+	uint16_t Time_To_Limit=0xFFFF;
+	int16_t Slope=0;
+
+	if(Trend->Worst_Time_Channel!=THERMAL_TREND_NO_CHANNEL)
+	{
+		Time_To_Limit=Trend->Time_To_Limit[Trend->Worst_Time_Channel];
+	}
+	if(Trend->Worst_Slope_Channel!=THERMAL_TREND_NO_CHANNEL)
+	{
+		float Scaled=Trend->Slope[Trend->Worst_Slope_Channel]*100.0f;
+		Slope=(Scaled>32767.0f) ? 32767 : (Scaled<-32768.0f) ? -32768 : (int16_t)Scaled;
+	}
+
+	Control_Unit->Tx_Message.ID=BPCU_THERMAL_TREND_DEF;
+	Control_Unit->Tx_Message.DLC=8;
+	Control_Unit->Tx_Message.Data[0]=Trend->Worst_Time_Channel;
+	Control_Unit->Tx_Message.Data[1]=(uint8_t)Time_To_Limit;
+	Control_Unit->Tx_Message.Data[2]=(uint8_t)(Time_To_Limit>>8);
+	Control_Unit->Tx_Message.Data[3]=Trend->Worst_Slope_Channel;
+	Control_Unit->Tx_Message.Data[4]=(uint8_t)Slope;
+	Control_Unit->Tx_Message.Data[5]=(uint8_t)((uint16_t)Slope>>8);
+	Control_Unit->Tx_Message.Data[6]=Trend->Channels_Warning;
+	Control_Unit->Tx_Message.Data[7]=Trend->Count;
+	CAN1_Send(&Control_Unit->Tx_Message);
+}
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Thermal_Trend.c
+  * @brief          : Temperature trend estimator
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file           : Thermal_Trend.h
+  * @brief          : Temperature trend estimator header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+#ifndef THERMAL_TREND_H
+#define THERMAL_TREND_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************
+********************************************************************************
+*******************************************************************************/
+#include "MCU.h"
+#include "Typedefs.h"
+#include "Can_Bus.h"
+#include <string.h>
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Limits      	  	  		 		   ***************
+********************************************************************************
+*******************************************************************************/
+#define THERMAL_TREND_LIMIT						60.0f		//degC, same as the hot fail mode
+#define THERMAL_TREND_MIN_SAMPLES			3				//Scans before a slope is reported
+#define THERMAL_TREND_MIN_SLOPE				0.001f	//degC/s, slower is reported as never
+#define THERMAL_TREND_WARNING_S				60			//s
+
+
+/*******************************************************************************
+********************************************************************************
+***************											 Functions      	  	  		 ***************
+********************************************************************************
+*******************************************************************************/
+void Thermal_Trend_Init(Control_Unit_TypeDef* Control_Unit);
+void Thermal_Trend_Update(Control_Unit_TypeDef* Control_Unit, const Measurement_Snapshot_TypeDef* Snapshot);
+void Thermal_Trend_Send(Control_Unit_TypeDef* Control_Unit);
+
+
+#endif
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Thermal_Trend.h
+  * @brief          : Temperature trend estimator header file
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
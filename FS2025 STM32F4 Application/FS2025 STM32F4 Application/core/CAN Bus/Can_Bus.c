@@ -29,24 +29,191 @@
 #include "Can_Bus.h"
 
 
+/*******************************************************************************
+********************************************************************************
+***************						  			 	CAN 1 RX QUEUE					  	 ***************
+********************************************************************************
+*******************************************************************************/
+static CAN_Rx_Queue_TypeDef CAN1_Rx_Queue;
+static CAN_Tx_Queue_TypeDef CAN1_Tx_Queue;
+static CAN_Bus_Statistics_TypeDef CAN1_Statistics;
+
+
+/*******************************************************************************
+********************************************************************************
+***************						  			 	CAN 1 BIT TIME					  	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Worst case length of a standard data frame: 47 fixed bits plus the
+ * data, and one stuff bit every 4 bits of the 34+8*DLC stuffed bits.
+ */
+uint32_t CAN1_Frame_Bits(uint8_t DLC)
+{
+	if(DLC>8)
+	{
+		DLC=8;
+	}
+	uint32_t Stuffed=34U+8U*DLC;
+	return 47U+8U*DLC+(Stuffed-1U)/4U;
+}
+
 
 /*******************************************************************************
 ********************************************************************************
 ***************						  			 	CAN 1					  		    		 ***************
 ********************************************************************************
 *******************************************************************************/
+/**
+ * @brief Queues the frame and sends as many queued frames as there are free
+ * mailboxes. A full queue drops the frame and counts it, the bus is never a
+ * reason to stop the unit. Main loop only.
+ */
 void CAN1_Send(CAN_Tx_Message_TypeDef* CAN_Message)
 {
-	CAN_TxHeaderTypeDef   TxHeader;	
-	TxHeader.IDE = CAN_ID_STD;
-	TxHeader.StdId = CAN_Message->ID;
-	TxHeader.RTR = CAN_RTR_DATA;
-	TxHeader.DLC = CAN_Message->DLC;
-	MCU_CAN1_Send(&TxHeader, CAN_Message->Data, &CAN_Message->Mailbox);
+	uint8_t Head=CAN1_Tx_Queue.Head;
+	uint8_t Next=(Head+1) & (CAN_TX_QUEUE_SIZE-1);
+
+	if(Next==CAN1_Tx_Queue.Tail)
+	{
+		CAN1_Statistics.Tx_Dropped++;
+	}
+	else
+	{
+		CAN1_Tx_Queue.Messages[Head]=*CAN_Message;
+		CAN1_Tx_Queue.Head=Next;
+
+		uint8_t Waiting=(Next-CAN1_Tx_Queue.Tail) & (CAN_TX_QUEUE_SIZE-1);
+		if(Waiting>CAN1_Statistics.Tx_Queue_Peak)
+		{
+			CAN1_Statistics.Tx_Queue_Peak=Waiting;
+		}
+	}
+	CAN1_Tx_Task();
+}
+
+/**
+ * @brief Moves queued frames to the mailboxes until they are full, in the
+ * order they were sent. Called by every send and once per main loop pass.
+ */
+void CAN1_Tx_Task(void)
+{
+	while(CAN1_Tx_Queue.Tail!=CAN1_Tx_Queue.Head)
+	{
+		CAN_Tx_Message_TypeDef* Message=&CAN1_Tx_Queue.Messages[CAN1_Tx_Queue.Tail];
+		CAN_TxHeaderTypeDef   TxHeader;
+		TxHeader.IDE = CAN_ID_STD;
+		TxHeader.StdId = Message->ID;
+		TxHeader.RTR = CAN_RTR_DATA;
+		TxHeader.DLC = Message->DLC;
+		TxHeader.TransmitGlobalTime = DISABLE;
+		if(MCU_CAN1_Send(&TxHeader, Message->Data, &Message->Mailbox)==FALSE)
+		{
+			return;
+		}
+
+		CAN1_Statistics.Tx_Frames++;
+		CAN1_Statistics.Tx_Bits+=CAN1_Frame_Bits(Message->DLC);
+		CAPTURE(CAPTURE_CAN_TX, MCU_Get_Tick(), Message->ID, Message->DLC, Message->Data, Message->DLC);
+		CAN1_Tx_Queue.Tail=(CAN1_Tx_Queue.Tail+1) & (CAN_TX_QUEUE_SIZE-1);
+	}
 }
 
+/**
+ * @brief Runs in the CAN interrupt: moves the frame out of the FIFO with its
+ * time stamp and pends the deferred work. When the queue is full the frame is
+ * still read, so the FIFO is released, and counted as an overflow only. The
+ * frame and bit counts cover the frames queued.
+ */
+void CAN1_Interrupt_Capture(void)
+{
+	uint8_t Head=CAN1_Rx_Queue.Head;
+	uint8_t Next=(Head+1) & (CAN_RX_QUEUE_SIZE-1);
+
+	if(Next==CAN1_Rx_Queue.Tail)
+	{
+		CAN_Rx_Message_TypeDef Discarded;
+		MCU_CAN1_Read(&Discarded.Header, Discarded.Data);
+		CAN1_Rx_Queue.Overflows++;
+	}
+	else if(MCU_CAN1_Read(&CAN1_Rx_Queue.Messages[Head].Header, CAN1_Rx_Queue.Messages[Head].Data)==TRUE)
+	{
+		CAN1_Rx_Queue.Messages[Head].Timestamp=MCU_Get_Tick();
+		CAN1_Statistics.Rx_Frames++;
+		CAN1_Statistics.Rx_Bits+=CAN1_Frame_Bits(CAN1_Rx_Queue.Messages[Head].Header.DLC);
+		CAN1_Rx_Queue.Head=Next;
+	}
+	else
+	{
+		CAN1_Statistics.Rx_Read_Errors++;
+	}
+	MCU_Deferred_Trigger();
+}
+
+/**
+ * @brief Runs in the deferred work handler: dispatches every queued frame
+ * through the control unit Rx message.
+ */
 void CAN1_Interrupt_DoTask(void)
 {
-	Control_Unit_CAN1_Interrupt();
+	while(CAN1_Rx_Queue.Tail!=CAN1_Rx_Queue.Head)
+	{
+		uint8_t Tail=CAN1_Rx_Queue.Tail;
+		CONTROL_UNIT.Rx_Message=CAN1_Rx_Queue.Messages[Tail];
+		CAN1_Rx_Queue.Tail=(Tail+1) & (CAN_RX_QUEUE_SIZE-1);
+
+		// Only standard data frames are dispatched, StdId is not valid for the others
+		if(CONTROL_UNIT.Rx_Message.Header.IDE!=CAN_ID_STD || CONTROL_UNIT.Rx_Message.Header.RTR!=CAN_RTR_DATA || CONTROL_UNIT.Rx_Message.Header.DLC>8)
+		{
+			CAN1_Statistics.Rx_Rejected++;
+			continue;
+		}
+		CAPTURE(CAPTURE_CAN_RX, CONTROL_UNIT.Rx_Message.Timestamp, CONTROL_UNIT.Rx_Message.Header.StdId, CONTROL_UNIT.Rx_Message.Header.DLC, CONTROL_UNIT.Rx_Message.Data, CONTROL_UNIT.Rx_Message.Header.DLC);
+		Control_Unit_CAN1_Interrupt();
+	}
+}
+
+uint32_t CAN1_Rx_Overflows(void)
+{
+	return CAN1_Rx_Queue.Overflows;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************						  			 	CAN 1 BUS LOAD					  	 ***************
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Closes a CAN_BUS_LOAD_WINDOW_MS window: load is the share of the bit
+ * time used by the frames this node sent and received in it. Main loop only.
+ */
+void CAN1_Bus_Load_Task(void)
+{
+	uint32_t Now=MCU_Get_Tick();
+	uint32_t Elapsed=Now-CAN1_Statistics.Window_Start_Tick;
+
+	if(Elapsed<CAN_BUS_LOAD_WINDOW_MS)
+	{
+		return;
+	}
+
+	uint32_t Bits=CAN1_Statistics.Tx_Bits+CAN1_Statistics.Rx_Bits;
+	uint32_t Window_Bits=Bits-CAN1_Statistics.Window_Start_Bits;
+	uint32_t Available_Bits=(MCU_CAN1_Get_Bitrate()/1000U)*Elapsed;
+	uint32_t Load=(uint32_t)(((uint64_t)Window_Bits*1000U)/Available_Bits);
+
+	CAN1_Statistics.Load=(Load>1000U) ? 1000U : (uint16_t)Load;
+	if(CAN1_Statistics.Load>CAN1_Statistics.Peak_Load)
+	{
+		CAN1_Statistics.Peak_Load=CAN1_Statistics.Load;
+	}
+	CAN1_Statistics.Window_Start_Tick=Now;
+	CAN1_Statistics.Window_Start_Bits=Bits;
+}
+
+const CAN_Bus_Statistics_TypeDef* CAN1_Get_Statistics(void)
+{
+	return &CAN1_Statistics;
 }
 
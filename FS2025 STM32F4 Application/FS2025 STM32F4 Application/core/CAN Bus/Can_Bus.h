@@ -33,6 +33,7 @@
 #include "Control_Unit_Selection.h"
 #include "TypeDefs.h"
 #include "Control_Unit.h"
+#include "Capture.h"
 
 /*******************************************************************************
 ********************************************************************************
@@ -54,6 +55,16 @@
 	#define BPCU_CANCEL_SENSOR_2_DEF 		0x411	//Active/Cancel sensor
 	#define BPCU_CANCEL_SENSOR_3_DEF 		0x412	//Active/Cancel sensor
 	#define BPCU_REBOOT_DEF							0x506 //Reboot
+	#define BPCU_DIAG_REQUEST_DEF			0x610	//Diagnostic request
+	#define BPCU_DIAG_RESPONSE_DEF		0x611	//Diagnostic response
+	#define BPCU_STARTUP_DIAG_DEF			0x612	//Startup diagnostics
+	#define BPCU_THERMAL_TREND_DEF		0x613	//Worst temperature trends
+	#define BPCU_CELL_STATS_DEF			0x614	//Scan statistics summary
+	#define BPCU_BALANCING_DEF			0x615	//Balancing status
+	#define BPCU_CALIBRATION_DEF			0x616	//Calibration write
+	#define BPCU_SELF_TEST_DEF			0x617	//LTC6811 self-test results
+	#define BPCU_BALANCING_COMMAND_DEF	0x618	//Balancing enable and limits
+	#define BPCU_NVM_WINDOW_DEF			0x619	//Flash write window, the master stays off the unit
 #endif
 
 #ifdef BATTERY_PACK_CONTROL_UNIT_2
@@ -71,6 +82,16 @@
 	#define BPCU_CANCEL_SENSOR_2_DEF 		0x421	//Active/Cancel sensor
 	#define BPCU_CANCEL_SENSOR_3_DEF 		0x422	//Active/Cancel sensor
 	#define BPCU_REBOOT_DEF							0x507 //Reboot
+	#define BPCU_DIAG_REQUEST_DEF			0x620	//Diagnostic request
+	#define BPCU_DIAG_RESPONSE_DEF		0x621	//Diagnostic response
+	#define BPCU_STARTUP_DIAG_DEF			0x622	//Startup diagnostics
+	#define BPCU_THERMAL_TREND_DEF		0x623	//Worst temperature trends
+	#define BPCU_CELL_STATS_DEF			0x624	//Scan statistics summary
+	#define BPCU_BALANCING_DEF			0x625	//Balancing status
+	#define BPCU_CALIBRATION_DEF			0x626	//Calibration write
+	#define BPCU_SELF_TEST_DEF			0x627	//LTC6811 self-test results
+	#define BPCU_BALANCING_COMMAND_DEF	0x628	//Balancing enable and limits
+	#define BPCU_NVM_WINDOW_DEF			0x629	//Flash write window, the master stays off the unit
 #endif
 
 #ifdef BATTERY_PACK_CONTROL_UNIT_3
@@ -88,6 +109,16 @@
 	#define BPCU_CANCEL_SENSOR_2_DEF 		0x431	//Active/Cancel sensor
 	#define BPCU_CANCEL_SENSOR_3_DEF 		0x432	//Active/Cancel sensor
 	#define BPCU_REBOOT_DEF							0x508 //Reboot
+	#define BPCU_DIAG_REQUEST_DEF			0x630	//Diagnostic request
+	#define BPCU_DIAG_RESPONSE_DEF		0x631	//Diagnostic response
+	#define BPCU_STARTUP_DIAG_DEF			0x632	//Startup diagnostics
+	#define BPCU_THERMAL_TREND_DEF		0x633	//Worst temperature trends
+	#define BPCU_CELL_STATS_DEF			0x634	//Scan statistics summary
+	#define BPCU_BALANCING_DEF			0x635	//Balancing status
+	#define BPCU_CALIBRATION_DEF			0x636	//Calibration write
+	#define BPCU_SELF_TEST_DEF			0x637	//LTC6811 self-test results
+	#define BPCU_BALANCING_COMMAND_DEF	0x638	//Balancing enable and limits
+	#define BPCU_NVM_WINDOW_DEF			0x639	//Flash write window, the master stays off the unit
 #endif
 
 #ifdef BATTERY_PACK_CONTROL_UNIT_4
@@ -105,6 +136,16 @@
 	#define BPCU_CANCEL_SENSOR_2_DEF 		0x441	//Active/Cancel sensor
 	#define BPCU_CANCEL_SENSOR_3_DEF 		0x442	//Active/Cancel sensor
 	#define BPCU_REBOOT_DEF							0x509 //Reboot
+	#define BPCU_DIAG_REQUEST_DEF			0x640	//Diagnostic request
+	#define BPCU_DIAG_RESPONSE_DEF		0x641	//Diagnostic response
+	#define BPCU_STARTUP_DIAG_DEF			0x642	//Startup diagnostics
+	#define BPCU_THERMAL_TREND_DEF		0x643	//Worst temperature trends
+	#define BPCU_CELL_STATS_DEF			0x644	//Scan statistics summary
+	#define BPCU_BALANCING_DEF			0x645	//Balancing status
+	#define BPCU_CALIBRATION_DEF			0x646	//Calibration write
+	#define BPCU_SELF_TEST_DEF			0x647	//LTC6811 self-test results
+	#define BPCU_BALANCING_COMMAND_DEF	0x648	//Balancing enable and limits
+	#define BPCU_NVM_WINDOW_DEF			0x649	//Flash write window, the master stays off the unit
 #endif
 
 
@@ -116,7 +157,13 @@
 ********************************************************************************
 *******************************************************************************/
 void CAN1_Send(CAN_Tx_Message_TypeDef* CAN_Message);
+void CAN1_Tx_Task(void);
+void CAN1_Interrupt_Capture(void);
 void CAN1_Interrupt_DoTask(void);
+uint32_t CAN1_Rx_Overflows(void);
+uint32_t CAN1_Frame_Bits(uint8_t DLC);
+void CAN1_Bus_Load_Task(void);
+const CAN_Bus_Statistics_TypeDef* CAN1_Get_Statistics(void);
 
 
 
@@ -65,6 +65,21 @@ unsigned char Round_High (float value)
 }
 
 
+/*******************************************************************************
+********************************************************************************
+***************										Count set bits			    			 ***************
+********************************************************************************
+*******************************************************************************/
+// Cortex-M4 has no population count instruction, bits are added in parallel
+unsigned char Popcount (unsigned int value)
+{
+	value=value-((value>>1) & 0x55555555U);
+	value=(value & 0x33333333U)+((value>>2) & 0x33333333U);
+	value=(value+(value>>4)) & 0x0F0F0F0FU;
+	return (unsigned char)((value*0x01010101U)>>24);
+}
+
+
 /***************************************************************************************************************************************************************
 ****************************************************************************************************************************************************************
 ****************************************************************************************************************************************************************
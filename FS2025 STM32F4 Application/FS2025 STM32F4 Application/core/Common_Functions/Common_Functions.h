@@ -109,6 +109,8 @@ void Timer_10ms_Init(Timer_10ms_TypeDef* Timer, unsigned short int period, Timer
 #define BITSCLEAR(x,y) 		(((x) & (y)) == 0)
 #define BITVAL(x,y) 		(((x)>>(y)) & 1)
 
+unsigned char		Popcount			(unsigned int value);
+
 
 /*******************************************************************************
 ********************************************************************************
@@ -0,0 +1,954 @@
+/**
+  ******************************************************************************
+  * @file           : Host.c
+  * @brief          : Host (PC) MCU backend: simulated GPIO, SPI, CAN, flash and time base
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+// Only the host build compiles this backend
+#ifdef HOST_MCU
+
+#include "Host.h"
+#include "Control_Unit.h"
+#include "Can_Bus.h"
+#include "Profiler.h"
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************										 Platform State                ***************	
+********************************************************************************
+*******************************************************************************/
+typedef struct
+{
+	BoolTypeDef							Used;
+	uint32_t								Order;
+	Host_CAN_Frame_TypeDef	Frame;
+} Host_CAN_Mailbox_TypeDef;
+
+// Received frame with the format bits of the RIR register
+typedef struct
+{
+	Host_CAN_Frame_TypeDef	Frame;
+	uint32_t								IDE;
+	uint32_t								RTR;
+} Host_CAN_FIFO_Slot_TypeDef;
+
+static Host_Statistics_TypeDef	Host_Statistics;
+static BoolTypeDef							Host_Stopped;
+
+// Virtual time base: us since reset, the ms tick and the DWT cycles
+static uint64_t		Host_Time_us;
+static uint32_t		Host_Tick;
+static uint32_t		Host_Cycles;
+static uint32_t		Host_HCLK_MHz=HOST_LOW_POWER_HCLK_MHZ;
+static uint32_t		Host_Main_Pass_us=HOST_MAIN_PASS_US;
+
+// Interrupts: PRIMASK, the level of the running handler and the pending requests
+static uint32_t		Host_PRIMASK;
+static uint32_t		Host_Running_Priority=HOST_THREAD_PRIORITY;
+static uint32_t		Host_TIM7_Pending;
+static BoolTypeDef	Host_PendSV_Pending;
+static BoolTypeDef	Host_TIM7_Enabled;
+
+// GPIO
+static BoolTypeDef	Host_C8;
+static BoolTypeDef	Host_C9;
+
+// SPI
+static Host_SPI_Device_TypeDef	Host_SPI_Devices[HOST_SPI_BUSES];
+static BoolTypeDef							Host_SPI_Selected[HOST_SPI_BUSES];
+
+// CAN 1
+static Host_CAN_Mailbox_TypeDef	Host_CAN1_Mailbox[HOST_CAN1_MAILBOXES];
+static uint32_t									Host_CAN1_Order;
+static BoolTypeDef							Host_CAN1_Held;
+static Host_CAN_FIFO_Slot_TypeDef	Host_CAN1_FIFO[HOST_CAN1_FIFO_SIZE];
+static uint8_t									Host_CAN1_FIFO_Head;
+static uint8_t									Host_CAN1_FIFO_Count;
+static Host_CAN_Frame_TypeDef		Host_CAN1_Log[HOST_CAN1_LOG_SIZE];
+static uint32_t									Host_CAN1_Log_Head;
+static uint32_t									Host_CAN1_Log_Count;
+
+// Flash, kept over Host_Reset like the real memory over a power cycle
+static uint8_t		Host_Flash[HOST_FLASH_SIZE];
+static uint8_t		Host_System_Memory[HOST_SYSTEM_MEMORY_SIZE];
+static BoolTypeDef	Host_Flash_Erased;
+static uint32_t		Host_Flash_Operations_Left=UINT32_MAX;
+
+static const uint32_t Host_Flash_Sector_Offset[HOST_FLASH_SECTORS+1]=
+{
+	0x00000U, 0x04000U, 0x08000U, 0x0C000U, 0x10000U, 0x20000U, 0x40000U, 0x60000U, 0x80000U
+};
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************           	 Interrupt Emulation 					     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Runs the pending handlers more urgent than the running level, the
+  * same order as the NVIC: CAN1 RX0, TIM7 and last PendSV. Handlers can pend
+  * others, those run before returning.
+  * @retval NOTHING
+  */
+static void Host_Run_Handler(uint32_t Priority, void (*Handler)(void))
+{
+	uint32_t Previous=Host_Running_Priority;
+
+	Host_Running_Priority=Priority;
+	Handler();
+	Host_Running_Priority=Previous;
+}
+
+static void Host_CAN1_RX0_IRQHandler(void)
+{
+	PROFILER_START(PROFILER_CAN1_RX0_IRQ);
+	CAN1_Interrupt_Capture();
+	PROFILER_STOP(PROFILER_CAN1_RX0_IRQ);
+}
+
+static void Host_TIM7_IRQHandler(void)
+{
+	PROFILER_START(PROFILER_TIM7_IRQ);
+	Control_Unit_Timer_10ms_Capture();
+	PROFILER_STOP(PROFILER_TIM7_IRQ);
+}
+
+static void Host_PendSV_Handler(void)
+{
+	PROFILER_START(PROFILER_PENDSV);
+	Control_Unit_Deferred_Task();
+	PROFILER_STOP(PROFILER_PENDSV);
+}
+
+static void Host_Interrupts_Service(void)
+{
+	while(Host_PRIMASK==0U && Host_Stopped==FALSE)
+	{
+		if(Host_CAN1_FIFO_Count>0U && Host_Running_Priority>HOST_CAN1_RX0_PRIORITY)
+		{
+			Host_Run_Handler(HOST_CAN1_RX0_PRIORITY,Host_CAN1_RX0_IRQHandler);
+		}
+		else if(Host_TIM7_Pending>0U && Host_Running_Priority>HOST_TIM7_PRIORITY)
+		{
+			Host_TIM7_Pending--;
+			Host_Run_Handler(HOST_TIM7_PRIORITY,Host_TIM7_IRQHandler);
+		}
+		else if(Host_PendSV_Pending==TRUE && Host_Running_Priority>HOST_PENDSV_PRIORITY)
+		{
+			Host_PendSV_Pending=FALSE;
+			Host_Run_Handler(HOST_PENDSV_PRIORITY,Host_PendSV_Handler);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************           	 Host ERROR HANDLERS 					     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  The STM32F4 handlers stop the core, here the simulation stops:
+  * Host_Run_ms returns and no more interrupts are served
+  * @retval NOTHING
+  */
+void Host_Init_Error(void)
+{
+	Host_Error_Handler();
+}
+
+void Host_Error_Handler(void)
+{
+	Host_Statistics.Errors++;
+	Host_Stopped=TRUE;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************		Host Initizalization Common interfaces		 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Starts the time base, the peripherals keep their simulation state
+  * @retval NOTHING
+  */
+void Host_Init(void)
+{
+	Host_HCLK_MHz=HOST_LOW_POWER_HCLK_MHZ;
+	Host_TIM7_Enabled=TRUE;
+	if(Host_Flash_Erased==FALSE)
+	{
+		Host_Flash_Erase_All();
+	}
+}
+
+void Host_SPI1_Init(void)
+{
+	Host_SPI_Selected[HOST_SPI_1]=FALSE;
+}
+
+void Host_SPI2_Init(void)
+{
+	Host_SPI_Selected[HOST_SPI_2]=FALSE;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************							Host SPI TRANSFERS						 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Full duplex byte exchanges with the attached device, the receive
+  * clocks out 0xFF. Without a device MISO reads 0xFF, as pulled up. Each
+  * byte takes its time on the bus, the interrupts due meanwhile are served.
+  * @retval TRUE, a transfer never times out here
+  */
+static void Host_SPI_Exchange(uint8_t SPI, const uint8_t* Tx, uint8_t* Rx, uint16_t Length)
+{
+	const Host_SPI_Device_TypeDef* Device=&Host_SPI_Devices[SPI];
+
+	for(uint16_t i=0; i<Length; i++)
+	{
+		uint8_t Out=(Tx!=NULL) ? Tx[i] : 0xFF;
+		uint8_t In=0xFF;
+
+		if(Device->Exchange!=NULL && Host_SPI_Selected[SPI]==TRUE)
+		{
+			In=Device->Exchange(Device->Context,Out);
+		}
+		if(Rx!=NULL)
+		{
+			Rx[i]=In;
+		}
+		Host_Step_us(HOST_SPI_BYTE_US);
+	}
+	Host_Statistics.SPI_Transfers[SPI]++;
+}
+
+BoolTypeDef Host_SPI_Transmit(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout)
+{
+	(void)Timeout;
+	if(SPI>=HOST_SPI_BUSES)
+	{
+		return FALSE;
+	}
+	Host_SPI_Exchange(SPI,Data,NULL,Length);
+	return TRUE;
+}
+
+BoolTypeDef Host_SPI_Receive(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout)
+{
+	(void)Timeout;
+	if(SPI>=HOST_SPI_BUSES)
+	{
+		return FALSE;
+	}
+	Host_SPI_Exchange(SPI,NULL,Data,Length);
+	return TRUE;
+}
+
+void Host_SPI_Chip_Select(uint8_t SPI, BoolTypeDef Selected)
+{
+	if(SPI>=HOST_SPI_BUSES || Host_SPI_Selected[SPI]==Selected)
+	{
+		return;
+	}
+	Host_SPI_Selected[SPI]=Selected;
+	if(Host_SPI_Devices[SPI].Select!=NULL)
+	{
+		Host_SPI_Devices[SPI].Select(Host_SPI_Devices[SPI].Context,Selected);
+	}
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************						Host Clock Profiles				 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Only the reported core clock changes
+  * @retval NOTHING
+  */
+void Host_Clock_Low_Power_Config(void)
+{
+	Host_HCLK_MHz=HOST_LOW_POWER_HCLK_MHZ;
+	Host_Statistics.Clock_Switches++;
+}
+
+void Host_Clock_High_Speed_Config(void)
+{
+	Host_HCLK_MHz=HOST_HIGH_SPEED_HCLK_MHZ;
+	Host_Statistics.Clock_Switches++;
+}
+
+uint32_t Host_Get_HCLK_MHz(void)
+{
+	return Host_HCLK_MHz;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			Host Time Base 				 			 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Everything derives from one virtual us clock that only moves when
+  * it is stepped: by the tests, by the delays and by the cost of each main
+  * pass. The DWT counter adds the cycles of every step at the HCLK of that
+  * moment, so it follows the clock switches like the real one. Each ms
+  * boundary moves the tick, fires TIM7 and lets the CAN mailboxes send.
+  * @retval NOTHING
+  */
+static void Host_CAN1_Transmit(uint32_t Frames);
+
+uint32_t Host_Cycle_Counter_Get(void)
+{
+	return Host_Cycles;
+}
+
+uint32_t Host_Get_Tick(void)
+{
+	return Host_Tick;
+}
+
+// Same rule as HAL_Delay: one more tick so the wait is never shorter
+void Host_Delay(uint32_t Delay_ms)
+{
+	uint32_t Start=Host_Tick;
+	uint32_t Wait=Delay_ms;
+	if(Wait<UINT32_MAX)
+	{
+		Wait++;
+	}
+	while(Host_Tick-Start<Wait && Host_Stopped==FALSE)
+	{
+		Host_Step_us(1000U-(uint32_t)(Host_Time_us%1000U));
+	}
+}
+
+void Host_Delay_us(uint32_t Delay_us)
+{
+	Host_Step_us(Delay_us);
+}
+
+void Host_Step_us(uint32_t Time_us)
+{
+	while(Time_us>0U && Host_Stopped==FALSE)
+	{
+		uint32_t Step=1000U-(uint32_t)(Host_Time_us%1000U);
+		if(Step>Time_us)
+		{
+			Step=Time_us;
+		}
+		Time_us-=Step;
+		Host_Time_us+=Step;
+		Host_Cycles+=Step*Host_HCLK_MHz;
+		if(Host_Time_us%1000U==0U)
+		{
+			Host_Tick++;
+			Host_CAN1_Transmit(HOST_CAN1_FRAMES_PER_MS);
+			if(Host_TIM7_Enabled==TRUE)
+			{
+				Host_TIM7_Pending++;
+			}
+			Host_Interrupts_Service();
+		}
+	}
+}
+
+void Host_Advance_ms(uint32_t Time_ms)
+{
+	for(uint32_t i=0; i<Time_ms && Host_Stopped==FALSE; i++)
+	{
+		Host_Step_us(1000U);
+	}
+}
+
+uint64_t Host_Get_Time_us(void)
+{
+	return Host_Time_us;
+}
+
+void Host_Set_Main_Pass_us(uint32_t Time_us)
+{
+	Host_Main_Pass_us=(Time_us>0U) ? Time_us : 1U;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			Host Deferred Work 			 			 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  PendSV, barrier and PRIMASK
+  * @retval NOTHING
+  */
+void Host_PendSV_Trigger(void)
+{
+	Host_PendSV_Pending=TRUE;
+	Host_Interrupts_Service();
+}
+
+void Host_Memory_Barrier(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+uint32_t Host_Critical_Enter(void)
+{
+	uint32_t State=Host_PRIMASK;
+	Host_PRIMASK=1U;
+	return State;
+}
+
+void Host_Critical_Exit(uint32_t State)
+{
+	Host_PRIMASK=State;
+	Host_Interrupts_Service();
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************          	 			Host GPIO OUTPUTS			  			 *****************	
+********************************************************************************
+*******************************************************************************/
+void Host_GPIO_Init_C8_Output(void)
+{
+	Host_C8=FALSE;
+}
+
+void Host_GPIO_Init_C9_Output(void)
+{
+	Host_C9=FALSE;
+}
+
+void Host_GPIO_Write_C8_Output(BoolTypeDef value)
+{
+	Host_C8=value;
+}
+
+void Host_GPIO_Write_C9_Output(BoolTypeDef value)
+{
+	Host_C9=value;
+}
+
+BoolTypeDef Host_GPIO_Read_C8(void)
+{
+	return Host_C8;
+}
+
+BoolTypeDef Host_GPIO_Read_C9(void)
+{
+	return Host_C9;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************							RESET WDT				 										 ***************
+********************************************************************************
+*******************************************************************************/
+void Host_WDT_Refresh(void)
+{
+	Host_Statistics.WDT_Refreshes++;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Host CAN 1	            		****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Three mailboxes sent lowest identifier first, like the bxCAN with
+  * TXFP=0, into a log the tests take the frames from. Held mailboxes model a
+  * bus without acknowledge, or a bus model that sends them one at a time with
+  * Host_CAN1_Pending and Host_CAN1_Transmitted.
+  * @retval NOTHING
+  */
+BoolTypeDef Host_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox)
+{
+	if(CAN_Header->DLC>8U)
+	{
+		return FALSE;
+	}
+	for(uint32_t i=0; i<HOST_CAN1_MAILBOXES; i++)
+	{
+		if(Host_CAN1_Mailbox[i].Used==FALSE)
+		{
+			Host_CAN1_Mailbox[i].Used=TRUE;
+			Host_CAN1_Mailbox[i].Order=Host_CAN1_Order++;
+			Host_CAN1_Mailbox[i].Frame.Id=CAN_Header->StdId;
+			Host_CAN1_Mailbox[i].Frame.DLC=(uint8_t)CAN_Header->DLC;
+			memset(Host_CAN1_Mailbox[i].Frame.Data,0,8);
+			memcpy(Host_CAN1_Mailbox[i].Frame.Data,Data,CAN_Header->DLC);
+			if(Mailbox!=NULL)
+			{
+				*Mailbox=1U<<i;
+			}
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+// Mailbox that goes first: lowest identifier, then the oldest, -1 if all free
+static int32_t Host_CAN1_First(void)
+{
+	int32_t Next=-1;
+
+	for(uint32_t i=0; i<HOST_CAN1_MAILBOXES; i++)
+	{
+		if(Host_CAN1_Mailbox[i].Used==TRUE && (Next<0 ||
+			 Host_CAN1_Mailbox[i].Frame.Id<Host_CAN1_Mailbox[Next].Frame.Id ||
+			 (Host_CAN1_Mailbox[i].Frame.Id==Host_CAN1_Mailbox[Next].Frame.Id && Host_CAN1_Mailbox[i].Order<Host_CAN1_Mailbox[Next].Order)))
+		{
+			Next=(int32_t)i;
+		}
+	}
+	return Next;
+}
+
+static void Host_CAN1_Complete(int32_t Next)
+{
+	// A full log loses its oldest frame
+	if(Host_CAN1_Log_Count==HOST_CAN1_LOG_SIZE)
+	{
+		Host_CAN1_Log_Head=(Host_CAN1_Log_Head+1U)%HOST_CAN1_LOG_SIZE;
+		Host_CAN1_Log_Count--;
+		Host_Statistics.CAN1_Tx_Log_Lost++;
+	}
+	Host_CAN1_Mailbox[Next].Frame.Tick=Host_Tick;
+	Host_CAN1_Log[(Host_CAN1_Log_Head+Host_CAN1_Log_Count)%HOST_CAN1_LOG_SIZE]=Host_CAN1_Mailbox[Next].Frame;
+	Host_CAN1_Log_Count++;
+	Host_CAN1_Mailbox[Next].Used=FALSE;
+	Host_Statistics.CAN1_Tx_Frames++;
+}
+
+static void Host_CAN1_Transmit(uint32_t Frames)
+{
+	while(Frames>0U && Host_CAN1_Held==FALSE)
+	{
+		int32_t Next=Host_CAN1_First();
+		if(Next<0)
+		{
+			return;
+		}
+		Host_CAN1_Complete(Next);
+		Frames--;
+	}
+}
+
+BoolTypeDef Host_CAN1_Read(CAN_RxHeaderTypeDef* CAN_Header, uint8_t* Data)
+{
+	if(Host_CAN1_FIFO_Count==0U)
+	{
+		return FALSE;
+	}
+	const Host_CAN_FIFO_Slot_TypeDef* Slot=&Host_CAN1_FIFO[Host_CAN1_FIFO_Head];
+	uint32_t StdId=CAN_Header->StdId;
+
+	// Like HAL_CAN_GetRxMessage, only the identifier of the frame format is
+	// written and StdId keeps what the caller had for an extended frame
+	memset(CAN_Header,0,sizeof(CAN_RxHeaderTypeDef));
+	if(Slot->IDE==CAN_ID_STD)
+	{
+		CAN_Header->StdId=Slot->Frame.Id;
+	}
+	else
+	{
+		CAN_Header->StdId=StdId;
+		CAN_Header->ExtId=Slot->Frame.Id;
+	}
+	CAN_Header->IDE=Slot->IDE;
+	CAN_Header->RTR=Slot->RTR;
+	CAN_Header->DLC=Slot->Frame.DLC;
+	memcpy(Data,Slot->Frame.Data,8);
+
+	Host_CAN1_FIFO_Head=(uint8_t)((Host_CAN1_FIFO_Head+1U)%HOST_CAN1_FIFO_SIZE);
+	Host_CAN1_FIFO_Count--;
+	return TRUE;
+}
+
+/**
+ * @brief Puts a standard data frame in FIFO 0 and raises the RX0 interrupt.
+ * FALSE if the FIFO was full, the frame is lost as a bxCAN overrun.
+ */
+BoolTypeDef Host_CAN1_Inject(uint32_t Id, uint8_t DLC, const uint8_t* Data)
+{
+	return Host_CAN1_Inject_Format(Id,CAN_ID_STD,CAN_RTR_DATA,DLC,Data);
+}
+
+/**
+ * @brief Any frame the bxCAN can receive: extended identifiers, remote frames
+ * and the DLC codes 9 to 15, which still carry 8 data bytes.
+ */
+BoolTypeDef Host_CAN1_Inject_Format(uint32_t Id, uint32_t IDE, uint32_t RTR, uint8_t DLC, const uint8_t* Data)
+{
+	if(Host_CAN1_FIFO_Count==HOST_CAN1_FIFO_SIZE)
+	{
+		Host_Statistics.CAN1_Rx_Overruns++;
+		return FALSE;
+	}
+	Host_CAN_FIFO_Slot_TypeDef* Slot=&Host_CAN1_FIFO[(Host_CAN1_FIFO_Head+Host_CAN1_FIFO_Count)%HOST_CAN1_FIFO_SIZE];
+
+	memset(Slot,0,sizeof(Host_CAN_FIFO_Slot_TypeDef));
+	Slot->IDE=(IDE==CAN_ID_STD) ? CAN_ID_STD : CAN_ID_EXT;
+	Slot->RTR=(RTR==CAN_RTR_DATA) ? CAN_RTR_DATA : CAN_RTR_REMOTE;
+	Slot->Frame.Id=Id & ((Slot->IDE==CAN_ID_STD) ? 0x7FFU : 0x1FFFFFFFU);
+	Slot->Frame.DLC=DLC & 0x0FU;
+	Slot->Frame.Tick=Host_Tick;
+	if(Data!=NULL && Slot->RTR==CAN_RTR_DATA)
+	{
+		memcpy(Slot->Frame.Data,Data,(Slot->Frame.DLC<8U) ? Slot->Frame.DLC : 8U);
+	}
+	Host_CAN1_FIFO_Count++;
+	Host_Interrupts_Service();
+	return TRUE;
+}
+
+BoolTypeDef Host_CAN1_Take(Host_CAN_Frame_TypeDef* Frame)
+{
+	if(Host_CAN1_Log_Count==0U)
+	{
+		return FALSE;
+	}
+	*Frame=Host_CAN1_Log[Host_CAN1_Log_Head];
+	Host_CAN1_Log_Head=(Host_CAN1_Log_Head+1U)%HOST_CAN1_LOG_SIZE;
+	Host_CAN1_Log_Count--;
+	return TRUE;
+}
+
+void Host_CAN1_Hold(BoolTypeDef Hold)
+{
+	Host_CAN1_Held=Hold;
+}
+
+// The frame the node puts on the bus next, FALSE if the mailboxes are empty
+BoolTypeDef Host_CAN1_Pending(Host_CAN_Frame_TypeDef* Frame)
+{
+	int32_t Next=Host_CAN1_First();
+
+	if(Next<0)
+	{
+		return FALSE;
+	}
+	*Frame=Host_CAN1_Mailbox[Next].Frame;
+	return TRUE;
+}
+
+// The pending frame won the arbitration and was acknowledged
+void Host_CAN1_Transmitted(void)
+{
+	int32_t Next=Host_CAN1_First();
+
+	if(Next>=0)
+	{
+		Host_CAN1_Complete(Next);
+	}
+}
+
+uint8_t Host_CAN1_Mailboxes_Busy(void)
+{
+	uint8_t Busy=0;
+
+	for(uint32_t i=0; i<HOST_CAN1_MAILBOXES; i++)
+	{
+		Busy+=(Host_CAN1_Mailbox[i].Used==TRUE) ? 1U : 0U;
+	}
+	return Busy;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Host FLASH	            				****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Programming can only clear bits and an erase sets the whole sector
+  * to 0xFF. Accesses out of the simulated memory stop the simulation, like a
+  * bus fault. After Host_Flash_Power_Cut the remaining operations are lost.
+  * @retval NOTHING
+  */
+static uint8_t* Host_Flash_Map(uint32_t address, uint32_t Length)
+{
+	if(address>=HOST_FLASH_BASE && address-HOST_FLASH_BASE<=HOST_FLASH_SIZE-Length)
+	{
+		return &Host_Flash[address-HOST_FLASH_BASE];
+	}
+	if(address>=HOST_SYSTEM_MEMORY_BASE && address-HOST_SYSTEM_MEMORY_BASE<=HOST_SYSTEM_MEMORY_SIZE-Length)
+	{
+		return &Host_System_Memory[address-HOST_SYSTEM_MEMORY_BASE];
+	}
+	Host_Error_Handler();
+	return NULL;
+}
+
+static BoolTypeDef Host_Flash_Powered(void)
+{
+	if(Host_Flash_Operations_Left==0U)
+	{
+		return FALSE;
+	}
+	if(Host_Flash_Operations_Left!=UINT32_MAX)
+	{
+		Host_Flash_Operations_Left--;
+	}
+	return TRUE;
+}
+
+uint32_t Host_Flash_Read_Word(uint32_t address)
+{
+	uint32_t Word=0xFFFFFFFFU;
+	const uint8_t* Memory=Host_Flash_Map(address,4);
+
+	if(Memory!=NULL)
+	{
+		memcpy(&Word,Memory,4);
+	}
+	return Word;
+}
+
+uint8_t Host_Flash_Read_Byte(uint32_t address)
+{
+	const uint8_t* Memory=Host_Flash_Map(address,1);
+
+	return (Memory!=NULL) ? *Memory : 0xFF;
+}
+
+void Host_Flash_Program_Byte(uint32_t address, uint8_t data)
+{
+	uint8_t* Memory=Host_Flash_Map(address,1);
+
+	if(Memory==NULL || address>=HOST_SYSTEM_MEMORY_BASE || Host_Flash_Powered()==FALSE)
+	{
+		return;
+	}
+	if((*Memory & data)!=data)
+	{
+		Host_Statistics.Flash_Program_Errors++;
+	}
+	*Memory&=data;
+	Host_Statistics.Flash_Programs++;
+}
+
+void Host_Flash_Program_Word(uint32_t address, uint32_t data)
+{
+	uint8_t* Memory=Host_Flash_Map(address,4);
+	uint32_t Word;
+
+	if(Memory==NULL || address>=HOST_SYSTEM_MEMORY_BASE || Host_Flash_Powered()==FALSE)
+	{
+		return;
+	}
+	memcpy(&Word,Memory,4);
+	if((Word & data)!=data)
+	{
+		Host_Statistics.Flash_Program_Errors++;
+	}
+	Word&=data;
+	memcpy(Memory,&Word,4);
+	Host_Statistics.Flash_Programs++;
+}
+
+void Host_Flash_Erase_Sector(uint32_t sector)
+{
+	if(sector>=HOST_FLASH_SECTORS)
+	{
+		Host_Error_Handler();
+		return;
+	}
+	if(Host_Flash_Powered()==FALSE)
+	{
+		return;
+	}
+	memset(&Host_Flash[Host_Flash_Sector_Offset[sector]],0xFF,Host_Flash_Sector_Offset[sector+1]-Host_Flash_Sector_Offset[sector]);
+	Host_Statistics.Flash_Erases++;
+}
+
+void Host_Flash_Erase_All(void)
+{
+	memset(Host_Flash,0xFF,sizeof(Host_Flash));
+	memset(Host_System_Memory,0xFF,sizeof(Host_System_Memory));
+	Host_Flash_Erased=TRUE;
+}
+
+/**
+ * @brief Writes the memory directly, as a programmer would, the unique ID too.
+ */
+void Host_Flash_Load(uint32_t address, const void* Data, uint32_t Length)
+{
+	uint8_t* Memory;
+
+	if(Host_Flash_Erased==FALSE)
+	{
+		Host_Flash_Erase_All();
+	}
+	Memory=Host_Flash_Map(address,Length);
+	if(Memory!=NULL)
+	{
+		memcpy(Memory,Data,Length);
+	}
+}
+
+/**
+ * @brief The given number of program and erase operations still complete,
+ * the ones after are lost until Host_Reset.
+ */
+void Host_Flash_Power_Cut(uint32_t Operations)
+{
+	Host_Flash_Operations_Left=Operations;
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Simulation Control	         		 ***************	
+********************************************************************************
+*******************************************************************************/
+/**
+ * @brief Power cycle of the platform: time, interrupts, GPIO and CAN start
+ * again, the flash and the attached SPI devices are kept. The application
+ * state is not touched, each test program boots the firmware once.
+ */
+void Host_Reset(void)
+{
+	memset(&Host_Statistics,0,sizeof(Host_Statistics));
+	Host_Stopped=FALSE;
+	Host_Time_us=0;
+	Host_Tick=0;
+	Host_Cycles=0;
+	Host_HCLK_MHz=HOST_LOW_POWER_HCLK_MHZ;
+	Host_Main_Pass_us=HOST_MAIN_PASS_US;
+	Host_PRIMASK=0;
+	Host_Running_Priority=HOST_THREAD_PRIORITY;
+	Host_TIM7_Pending=0;
+	Host_PendSV_Pending=FALSE;
+	Host_TIM7_Enabled=FALSE;
+	Host_C8=FALSE;
+	Host_C9=FALSE;
+	memset(Host_SPI_Selected,0,sizeof(Host_SPI_Selected));
+	memset(Host_CAN1_Mailbox,0,sizeof(Host_CAN1_Mailbox));
+	Host_CAN1_Order=0;
+	Host_CAN1_Held=FALSE;
+	Host_CAN1_FIFO_Head=0;
+	Host_CAN1_FIFO_Count=0;
+	Host_CAN1_Log_Head=0;
+	Host_CAN1_Log_Count=0;
+	Host_Flash_Operations_Left=UINT32_MAX;
+}
+
+/**
+ * @brief The main loop of main.c for Time_ms of virtual time. Each pass costs
+ * its own delays plus Host_Main_Pass_us, so the number of passes depends only
+ * on the code and the scenario and every run gives the same result.
+ */
+void Host_Run_ms(uint32_t Time_ms)
+{
+	uint64_t End=Host_Time_us+(uint64_t)Time_ms*1000U;
+	while(Host_Time_us<End && Host_Stopped==FALSE)
+	{
+		Control_Unit_Main_Task();
+		if(Host_Time_us<End)
+		{
+			uint64_t Left=End-Host_Time_us;
+			Host_Step_us((Left<Host_Main_Pass_us) ? (uint32_t)Left : Host_Main_Pass_us);
+		}
+	}
+}
+
+BoolTypeDef Host_Halted(void)
+{
+	return Host_Stopped;
+}
+
+const Host_Statistics_TypeDef* Host_Get_Statistics(void)
+{
+	return &Host_Statistics;
+}
+
+void Host_SPI_Attach(uint8_t SPI, const Host_SPI_Device_TypeDef* Device)
+{
+	if(SPI>=HOST_SPI_BUSES)
+	{
+		return;
+	}
+	if(Device!=NULL)
+	{
+		Host_SPI_Devices[SPI]=*Device;
+	}
+	else
+	{
+		memset(&Host_SPI_Devices[SPI],0,sizeof(Host_SPI_Device_TypeDef));
+	}
+}
+
+#endif
+
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Host.c
+  * @brief          : Host (PC) MCU backend: simulated GPIO, SPI, CAN, flash and time base
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
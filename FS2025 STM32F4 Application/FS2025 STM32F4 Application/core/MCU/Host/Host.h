@@ -0,0 +1,308 @@
+/**
+  ******************************************************************************
+  * @file           : Host.h
+  * @brief          : Host (PC) MCU backend header FILE
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
+
+#ifndef HOST_H
+#define HOST_H
+
+/*******************************************************************************
+********************************************************************************
+***************										 Includes                      ***************	
+********************************************************************************
+*******************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include "Common_Functions.h"
+
+
+/*******************************************************************************
+********************************************************************************
+***************								HAL Types	 		 	 		         ***************	
+********************************************************************************
+*******************************************************************************/
+// The subset of the STM32F4 HAL CAN types the application uses, same layout
+typedef enum
+{
+	DISABLE = 0U,
+	ENABLE = !DISABLE
+} FunctionalState;
+
+typedef struct
+{
+	uint32_t StdId;
+	uint32_t ExtId;
+	uint32_t IDE;
+	uint32_t RTR;
+	uint32_t DLC;
+	FunctionalState TransmitGlobalTime;
+} CAN_TxHeaderTypeDef;
+
+typedef struct
+{
+	uint32_t StdId;
+	uint32_t ExtId;
+	uint32_t IDE;
+	uint32_t RTR;
+	uint32_t DLC;
+	uint32_t Timestamp;
+	uint32_t FilterMatchIndex;
+} CAN_RxHeaderTypeDef;
+
+#define CAN_ID_STD		0x00000000U
+#define CAN_ID_EXT		0x00000004U
+#define CAN_RTR_DATA	0x00000000U
+#define CAN_RTR_REMOTE	0x00000002U
+
+// CMSIS intrinsic used outside the STM32F4 layer
+#define __CLZ(Value)	(((Value)==0U) ? 32U : (uint32_t)__builtin_clz(Value))
+
+
+/*******************************************************************************
+********************************************************************************
+***************							Error Hanlders Functions             ***************	
+********************************************************************************
+*******************************************************************************/
+void Host_Init_Error(void);
+void Host_Error_Handler(void);
+
+
+/*******************************************************************************
+********************************************************************************
+***************				GENERAL Peripherals Initialization         ***************	
+********************************************************************************
+*******************************************************************************/
+void 	Host_Init								(void);
+void 	Host_SPI1_Init					(void);
+void 	Host_SPI2_Init					(void);
+
+
+/*******************************************************************************
+********************************************************************************
+***************										SPI Transfers 	 		         ***************	
+********************************************************************************
+*******************************************************************************/
+#define HOST_SPI_1		0U
+#define HOST_SPI_2		1U
+#define HOST_SPI_BUSES	2U
+// Both buses run at PCLK/32 = 500 kHz in both clock profiles
+#define HOST_SPI_BYTE_US	16U
+
+BoolTypeDef Host_SPI_Transmit			(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout);
+BoolTypeDef Host_SPI_Receive			(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout);
+void 				Host_SPI_Chip_Select	(uint8_t SPI, BoolTypeDef Selected);
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Clock Profiles 	 		         ***************	
+********************************************************************************
+*******************************************************************************/
+// Same profiles as the STM32F4 layer
+#define HOST_LOW_POWER_HCLK_MHZ			16U
+#define HOST_HIGH_SPEED_HCLK_MHZ		64U
+
+void 			Host_Clock_Low_Power_Config		(void);
+void 			Host_Clock_High_Speed_Config	(void);
+uint32_t 	Host_Get_HCLK_MHz							(void);
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Time Base 	 		         		 ***************	
+********************************************************************************
+*******************************************************************************/
+uint32_t 	Host_Cycle_Counter_Get	(void);
+uint32_t 	Host_Get_Tick						(void);
+void 			Host_Delay							(uint32_t Delay_ms);
+void 			Host_Delay_us						(uint32_t Delay_us);
+
+
+/*******************************************************************************
+********************************************************************************
+***************							Interrupt Emulation 	 		         ***************	
+********************************************************************************
+*******************************************************************************/
+// Same levels as the STM32F4 plan, 0 is the most urgent. The handlers run when
+// they are pended outside a critical section and above the running level.
+#define HOST_CAN1_RX0_PRIORITY			4U
+#define HOST_TIM7_PRIORITY					5U
+#define HOST_PENDSV_PRIORITY				15U
+#define HOST_THREAD_PRIORITY				256U
+
+void 			Host_PendSV_Trigger			(void);
+void 			Host_Memory_Barrier			(void);
+uint32_t 	Host_Critical_Enter			(void);
+void 			Host_Critical_Exit			(uint32_t State);
+
+
+/*******************************************************************************
+********************************************************************************
+***************							OUTPUTS Initialization      		     ***************	
+********************************************************************************
+*******************************************************************************/
+void 	Host_GPIO_Init_C8_Output			(void);
+void 	Host_GPIO_Init_C9_Output			(void);
+void 	Host_GPIO_Write_C8_Output			(BoolTypeDef value);
+void 	Host_GPIO_Write_C9_Output			(BoolTypeDef value);
+
+
+/*******************************************************************************
+********************************************************************************
+***************											Host wdt	         				     ***************	
+********************************************************************************
+*******************************************************************************/
+void  Host_WDT_Refresh (void);
+
+
+/*******************************************************************************
+********************************************************************************
+***************										Host CAN 1                   ***************	
+********************************************************************************
+*******************************************************************************/
+// Same nominal rate as the STM32F4 layer, three mailboxes and a 3 deep FIFO 0
+#define HOST_CAN1_BITRATE				500000U
+#define HOST_CAN1_MAILBOXES			3U
+#define HOST_CAN1_FIFO_SIZE			3U
+
+BoolTypeDef Host_CAN1_Send	(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox);
+BoolTypeDef Host_CAN1_Read	(CAN_RxHeaderTypeDef* CAN_Header, uint8_t* Data);
+
+
+/*******************************************************************************
+********************************************************************************
+***************											FLASH                  		   ***************	
+********************************************************************************
+*******************************************************************************/
+// Main memory (sectors 0 to 7) and the system memory page with the unique ID
+#define HOST_FLASH_BASE						0x08000000U
+#define HOST_FLASH_SIZE						0x00080000U
+#define HOST_FLASH_SECTORS				8U
+#define HOST_SYSTEM_MEMORY_BASE		0x1FFF7800U
+#define HOST_SYSTEM_MEMORY_SIZE		0x00000400U
+
+uint32_t	Host_Flash_Read_Word			(uint32_t address);
+uint8_t		Host_Flash_Read_Byte			(uint32_t address);
+void			Host_Flash_Program_Byte		(uint32_t address, uint8_t data);
+void			Host_Flash_Program_Word		(uint32_t address, uint32_t data);
+void 			Host_Flash_Erase_Sector		(uint32_t sector);
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Simulation Control	         		 ***************	
+********************************************************************************
+*******************************************************************************/
+// Everything below is driven by the tests, the application never calls it
+
+// A device on a SPI bus: Select follows the chip select, Exchange gets each
+// byte clocked out on MOSI and gives the byte read on MISO
+typedef struct
+{
+	void*		Context;
+	void		(*Select)		(void* Context, BoolTypeDef Selected);
+	uint8_t	(*Exchange)	(void* Context, uint8_t Byte);
+} Host_SPI_Device_TypeDef;
+
+typedef struct
+{
+	uint32_t	Id;
+	uint8_t		DLC;
+	uint8_t		Data[8];
+	uint32_t	Tick;
+} Host_CAN_Frame_TypeDef;
+
+// Virtual time of one main loop pass besides its own delays
+#define HOST_MAIN_PASS_US				1000U
+
+#define HOST_CAN1_LOG_SIZE			256U
+// Data frames of 8 bytes take about 0.25 ms at 500 kbit/s
+#define HOST_CAN1_FRAMES_PER_MS	4U
+
+typedef struct
+{
+	uint32_t	Errors;
+	uint32_t	WDT_Refreshes;
+	uint32_t	SPI_Transfers[HOST_SPI_BUSES];
+	uint32_t	CAN1_Tx_Frames;
+	uint32_t	CAN1_Tx_Log_Lost;
+	uint32_t	CAN1_Rx_Overruns;
+	uint32_t	Flash_Erases;
+	uint32_t	Flash_Programs;
+	uint32_t	Flash_Program_Errors;
+	uint32_t	Clock_Switches;
+} Host_Statistics_TypeDef;
+
+void 			Host_Reset							(void);
+void 			Host_Step_us						(uint32_t Time_us);
+void 			Host_Advance_ms					(uint32_t Time_ms);
+uint64_t	Host_Get_Time_us				(void);
+void 			Host_Set_Main_Pass_us		(uint32_t Time_us);
+void 			Host_Run_ms							(uint32_t Time_ms);
+BoolTypeDef Host_Halted						(void);
+const Host_Statistics_TypeDef* Host_Get_Statistics	(void);
+
+void 			Host_SPI_Attach					(uint8_t SPI, const Host_SPI_Device_TypeDef* Device);
+
+BoolTypeDef Host_GPIO_Read_C8			(void);
+BoolTypeDef Host_GPIO_Read_C9			(void);
+
+BoolTypeDef Host_CAN1_Inject			(uint32_t Id, uint8_t DLC, const uint8_t* Data);
+BoolTypeDef Host_CAN1_Inject_Format	(uint32_t Id, uint32_t IDE, uint32_t RTR, uint8_t DLC, const uint8_t* Data);
+BoolTypeDef Host_CAN1_Take				(Host_CAN_Frame_TypeDef* Frame);
+void 			Host_CAN1_Hold					(BoolTypeDef Hold);
+uint8_t 	Host_CAN1_Mailboxes_Busy	(void);
+BoolTypeDef Host_CAN1_Pending			(Host_CAN_Frame_TypeDef* Frame);
+void 			Host_CAN1_Transmitted		(void);
+
+void 			Host_Flash_Erase_All		(void);
+void 			Host_Flash_Load					(uint32_t address, const void* Data, uint32_t Length);
+void 			Host_Flash_Power_Cut		(uint32_t Operations);
+
+
+#endif
+
+	/*****************************************************************************
+	** 																END OF FILE																**
+	******************************************************************************
+	******************************************************************************
+  * @file           : Host.h
+  * @brief          : Host (PC) MCU backend header FILE
+  ******************************************************************************
+  * @attention
+  *
+  * (c) 2025 Uniovi E-tech Racing.
+  *
+  *
+  ******************************************************************************
+  ******************************************************************************
+																Version Control
+	******************************************************************************
+	******************************************************************************
+  Version | dd mmm yyyy |       Who        | Description of changes
+  ========|=============|==================|====================================
+    1.0   | 19 OCT 2026 | E-tech Racing    | Creation
+	========|=============|==================|====================================
+
+  ******************************************************************************
+  ******************************************************************************
+  */
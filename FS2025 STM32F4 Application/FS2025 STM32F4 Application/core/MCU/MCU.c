@@ -47,6 +47,9 @@ void MCU_Init_Error(void)
 	#ifdef STM32F4_MCU
 		STM32F4_Init_Error();
 	#endif 
+	#ifdef HOST_MCU
+		Host_Init_Error();
+	#endif
 }
 
 
@@ -63,6 +66,9 @@ void MCU_Error_Handler(void)
   #ifdef STM32F4_MCU
 		STM32F4_Error_Handler();
 	#endif 				
+	#ifdef HOST_MCU
+		Host_Error_Handler();
+	#endif
 }
 
 
@@ -80,6 +86,9 @@ void MCU_GPIO_Init_C8_Output(void)
 	#ifdef STM32F4_MCU
 		STM32F4_GPIO_Init_C8_Output();
 	#endif
+	#ifdef HOST_MCU
+		Host_GPIO_Init_C8_Output();
+	#endif
 }
 
 
@@ -96,6 +105,9 @@ void MCU_GPIO_Init_C9_Output(void)
 	#ifdef STM32F4_MCU
 		STM32F4_GPIO_Init_C9_Output();
 	#endif
+	#ifdef HOST_MCU
+		Host_GPIO_Init_C9_Output();
+	#endif
 }
 
 
@@ -113,6 +125,9 @@ void MCU_GPIO_Write_C8_Output(BoolTypeDef value)
 	#ifdef STM32F4_MCU
 		STM32F4_GPIO_Write_C8_Output(value);
 	#endif
+	#ifdef HOST_MCU
+		Host_GPIO_Write_C8_Output(value);
+	#endif
 }
 
 
@@ -129,6 +144,9 @@ void MCU_GPIO_Write_C9_Output(BoolTypeDef value)
 	#ifdef STM32F4_MCU
 		STM32F4_GPIO_Write_C9_Output(value);
 	#endif
+	#ifdef HOST_MCU
+		Host_GPIO_Write_C9_Output(value);
+	#endif
 }
 
 
@@ -145,6 +163,9 @@ void MCU_Init(void)
 	#ifdef STM32F4_MCU
 		STM32F4_Init();
 	#endif
+	#ifdef HOST_MCU
+		Host_Init();
+	#endif
 }
 
 /*******************************************************************************
@@ -160,6 +181,9 @@ void MCU_SPI1_Init(void)
 	#ifdef STM32F4_MCU
 		STM32F4_SPI1_Init();
 	#endif
+	#ifdef HOST_MCU
+		Host_SPI1_Init();
+	#endif
 }
 
 /*******************************************************************************
@@ -175,6 +199,232 @@ void MCU_SPI2_Init(void)
 	#ifdef STM32F4_MCU
 		STM32F4_SPI2_Init();
 	#endif
+	#ifdef HOST_MCU
+		Host_SPI2_Init();
+	#endif
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************							MCU SPI TRANSFERS						 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Blocking SPI transfers, chip select is driven by the caller
+  * @retval TRUE if the transfer completed
+  */
+BoolTypeDef MCU_SPI_Transmit(MCU_SPI_TypeDef SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_SPI_Transmit((SPI==MCU_SPI_1) ? STM32F4_SPI_1 : STM32F4_SPI_2, Data, Length, Timeout);
+	#endif
+	#ifdef HOST_MCU
+		return Host_SPI_Transmit((SPI==MCU_SPI_1) ? HOST_SPI_1 : HOST_SPI_2, Data, Length, Timeout);
+	#endif
+}
+
+BoolTypeDef MCU_SPI_Receive(MCU_SPI_TypeDef SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_SPI_Receive((SPI==MCU_SPI_1) ? STM32F4_SPI_1 : STM32F4_SPI_2, Data, Length, Timeout);
+	#endif
+	#ifdef HOST_MCU
+		return Host_SPI_Receive((SPI==MCU_SPI_1) ? HOST_SPI_1 : HOST_SPI_2, Data, Length, Timeout);
+	#endif
+}
+
+void MCU_SPI_Chip_Select(MCU_SPI_TypeDef SPI, BoolTypeDef Selected)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_SPI_Chip_Select((SPI==MCU_SPI_1) ? STM32F4_SPI_1 : STM32F4_SPI_2, Selected);
+	#endif
+	#ifdef HOST_MCU
+		Host_SPI_Chip_Select((SPI==MCU_SPI_1) ? HOST_SPI_1 : HOST_SPI_2, Selected);
+	#endif
+}
+
+
+
+/*******************************************************************************
+********************************************************************************
+***************						MCU Low Power Clock Profile				 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Switches the core to the low power clock
+  * @retval NOTHING
+  */
+void MCU_Clock_Low_Power(void)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_SystemClock_Low_Power_Config();
+	#endif
+	#ifdef HOST_MCU
+		Host_Clock_Low_Power_Config();
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************						MCU High Speed Clock Profile			 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Switches the core to the high speed clock
+  * @retval NOTHING
+  */
+void MCU_Clock_High_Speed(void)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_SystemClock_High_Speed_Config();
+	#endif
+	#ifdef HOST_MCU
+		Host_Clock_High_Speed_Config();
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************							MCU Core Clock							     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Current core clock
+  * @retval Core clock in MHz
+  */
+uint32_t MCU_Get_Core_Clock_MHz(void)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_Get_HCLK_MHz();
+	#endif
+	#ifdef HOST_MCU
+		return Host_Get_HCLK_MHz();
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************									MCU Tick 									     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Milliseconds since boot
+  * @retval Tick in ms
+  */
+uint32_t MCU_Get_Tick(void)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_Get_Tick();
+	#endif
+	#ifdef HOST_MCU
+		return Host_Get_Tick();
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************							MCU Cycle Counter						     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Free running core cycle counter
+  * @retval Cycles
+  */
+uint32_t MCU_Cycle_Counter_Get(void)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_DWT_Get_Cycles();
+	#endif
+	#ifdef HOST_MCU
+		return Host_Cycle_Counter_Get();
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************									MCU Delay									     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Blocking delays, all application waits go through here
+  * @retval NOTHING
+  */
+void MCU_Delay(uint32_t Delay_ms)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_Delay(Delay_ms);
+	#endif
+	#ifdef HOST_MCU
+		Host_Delay(Delay_ms);
+	#endif
+}
+
+void MCU_Delay_us(uint32_t Delay_us)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_Delay_us(Delay_us);
+	#endif
+	#ifdef HOST_MCU
+		Host_Delay_us(Delay_us);
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************							MCU Deferred Work						     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Pends the lowest priority handler that runs the deferred work
+  * @retval NOTHING
+  */
+void MCU_Deferred_Trigger(void)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_PendSV_Trigger();
+	#endif
+	#ifdef HOST_MCU
+		Host_PendSV_Trigger();
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************							MCU Memory Barrier					     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Completes the previous memory accesses before the next ones
+  * @retval NOTHING
+  */
+void MCU_Memory_Barrier(void)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_Memory_Barrier();
+	#endif
+	#ifdef HOST_MCU
+		Host_Memory_Barrier();
+	#endif
+}
+
+/*******************************************************************************
+********************************************************************************
+***************							MCU Critical Section				     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Short sections shared by the main loop and the interrupts
+  * @retval State to give back to MCU_Critical_Exit
+  */
+uint32_t MCU_Critical_Enter(void)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_Critical_Enter();
+	#endif
+	#ifdef HOST_MCU
+		return Host_Critical_Enter();
+	#endif
+}
+
+void MCU_Critical_Exit(uint32_t State)
+{
+	#ifdef STM32F4_MCU
+		STM32F4_Critical_Exit(State);
+	#endif
+	#ifdef HOST_MCU
+		Host_Critical_Exit(State);
+	#endif
 }
 
 
@@ -185,13 +435,54 @@ void MCU_SPI2_Init(void)
 ********************************************************************************
 ********************************************************************************
   * @brief  SEND CAN MESSAGE TO CAN1
-  * @retval NOTHING
+  * @retval TRUE if a transmit mailbox took the frame
   */
-void MCU_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox)
+BoolTypeDef MCU_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox)
 {
 	#ifdef STM32F4_MCU
-		STM32F4_CAN1_Send(CAN_Header,Data,Mailbox);
+		return STM32F4_CAN1_Send(CAN_Header,Data,Mailbox);
 	 #endif
+	#ifdef HOST_MCU
+		return Host_CAN1_Send(CAN_Header,Data,Mailbox);
+	#endif
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									MCU CAN BUS READ					     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  READ CAN MESSAGE FROM CAN1 FIFO 0
+  * @retval TRUE if a frame was read
+  */
+BoolTypeDef MCU_CAN1_Read(CAN_RxHeaderTypeDef* CAN_Header, uint8_t* Data)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_CAN1_Read(CAN_Header,Data);
+	#endif
+	#ifdef HOST_MCU
+		return Host_CAN1_Read(CAN_Header,Data);
+	#endif
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************									MCU CAN BUS BITRATE				     *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Nominal CAN1 bit rate
+  * @retval bit/s
+  */
+uint32_t MCU_CAN1_Get_Bitrate(void)
+{
+	#ifdef STM32F4_MCU
+		return STM32F4_CAN1_BITRATE;
+	#endif
+	#ifdef HOST_MCU
+		return HOST_CAN1_BITRATE;
+	#endif
 }
 
 
@@ -210,6 +501,12 @@ void MCU_WDT_Refresh(void)
 	  STM32F4_WDT_Refresh();
 	}
 	#endif
+	#ifdef HOST_MCU
+	if(CONTROL_UNIT.Device.Reboot==FALSE)
+	{
+	  Host_WDT_Refresh();
+	}
+	#endif
 }
 
 /*******************************************************************************
@@ -226,6 +523,9 @@ uint8_t	MCU_Flash_Read_Byte	(uint32_t address)
 	#ifdef STM32F4_MCU
 		return STM32F4_Flash_Read_Byte	(address);
 	#endif 	
+	#ifdef HOST_MCU
+		return Host_Flash_Read_Byte	(address);
+	#endif
 }
 
 /*******************************************************************************
@@ -242,6 +542,9 @@ uint32_t	MCU_Flash_Read_Word	(uint32_t address)
 	#ifdef STM32F4_MCU
 		return STM32F4_Flash_Read_Word	(address);
 	#endif 	
+	#ifdef HOST_MCU
+		return Host_Flash_Read_Word	(address);
+	#endif
 }
 
 /*******************************************************************************
@@ -259,6 +562,9 @@ void	MCU_Flash_Program_Byte	(uint32_t address, uint8_t data)
 	#ifdef STM32F4_MCU
 		STM32F4_Flash_Program_Byte	(address,data);
 	#endif 	
+	#ifdef HOST_MCU
+		Host_Flash_Program_Byte	(address,data);
+	#endif
 }
 
 
@@ -277,6 +583,9 @@ void	MCU_Flash_Program_Word	(uint32_t address, uint32_t data)
 	#ifdef STM32F4_MCU
 		STM32F4_Flash_Program_Word	(address,data);
 	#endif 	
+	#ifdef HOST_MCU
+		Host_Flash_Program_Word	(address,data);
+	#endif
 }
 
 
@@ -294,6 +603,9 @@ void 	MCU_Flash_Erase_Sector	(uint32_t sector)
 	#ifdef STM32F4_MCU
 		STM32F4_Flash_Erase_Sector	(sector);
 	#endif 	
+	#ifdef HOST_MCU
+		Host_Flash_Erase_Sector	(sector);
+	#endif
 }
 
 
@@ -25,12 +25,28 @@
 #ifndef MCU_H
 #define MCU_H
 
+/*******************************************************************************
+********************************************************************************
+***************										 SPI Buses                     ***************	
+********************************************************************************
+*******************************************************************************/
+// Declared ahead of the includes, TypeDefs.h is reached again through them
+typedef enum
+{
+	MCU_SPI_1,
+	MCU_SPI_2
+} MCU_SPI_TypeDef;
+
 /*******************************************************************************
 ********************************************************************************
 ***************										 Includes                      ***************	
 ********************************************************************************
 *******************************************************************************/
-#include "STM32F4.h"
+#ifdef HOST_MCU
+	#include "Host.h"
+#else
+	#include "STM32F4.h"
+#endif
 #include "Common_Functions.H"
 #include "Control_Unit_Selection.h"
 
@@ -73,6 +89,41 @@ void 	MCU_Init				(void);
 void 	MCU_SPI1_Init		(void);
 void 	MCU_SPI2_Init		(void);
 
+
+/*******************************************************************************
+********************************************************************************
+***************											SPI	       		           	 ***************	
+********************************************************************************
+*******************************************************************************/
+BoolTypeDef MCU_SPI_Transmit			(MCU_SPI_TypeDef SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout);
+BoolTypeDef MCU_SPI_Receive				(MCU_SPI_TypeDef SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout);
+void 				MCU_SPI_Chip_Select		(MCU_SPI_TypeDef SPI, BoolTypeDef Selected);
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Clock Profiles	               ***************	
+********************************************************************************
+*******************************************************************************/
+void 			MCU_Clock_Low_Power				(void);
+void 			MCU_Clock_High_Speed			(void);
+uint32_t 	MCU_Get_Core_Clock_MHz		(void);
+
+
+/*******************************************************************************
+********************************************************************************
+***************										Time Base	  	             ***************	
+********************************************************************************
+*******************************************************************************/
+uint32_t 	MCU_Get_Tick							(void);
+uint32_t 	MCU_Cycle_Counter_Get			(void);
+void 			MCU_Delay									(uint32_t Delay_ms);
+void 			MCU_Delay_us							(uint32_t Delay_us);
+void 			MCU_Deferred_Trigger			(void);
+void 			MCU_Memory_Barrier				(void);
+uint32_t 	MCU_Critical_Enter				(void);
+void 			MCU_Critical_Exit					(uint32_t State);
+
 /*******************************************************************************
 ********************************************************************************
 ***************												wdt	             			     ***************	
@@ -86,7 +137,9 @@ void MCU_WDT_Refresh(void);
 ***************											CAN BUS	       		           ***************	
 ********************************************************************************
 *******************************************************************************/
-void MCU_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox);
+BoolTypeDef MCU_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox);
+BoolTypeDef MCU_CAN1_Read(CAN_RxHeaderTypeDef* CAN_Header, uint8_t* Data);
+uint32_t MCU_CAN1_Get_Bitrate(void);
 
 
 
@@ -117,6 +170,15 @@ void MCU_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Ma
 #define MCU_ADDRESS_APP										STM32F4_FLASH_SECTOR_5 
 #define MCU_ADDRESS_APP_BKUP							STM32F4_FLASH_SECTOR_6 
 
+// The backup sector is shared: the application keeps its copy of the data
+// sector words there at the same offsets, followed by a sequence, checksum
+// and marker word (BPCU_NVM_BACKUP_* in Battery_Pack_Control_Unit.h). A
+// bootloader using this sector must keep that layout or leave it alone.
+
+// Erase numbers, the HAL counts sectors from 0
+#define MCU_SECTOR_BOOTLOADER_DATA				1U
+#define MCU_SECTOR_BOOTLOADER_DATA_BKUP		2U
+
 
 /*******************************************************************************
 ********************************************************************************
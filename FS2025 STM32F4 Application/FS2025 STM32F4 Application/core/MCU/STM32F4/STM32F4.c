@@ -118,6 +118,232 @@ void STM32F4_SystemClock_Config(void)
 }
 
 
+/*******************************************************************************
+********************************************************************************
+***************        STM32F4 Low Power Clock Profile 			 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Runs the core from HSI (16 MHz) and switches the PLL off
+  * @retval NOTHING
+  */
+void STM32F4_SystemClock_Low_Power_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+	// Move SYSCLK back to HSI before the PLL can be stopped
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
+  {
+    STM32F4_Error_Handler();
+  }
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_OFF;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    STM32F4_Error_Handler();
+  }
+
+	STM32F4_TIM7_Sync_Prescaler();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        STM32F4 High Speed Clock Profile 		 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Runs the core from the PLL (HSI / 16 * 256 / 4 = 64 MHz)
+	*					APB1 and APB2 are divided by 4 to stay at 16 MHz
+  * @retval NOTHING
+  */
+void STM32F4_SystemClock_High_Speed_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLM = 16;
+  RCC_OscInitStruct.PLL.PLLN = 256;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV4;
+  RCC_OscInitStruct.PLL.PLLQ = 8;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    STM32F4_Error_Handler();
+  }
+
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV4;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK)
+  {
+    STM32F4_Error_Handler();
+  }
+
+	STM32F4_TIM7_Sync_Prescaler();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        STM32F4 TIM7 Prescaler Sync 					 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Keeps TIM7 counting at 1 MHz after a clock profile change
+	*					(APB1 timers run at 2 x PCLK1 when APB1 is divided)
+  * @retval NOTHING
+  */
+void STM32F4_TIM7_Sync_Prescaler(void)
+{
+	uint32_t Timer_Clock = HAL_RCC_GetPCLK1Freq();
+	if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_HCLK_DIV1)
+	{
+		Timer_Clock *= 2U;
+	}
+	
+	// UG loads the new prescaler at once, URS keeps it from raising an interrupt
+	uint32_t Counter = __HAL_TIM_GET_COUNTER(&STM32_TIM7);
+	__HAL_TIM_SET_PRESCALER(&STM32_TIM7, (Timer_Clock / 1000000U) - 1U);
+	STM32_TIM7.Instance->EGR = TIM_EGR_UG;
+	__HAL_TIM_SET_COUNTER(&STM32_TIM7, Counter);
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			STM32F4 HCLK in MHz 					 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Current core clock
+  * @retval HCLK in MHz
+  */
+uint32_t STM32F4_Get_HCLK_MHz(void)
+{
+	return HAL_RCC_GetHCLKFreq() / 1000000U;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        		STM32F4 DWT Cycle Counter 				 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Enables the DWT cycle counter
+  * @retval NOTHING
+  */
+void STM32F4_DWT_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t STM32F4_DWT_Get_Cycles(void)
+{
+	return DWT->CYCCNT;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			STM32F4 Tick 				 				 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Milliseconds since boot
+  * @retval HAL tick
+  */
+uint32_t STM32F4_Get_Tick(void)
+{
+	return HAL_GetTick();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			STM32F4 Delay 				 			 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Blocking delays, ms on the HAL tick and us on the DWT cycle counter
+  * @retval NOTHING
+  */
+void STM32F4_Delay(uint32_t Delay_ms)
+{
+	HAL_Delay(Delay_ms);
+}
+
+void STM32F4_Delay_us(uint32_t Delay_us)
+{
+	uint32_t Start=DWT->CYCCNT;
+	uint32_t Cycles=Delay_us*STM32F4_Get_HCLK_MHz();
+
+	while((DWT->CYCCNT-Start)<Cycles)
+	{
+	}
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			STM32F4 PendSV 				 			 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Requests the deferred work handler
+  * @retval NOTHING
+  */
+void STM32F4_PendSV_Trigger(void)
+{
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			STM32F4 Memory Barrier 				 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Orders memory accesses, also a compiler barrier
+  * @retval NOTHING
+  */
+void STM32F4_Memory_Barrier(void)
+{
+	__DMB();
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************        			STM32F4 Critical Section 			 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Masks every maskable interrupt, nests through the returned state
+  * @retval PRIMASK before entering
+  */
+uint32_t STM32F4_Critical_Enter(void)
+{
+	uint32_t State=__get_PRIMASK();
+	__disable_irq();
+	return State;
+}
+
+void STM32F4_Critical_Exit(uint32_t State)
+{
+	__set_PRIMASK(State);
+}
+
+
 
 
 /*******************************************************************************
@@ -208,6 +434,7 @@ void STM32F4_TIM7_Init(void)
   {
     STM32F4_Error_Handler();
   }
+	__HAL_TIM_URS_ENABLE(&STM32_TIM7);
 	__HAL_TIM_SET_COUNTER(&STM32_TIM7, 0);	 
 	__HAL_TIM_CLEAR_IT(&STM32_TIM7,TIM_IT_UPDATE);
 	HAL_TIM_Base_Start_IT(&STM32_TIM7);
@@ -333,6 +560,44 @@ void STM32F4_SPI2_Init(void)
   }
 }
 
+
+/*******************************************************************************
+********************************************************************************
+***************          	 	STM32F4 SPI TRANSFERS			 		 	 *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Blocking SPI transfers and manual chip select
+  * @retval TRUE if the transfer completed
+  */
+static SPI_HandleTypeDef* STM32F4_SPI_Handle(uint8_t SPI)
+{
+	return (SPI==STM32F4_SPI_1) ? &STM32_SPI1 : &STM32_SPI2;
+}
+
+BoolTypeDef STM32F4_SPI_Transmit(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout)
+{
+	return (HAL_SPI_Transmit(STM32F4_SPI_Handle(SPI), Data, Length, Timeout)==HAL_OK) ? TRUE : FALSE;
+}
+
+BoolTypeDef STM32F4_SPI_Receive(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout)
+{
+	return (HAL_SPI_Receive(STM32F4_SPI_Handle(SPI), Data, Length, Timeout)==HAL_OK) ? TRUE : FALSE;
+}
+
+void STM32F4_SPI_Chip_Select(uint8_t SPI, BoolTypeDef Selected)
+{
+	GPIO_PinState State=(Selected==TRUE) ? GPIO_PIN_RESET : GPIO_PIN_SET;
+
+	if(SPI==STM32F4_SPI_1)
+	{
+		HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, State);
+	}
+	else
+	{
+		HAL_GPIO_WritePin(GPIOA, GPIO_PIN_15, State);
+	}
+}
+
 /*******************************************************************************
 ********************************************************************************
 ***************		STM32F4 Initizalization Common interfaces		 *****************	
@@ -355,6 +620,10 @@ void STM32F4_Common_Init(void)
 	#endif
 	// Initialize timers
 	STM32F4_TIM7_Init();
+	STM32F4_DWT_Init();
+	
+	// Deferred work runs below every peripheral interrupt
+	HAL_NVIC_SetPriority(PendSV_IRQn, STM32F4_PENDSV_PRIORITY, 0);
 	
 	// Initialize CAN Module 1
 	STM32F4_CAN1_Init();	
@@ -417,15 +686,34 @@ void STM32F4_GPIO_Write_C9_Output(BoolTypeDef value)
 ***************						 STM32F4 CAN BUS SEND					       *****************	
 ********************************************************************************
 ********************************************************************************
-  * @brief  Initialzie CAN FOR STM32F4
-  * @retval NOTHING
+  * @brief  Hands one frame to a free transmit mailbox
+  * @retval FALSE if the three mailboxes are busy, the caller keeps the frame
+  */
+BoolTypeDef STM32F4_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox)
+{
+	if (HAL_CAN_GetTxMailboxesFreeLevel(&STM32_CAN1) == 0U || HAL_CAN_AddTxMessage(&STM32_CAN1, CAN_Header, Data, Mailbox) != HAL_OK)
+	{
+		return FALSE;
+	}
+	return TRUE;
+}
+
+
+/*******************************************************************************
+********************************************************************************
+***************						 STM32F4 CAN BUS READ					       *****************	
+********************************************************************************
+********************************************************************************
+  * @brief  Reads one frame from CAN 1 FIFO 0, called from the interrupt
+  * @retval TRUE if a frame was read
   */
-void STM32F4_CAN1_Send(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox)
+BoolTypeDef STM32F4_CAN1_Read(CAN_RxHeaderTypeDef* CAN_Header, uint8_t* Data)
 {
-	if (HAL_CAN_AddTxMessage(&STM32_CAN1, CAN_Header, Data, Mailbox) != HAL_OK)
+	if (HAL_CAN_GetRxMessage(&STM32_CAN1, CAN_RX_FIFO0, CAN_Header, Data) != HAL_OK)
 	{
-		STM32F4_Error_Handler ();
+		return FALSE;
 	}
+	return TRUE;
 }
 
 
@@ -68,6 +68,71 @@ void 	STM32F4_TIM7_Init								(void);
 void 	STM32F4_SPI1_Init								(void);
 void 	STM32F4_SPI2_Init								(void);
 
+
+/*******************************************************************************
+********************************************************************************
+***************										SPI Transfers 	 		         ***************	
+********************************************************************************
+*******************************************************************************/
+// SPI 1 is SPI1 with CS on PA4, SPI 2 is SPI3 with CS on PA15
+#define STM32F4_SPI_1		0U
+#define STM32F4_SPI_2		1U
+
+BoolTypeDef STM32F4_SPI_Transmit			(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout);
+BoolTypeDef STM32F4_SPI_Receive				(uint8_t SPI, uint8_t* Data, uint16_t Length, uint32_t Timeout);
+void 				STM32F4_SPI_Chip_Select		(uint8_t SPI, BoolTypeDef Selected);
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Clock Profiles 	 		         ***************	
+********************************************************************************
+*******************************************************************************/
+// Both profiles keep PCLK1 and PCLK2 at 16 MHz so CAN bit timing and SPI
+// prescalers never change; only TIM7 needs its prescaler re-synchronised.
+#define STM32F4_LOW_POWER_HCLK_MHZ		16U
+#define STM32F4_HIGH_SPEED_HCLK_MHZ		64U
+
+void 	STM32F4_SystemClock_Low_Power_Config		(void);
+void 	STM32F4_SystemClock_High_Speed_Config		(void);
+void 	STM32F4_TIM7_Sync_Prescaler							(void);
+uint32_t STM32F4_Get_HCLK_MHz									(void);
+
+
+/*******************************************************************************
+********************************************************************************
+***************									Time Base 	 		         		 ***************	
+********************************************************************************
+*******************************************************************************/
+void 			STM32F4_DWT_Init				(void);
+uint32_t 	STM32F4_DWT_Get_Cycles	(void);
+uint32_t 	STM32F4_Get_Tick				(void);
+void 			STM32F4_Delay						(uint32_t Delay_ms);
+void 			STM32F4_Delay_us				(uint32_t Delay_us);
+
+
+/*******************************************************************************
+********************************************************************************
+***************							Interrupt Priorities 	 		         ***************	
+********************************************************************************
+*******************************************************************************/
+// NVIC priority group 4 (set by HAL_Init), 0 is the most urgent level.
+//  2  SysTick   HAL time base, pre-empts everything that waits on HAL_GetTick
+//  4  CAN1 RX0  copies the frame to the receive queue and pends PendSV
+//  5  TIM7      counts the 1 ms tick and pends PendSV
+// 15  PendSV    deferred work: CAN dispatch, flash writes and software timers
+// Levels 0-1 are kept free for future hard real-time sources.
+// TICK_INT_PRIORITY in stm32f4xx_hal_conf.h must match STM32F4_SYSTICK_PRIORITY.
+#define STM32F4_SYSTICK_PRIORITY			2U
+#define STM32F4_CAN1_RX0_PRIORITY			4U
+#define STM32F4_TIM7_PRIORITY					5U
+#define STM32F4_PENDSV_PRIORITY				15U
+
+void 			STM32F4_PendSV_Trigger	(void);
+void 			STM32F4_Memory_Barrier	(void);
+uint32_t 	STM32F4_Critical_Enter	(void);
+void 			STM32F4_Critical_Exit		(uint32_t State);
+
 /*******************************************************************************
 ********************************************************************************
 ***************							OUTPUTS Initialization      		     ***************	
@@ -113,7 +178,11 @@ void  STM32F4_WDT_Refresh (void);
 ***************									STM32F4 CAN 1                    ***************	
 ********************************************************************************
 *******************************************************************************/
-void STM32F4_CAN1_Send	(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox);
+// PCLK1 16 MHz / Prescaler 2 / (1+13+2) tq
+#define STM32F4_CAN1_BITRATE	500000U
+
+BoolTypeDef STM32F4_CAN1_Send	(CAN_TxHeaderTypeDef* CAN_Header, uint8_t* Data , uint32_t* Mailbox);
+BoolTypeDef STM32F4_CAN1_Read	(CAN_RxHeaderTypeDef* CAN_Header, uint8_t* Data);
 
 
 
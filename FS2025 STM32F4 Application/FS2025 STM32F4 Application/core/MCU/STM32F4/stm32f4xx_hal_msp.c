@@ -79,7 +79,7 @@ void HAL_CAN_MspInit(CAN_HandleTypeDef* hcan)
     HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 		
 		//CAN1 interrupt Init
-		HAL_NVIC_SetPriority(CAN1_RX0_IRQn, 0, 0);
+		HAL_NVIC_SetPriority(CAN1_RX0_IRQn, STM32F4_CAN1_RX0_PRIORITY, 0);
     HAL_NVIC_EnableIRQ(CAN1_RX0_IRQn);
   }
 }
@@ -251,7 +251,7 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef* htim_base)
     __HAL_RCC_TIM7_CLK_ENABLE();
 		
     //TIM7 interrupt Init 
-    HAL_NVIC_SetPriority(TIM7_IRQn, 0, 0);
+    HAL_NVIC_SetPriority(TIM7_IRQn, STM32F4_TIM7_PRIORITY, 0);
     HAL_NVIC_EnableIRQ(TIM7_IRQn);
   }
 
@@ -32,6 +32,7 @@
 #include "stm32f4xx_it.h"
 #include "Control_Unit.h"
 #include "Can_Bus.h"
+#include "Profiler.h"
 
 
 
@@ -138,6 +139,9 @@ void DebugMon_Handler(void)
   */
 void PendSV_Handler(void)
 {
+	PROFILER_START(PROFILER_PENDSV);
+	Control_Unit_Deferred_Task();
+	PROFILER_STOP(PROFILER_PENDSV);
 }
 
 /*******************************************************************************
@@ -162,9 +166,10 @@ void SysTick_Handler(void)
   */
 void CAN1_RX0_IRQHandler(void)
 {
+	PROFILER_START(PROFILER_CAN1_RX0_IRQ);
 	HAL_CAN_IRQHandler(&STM32_CAN1);
-	HAL_CAN_GetRxMessage(&STM32_CAN1, CAN_RX_FIFO0, &CONTROL_UNIT.Rx_Message.Header, CONTROL_UNIT.Rx_Message.Data);
-	CAN1_Interrupt_DoTask();
+	CAN1_Interrupt_Capture();
+	PROFILER_STOP(PROFILER_CAN1_RX0_IRQ);
 }
 /*******************************************************************************
 ********************************************************************************
@@ -175,8 +180,10 @@ void CAN1_RX0_IRQHandler(void)
   */
 void TIM7_IRQHandler(void)
 {
+	PROFILER_START(PROFILER_TIM7_IRQ);
   HAL_TIM_IRQHandler(&STM32_TIM7);
-	Control_Unit_Timer_10ms_Interrupt();
+	Control_Unit_Timer_10ms_Capture();
+	PROFILER_STOP(PROFILER_TIM7_IRQ);
 }
 
 
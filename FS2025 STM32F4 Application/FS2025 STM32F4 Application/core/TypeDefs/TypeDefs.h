@@ -76,6 +76,16 @@ typedef struct
 
 } CAN_Tx_Message_TypeDef;
 
+#define CAN_TX_QUEUE_SIZE		16		//Power of two
+
+// Frames waiting for a free transmit mailbox, main loop only like every sender
+typedef struct
+{
+	CAN_Tx_Message_TypeDef			Messages[CAN_TX_QUEUE_SIZE];
+	uint8_t											Head;
+	uint8_t											Tail;
+} CAN_Tx_Queue_TypeDef;
+
 
 /*******************************************************************************
 ********************************************************************************
@@ -86,9 +96,40 @@ typedef struct
 {
 	CAN_RxHeaderTypeDef					Header;
 	uint8_t											Data[8];			//Data Array
+	uint32_t										Timestamp;		//ms tick at reception
 
 } CAN_Rx_Message_TypeDef;
 
+#define CAN_RX_QUEUE_SIZE		8		//Power of two
+
+// Single producer (CAN interrupt) single consumer (PendSV) queue
+typedef struct
+{
+	CAN_Rx_Message_TypeDef			Messages[CAN_RX_QUEUE_SIZE];
+	volatile uint8_t						Head;						//Written by the producer only
+	volatile uint8_t						Tail;						//Written by the consumer only
+	volatile uint32_t						Overflows;
+} CAN_Rx_Queue_TypeDef;
+
+#define CAN_BUS_LOAD_WINDOW_MS	1000
+
+// Bits are worst case stuffed frame lengths, including the interframe space
+typedef struct
+{
+	uint32_t										Tx_Frames;				//Written by the main loop only
+	uint32_t										Tx_Bits;
+	uint32_t										Tx_Dropped;				//Transmit queue full
+	uint8_t											Tx_Queue_Peak;		//Most frames waiting at once
+	volatile uint32_t						Rx_Frames;				//Written by the CAN interrupt only
+	volatile uint32_t						Rx_Bits;
+	volatile uint32_t						Rx_Read_Errors;		//FIFO read failed, overflows are counted by the queue
+	uint32_t										Rx_Rejected;			//Not standard data frames, written by the dispatch only
+	uint32_t										Window_Start_Tick;	//ms
+	uint32_t										Window_Start_Bits;
+	uint16_t										Load;							//per mille, last window
+	uint16_t										Peak_Load;				//per mille
+} CAN_Bus_Statistics_TypeDef;
+
 
 /*******************************************************************************
 ********************************************************************************
@@ -99,24 +140,28 @@ typedef struct
 {
 	Timer_10ms_TypeDef Status_Send_Timer;
 	Timer_10ms_TypeDef Temp_Send_Timer;
-	Timer_10ms_TypeDef Init_State_Timer;
 
 } Control_Unit_Time_TypeDef;
 
+// Cells and temperature sensors of a pack, 12 on each LTC6811
+#define BPCU_CHANNELS 24
+#define BPCU_CHANNEL_MASK 0x00FFFFFFUL		//One bit per channel
+
 /*******************************************************************************
 ********************************************************************************
 ***************									Estructura Temperratures				 ***************
 ********************************************************************************
 *******************************************************************************/
+// One array per field, the flags are masks with bit i for sensor i
 typedef struct
 {
-	float Actual_Value;
-	float Readed_Value;
-	uint8_t Cont_Fail;
-	BoolTypeDef Failed;
-	BoolTypeDef Disabled;
-	BoolTypeDef Hot;
-	
+	float Actual_Value[BPCU_CHANNELS];
+	float Readed_Value[BPCU_CHANNELS];
+	uint8_t Cont_Fail[BPCU_CHANNELS];
+	uint32_t Failed;
+	uint32_t Disabled;						//Complement of the activated sensors word in flash
+	uint32_t Hot;
+	uint32_t Stale;								//Not read on the last scan
 } Temperatures_Typedef;
 
 /*******************************************************************************
@@ -128,14 +173,13 @@ typedef enum
 {
 	NO_BALANCING,
 	EVEN_BALANCING,
+	CELL_BALANCING,						//Discharge of the balancing controller
 	ODD_BALANCING=255
 } Balancing_Status_TypeDef;
 
 
 typedef struct {
-    SPI_HandleTypeDef *SPI_Handler;
-    GPIO_TypeDef *CS_PORT;
-    uint16_t CS_PIN;
+    MCU_SPI_TypeDef SPI;
 		uint8_t Config[6];
     Balancing_Status_TypeDef Balancing;
 		BoolTypeDef Fail;
@@ -168,6 +212,45 @@ typedef enum
 	READ_RECEIVED,
 	READING
 } Read_Temperatures_Status_TypeDef;
+/*******************************************************************************
+********************************************************************************
+***************									  Acquisition			        		 	 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	ACQUISITION_IDLE,
+	ACQUISITION_WAKE,
+	ACQUISITION_CONFIG,				//Balancing of the phase, written and read back
+	ACQUISITION_SETTLE,
+	ACQUISITION_CONVERT,			//ADCV sent, PLADC polled once per call
+	ACQUISITION_READ,					//One register group per call, back to CONVERT while the sum check re-measures
+	ACQUISITION_DISABLE,
+	ACQUISITION_DONE,
+	ACQUISITION_FAILED
+} Acquisition_Step_TypeDef;
+
+#define ACQUISITION_EVEN_PHASE	0
+#define ACQUISITION_ODD_PHASE		1
+
+typedef struct
+{
+	Acquisition_Step_TypeDef Step;
+	uint8_t Phase;
+	BoolTypeDef ADC_Done_1;
+	BoolTypeDef ADC_Done_2;
+	uint32_t Start_Tick;					//ms
+	uint32_t Step_Tick;						//ms
+	uint32_t Last_Duration;				//ms, last complete acquisition
+	uint32_t Timeouts;
+	uint8_t Read;									//Next register group of the phase, the chips take turns
+	BoolTypeDef Read_Retry;				//Last read failed its PEC, tried once more
+	float Voltages_1[12];
+	float Voltages_2[12];
+	float Sum_Of_Cells[2];				//V, SC of the phase per chip
+} Acquisition_TypeDef;
+
+
 /*******************************************************************************
 ********************************************************************************
 ***************									  STATUS Struct			        		 ***************
@@ -175,18 +258,43 @@ typedef enum
 *******************************************************************************/
 typedef struct
 {
-	float Voltages[24];
-	Temperatures_Typedef Temperatures[24];
+	float Voltages[BPCU_CHANNELS];
+	uint32_t Voltages_Stale;			//Cells not stored on the last scan
+	Temperatures_Typedef Temperatures;
 	uint8_t Temperatures_Hot;
 	uint8_t Temperatures_Failed;
 	Control_Unit_Time_TypeDef Timing;
 	CAN_Message_TypeDef CAN_Message;
 	LTC6811_Typdef LTC6811_1;
 	LTC6811_Typdef LTC6811_2;
-	Read_Temperatures_Status_TypeDef Read_Temperatures;
+	volatile Read_Temperatures_Status_TypeDef Read_Temperatures;
 
 } Control_Unit_Status_Typdef;
 
+/*******************************************************************************
+********************************************************************************
+***************									  Snapshot			        		 		 ***************
+********************************************************************************
+*******************************************************************************/
+// Consistent copy of one scan, published once the checks are done
+typedef struct
+{
+	float Temperatures[BPCU_CHANNELS];
+	float Voltages[BPCU_CHANNELS];
+	uint32_t Voltages_Stale;
+	uint8_t Temperatures_Hot;
+	uint8_t Temperatures_Failed;
+	uint32_t Scan_Tick;						//ms
+	uint32_t Scan_Count;
+} Measurement_Snapshot_TypeDef;
+
+// Versioned double buffer: Buffer[Sequence&1] is the published one
+typedef struct
+{
+	Measurement_Snapshot_TypeDef Buffer[2];
+	volatile uint32_t Sequence;
+} Snapshot_TypeDef;
+
 /*******************************************************************************
 ********************************************************************************
 ***************									  enum    state				      		 ***************
@@ -202,6 +310,29 @@ typedef enum
 	TEMP_PLUS_60_FAIL_MODE
 } Control_Unit_State_Typdef;
 
+/*******************************************************************************
+********************************************************************************
+***************										 Startup				      				 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	STARTUP_WAKE,
+	STARTUP_CONFIG,
+	STARTUP_FIRST_SCAN,
+	STARTUP_DONE
+} Startup_Step_TypeDef;
+
+typedef struct
+{
+	Startup_Step_TypeDef									Step;
+	uint32_t															Step_Tick;						//ms
+	uint8_t																Attempts;
+	BoolTypeDef														Timed_Out;
+	uint32_t															Ready_Time;						//ms since boot
+	uint32_t															First_Frame_Time;			//ms since boot
+} Startup_TypeDef;
+
 /*******************************************************************************
 ********************************************************************************
 ***************											LED				      						 ***************
@@ -238,6 +369,496 @@ typedef struct
 		unsigned int														Blink_Rate;
 } Control_Unit_Led_Typedef;
 
+/*******************************************************************************
+********************************************************************************
+***************								Power Governor       				  		 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	POWER_PROFILE_LOW_POWER,
+	POWER_PROFILE_HIGH_SPEED
+} Power_Profile_TypeDef;
+
+typedef struct
+{
+	Power_Profile_TypeDef									Profile;
+	uint8_t																Burst_Depth;					//Nested burst requests
+	uint32_t															Profile_Start_Tick;		//ms
+	uint32_t															Time_Low_Power;				//ms
+	uint32_t															Time_High_Speed;			//ms
+	uint32_t															Switch_Count;
+	uint32_t															Last_Switch_Latency;	//us
+	uint32_t															Max_Switch_Latency;		//us
+} Power_Governor_TypeDef;
+
+/*******************************************************************************
+********************************************************************************
+***************									Profiler       				  		 		 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	PROFILER_CAN1_RX0_IRQ,
+	PROFILER_TIM7_IRQ,
+	PROFILER_MAIN_TASK,
+	PROFILER_MAIN_PERIOD,
+	PROFILER_PENDSV,
+	PROFILER_ENTRIES
+} Profiler_Entry_TypeDef;
+
+#define PROFILER_BUCKETS 24			//Bucket n holds 2^n to 2^(n+1)-1 cycles, the last one saturates
+
+typedef struct
+{
+	uint32_t															Count;
+	uint32_t															Max;									//cycles
+	uint32_t															Last;									//cycles
+	uint16_t															Histogram[PROFILER_BUCKETS];
+} Profiler_Record_TypeDef;
+
+/*******************************************************************************
+********************************************************************************
+***************									Benchmark       				  		 	 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	BENCHMARK_PEC15,
+	BENCHMARK_VOLTAGE_TO_TEMPERATURE,
+	BENCHMARK_ENCODE_TEMP,
+	BENCHMARK_ENCODE_VOLT,
+	BENCHMARK_CHECK_TEMPERATURES,
+	BENCHMARK_CHECK_FAILS,
+	BENCHMARK_CHANNEL_FILTER,							//DSP instructions when the core has them
+	BENCHMARK_CHANNEL_FILTER_PORTABLE,
+	BENCHMARK_KERNELS
+} Benchmark_Kernel_TypeDef;
+
+typedef struct
+{
+	uint32_t															Runs;
+	uint32_t															Min;									//cycles
+	uint32_t															Max;									//cycles
+	uint32_t															Total;								//cycles
+	uint32_t															Clock_MHz;						//Core clock of the run
+} Benchmark_Result_TypeDef;
+
+/*******************************************************************************
+********************************************************************************
+***************									Capture       				  		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+#define CAPTURE_RECORDS 128
+
+typedef enum
+{
+	CAPTURE_SPI_1,
+	CAPTURE_SPI_2,
+	CAPTURE_CAN_RX,
+	CAPTURE_CAN_TX
+} Capture_Source_TypeDef;
+
+// SPI flags, CAN records hold the DLC instead
+#define CAPTURE_FLAG_TRANSFER_OK	0x01
+#define CAPTURE_FLAG_READ					0x02		//Data is the response, otherwise the written payload
+#define CAPTURE_FLAG_PEC_OK				0x04
+
+typedef struct
+{
+	uint32_t															Timestamp;						//ms
+	uint8_t																Source;
+	uint8_t																Flags;
+	uint16_t															Id;										//SPI command or CAN identifier
+	uint8_t																Data[8];
+} Capture_Record_TypeDef;
+
+/*******************************************************************************
+********************************************************************************
+***************								Fault Injection       				  	 ***************
+********************************************************************************
+*******************************************************************************/
+#define FAULT_PEC_CORRUPTION	0x01		//Flips a bit of the received PEC
+#define FAULT_SPI_TIMEOUT			0x02		//Reports the transfer as failed
+#define FAULT_STUCK_ADC				0x04		//Drops the ADCV and ADCVSC commands, the registers keep the last result
+#define FAULT_WAKE						0x08		//Drops the wake up frame, the next read sees the idle bus (0xFF)
+#define FAULT_BIT_FLIP				0x10		//Flips one random bit of the received data
+
+typedef struct
+{
+	uint8_t																Armed;								//Fault bits
+	uint8_t																Remaining;						//Transactions still to corrupt
+	BoolTypeDef														Asleep;
+	uint32_t															Injected;
+	uint32_t															Random;
+} Fault_Injection_TypeDef;
+
+/*******************************************************************************
+********************************************************************************
+***************								Recovery       				  		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	RECOVERY_IDLE,
+	RECOVERY_BACKOFF,
+	RECOVERY_WAKE,
+	RECOVERY_CONFIG,
+	RECOVERY_SCAN
+} Recovery_Step_TypeDef;
+
+typedef struct
+{
+	Recovery_Step_TypeDef									Step;
+	uint32_t															Fail_Tick;						//ms, entry in LTC6811_FAIL_MODE
+	uint32_t															Step_Tick;						//ms
+	uint32_t															Attempts;
+	uint32_t															Recoveries;
+	uint32_t															Last_Time_To_Recover;	//ms
+	uint32_t															Max_Time_To_Recover;	//ms
+	volatile uint32_t											Missed_Scans;					//Measure requests refused in LTC6811_FAIL_MODE
+} Recovery_TypeDef;
+
+/*******************************************************************************
+********************************************************************************
+***************								Scan Scheduler       				  		 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	SCAN_BAND_SLOW,						//Cold and stable pack
+	SCAN_BAND_NORMAL,
+	SCAN_BAND_FAST,						//Close to the hot limit or heating fast
+	SCAN_BANDS
+} Scan_Band_TypeDef;
+
+typedef struct
+{
+	Scan_Band_TypeDef											Band;
+	uint32_t															Period[SCAN_BANDS];		//ms, from NVM, kept by Scan_Scheduler_Init
+
+	BoolTypeDef														Local_Scan;						//The running scan was started by the scheduler
+	volatile BoolTypeDef									Remote_Request;				//INIT_MEASURE received during a local scan
+	uint32_t															Last_Sequence;				//Last snapshot seen
+	uint32_t															Last_Scan_Tick;				//ms
+	float																	Max_Temperature;			//Enabled sensors, last scan
+	float																	Max_Rate;							//degC/s, enabled sensors, last scan
+	uint32_t															Scans[SCAN_BANDS];
+	uint32_t															Local_Scans;
+	uint8_t																Reports_Pending;			//SCAN_REPORT_* of the last scan still to send
+} Scan_Scheduler_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Filter Engine       				  		 ***************
+********************************************************************************
+*******************************************************************************/
+#define FILTER_MEDIAN_MAX								5
+#define FILTER_HISTORY_LENGTH						FILTER_MEDIAN_MAX		//Raw readings kept for the median window
+
+typedef enum
+{
+	FILTER_DEFAULT,							//0.5 degC deadband, smooths jumps to critical values
+	FILTER_IIR,									//First order low pass
+	FILTER_MEDIAN,							//Median of the last readings
+	FILTER_KALMAN,							//Scalar Kalman, constant temperature model
+	FILTER_RAW,									//Last reading as it is
+	FILTER_TYPES
+} Filter_Type_TypeDef;
+
+typedef struct
+{
+	uint8_t																Type[BPCU_CHANNELS];
+	uint32_t															Alpha[BPCU_CHANNELS/2];							//Q15, two channels per word
+	uint16_t															IIR_Alpha;													//Q15
+	uint8_t																Median_Length;
+	float																	Kalman_Q;														//Process noise, degC^2 per scan
+	float																	Kalman_R;														//Measurement noise, degC^2
+	float																	History[FILTER_HISTORY_LENGTH][BPCU_CHANNELS];
+	uint8_t																History_Head;
+	uint8_t																History_Count;
+	float																	Covariance[BPCU_CHANNELS];
+	uint32_t															Primed;															//Channels with a first reading
+} Filter_Engine_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Thermal Trend       				  		 ***************
+********************************************************************************
+*******************************************************************************/
+#define THERMAL_TREND_WINDOW						8			//Scans in the least squares fit
+#define THERMAL_TREND_NO_CHANNEL				0xFF
+
+// Running least squares sums over the window, times in s relative to the newest scan
+typedef struct
+{
+	float																	Temperatures[THERMAL_TREND_WINDOW][BPCU_CHANNELS];
+	uint32_t															Ticks[THERMAL_TREND_WINDOW];				//ms
+	uint8_t																Head;																//Next slot to write
+	uint8_t																Count;
+	uint32_t															Last_Tick;													//ms
+	float																	Sum_t;
+	float																	Sum_tt;
+	float																	Sum_T[BPCU_CHANNELS];
+	float																	Sum_tT[BPCU_CHANNELS];
+	float																	Slope[BPCU_CHANNELS];								//degC/s
+	uint16_t															Time_To_Limit[BPCU_CHANNELS];				//s, 0xFFFF never
+	uint8_t																Worst_Time_Channel;
+	uint8_t																Worst_Slope_Channel;
+	uint8_t																Channels_Warning;										//Under THERMAL_TREND_WARNING_S
+} Thermal_Trend_TypeDef;
+
+/*******************************************************************************
+********************************************************************************
+***************								Cell Statistics       				  	 ***************
+********************************************************************************
+*******************************************************************************/
+// Extremes and mean of one quantity over one scan
+typedef struct
+{
+	float																	Min;
+	float																	Max;
+	float																	Sum;
+	float																	Mean;
+	float																	Spread;								//Max-Min
+	uint8_t																Min_Channel;
+	uint8_t																Max_Channel;
+	uint8_t																Count;								//Valid channels
+} Cell_Stats_Scan_TypeDef;
+
+// Welford running mean and sum of squared deviations of one channel
+typedef struct
+{
+	uint32_t															Count;
+	float																	Mean;
+	float																	M2;
+} Cell_Stats_Lifetime_TypeDef;
+
+typedef struct
+{
+	Cell_Stats_Scan_TypeDef								Voltage;							//Scan in progress until Ready
+	Cell_Stats_Scan_TypeDef								Temperature;
+	BoolTypeDef														Ready;								//Both phases stored
+	Cell_Stats_Lifetime_TypeDef						Voltage_Lifetime[BPCU_CHANNELS];
+	Cell_Stats_Lifetime_TypeDef						Temperature_Lifetime[BPCU_CHANNELS];
+} Cell_Stats_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Balancing       				  		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	BALANCING_IDLE,						//No discharge, or paused by a measurement
+	BALANCING_WAKE,
+	BALANCING_WRITE,
+	BALANCING_ON
+} Balancing_Step_TypeDef;
+
+typedef struct
+{
+	Balancing_Step_TypeDef								Step;
+	volatile BoolTypeDef									Enabled;
+	volatile float												Threshold;						//V over the lowest cell
+	volatile float												Min_Voltage;					//V, lower cells are never discharged
+	uint32_t															Target;								//Cells to discharge after the next write
+	uint32_t															Active;								//Cells discharging
+	uint32_t															Inhibited;						//Resistor over the temperature limit
+	uint32_t															Last_Sequence;				//Last snapshot seen
+	uint32_t															Step_Tick;						//ms
+	uint32_t															Discharge_Time[BPCU_CHANNELS];	//ms
+	uint32_t															Write_Errors;
+	uint8_t																Time_Page;						//Next discharge time page sent
+	uint8_t																Reports_Pending;			//BALANCING_REPORT_* still to send
+} Balancing_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Open Wire       				  		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+typedef enum
+{
+	OPEN_WIRE_IDLE,
+	OPEN_WIRE_WAKE,
+	OPEN_WIRE_CONFIG,					//Discharge off, ADOW needs the inputs undisturbed
+	OPEN_WIRE_CONVERT,
+	OPEN_WIRE_WAIT,						//PLADC polled once per call
+	OPEN_WIRE_READ
+} Open_Wire_Step_TypeDef;
+
+typedef struct
+{
+	Open_Wire_Step_TypeDef								Step;
+	BoolTypeDef														Pull_Up;							//Current of the running conversions
+	uint8_t																Conversions;					//Done with the current pull
+	BoolTypeDef														Done_1;
+	BoolTypeDef														Done_2;
+	uint32_t															Period;								//ms between checks, 0 disabled
+	uint32_t															Start_Tick;						//ms, sequence start
+	uint32_t															Step_Tick;						//ms
+	uint32_t															Last_Check_Tick;			//ms, last complete sequence
+	float																	Pull_Up_Voltages[BPCU_CHANNELS];
+	float																	Pull_Down_Voltages[BPCU_CHANNELS];
+	uint32_t															Suspect;							//Cells open in the last check
+	uint32_t															Open;									//Cells open in two checks in a row
+	uint32_t															Checks;
+	uint32_t															Aborts;								//Sequences cut by a scan
+	uint32_t															Timeouts;
+	uint32_t															Last_Duration;				//ms
+} Open_Wire_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Self Test       				  		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+// One command and its read back per run, the runs take turns
+typedef enum
+{
+	SELF_TEST_RUN_CVST,				//Cell ADC digital filters
+	SELF_TEST_RUN_AXST,				//Auxiliary ADC digital filters
+	SELF_TEST_RUN_ADSTAT,			//Status group: sum of cells, die temperature, supplies
+	SELF_TEST_RUN_DIAGN,			//Multiplexer
+	SELF_TEST_RUNS
+} Self_Test_Run_TypeDef;
+
+// Checked values, one fail bit per item and chip
+typedef enum
+{
+	SELF_TEST_CVST,						//Registers not matching the pattern
+	SELF_TEST_AXST,
+	SELF_TEST_SUM_OF_CELLS,		//10 mV, not checked here
+	SELF_TEST_DIE_TEMPERATURE,	//0.1 degC
+	SELF_TEST_ANALOG_SUPPLY,	//mV
+	SELF_TEST_DIGITAL_SUPPLY,	//mV
+	SELF_TEST_MUX,						//MUXFAIL
+	SELF_TEST_THERMAL_SHUTDOWN,	//THSD
+	SELF_TEST_ITEMS
+} Self_Test_Item_TypeDef;
+
+typedef enum
+{
+	SELF_TEST_IDLE,
+	SELF_TEST_WAKE,
+	SELF_TEST_START,
+	SELF_TEST_WAIT,						//PLADC polled once per call
+	SELF_TEST_READ
+} Self_Test_Step_TypeDef;
+
+typedef struct
+{
+	Self_Test_Step_TypeDef								Step;
+	Self_Test_Run_TypeDef									Run;									//Next or running
+	uint8_t																Pattern;							//ST of the filter tests, 1 or 2
+	BoolTypeDef														Done_1;
+	BoolTypeDef														Done_2;
+	uint32_t															Step_Tick;						//ms
+	uint32_t															Last_Run_Tick;				//ms
+	int16_t																Value[SELF_TEST_ITEMS][2];	//Last result of each chip
+	uint8_t																Failing[2];						//Items failing the last check, per chip
+	uint8_t																Faults[2];						//Items failing two checks in a row
+	uint8_t																Revision[2];
+	uint8_t																Reports_Pending;			//Items of the last run still to send
+	float																	Sum_Of_Cells[2];			//V, last status conversion
+	uint32_t															Sum_Of_Cells_Tick;		//ms
+	uint32_t															Runs;
+	uint32_t															Aborts;								//Runs cut by a scan
+	uint32_t															Timeouts;
+	uint32_t															Fault_Count;					//Faults passed to the fail mode
+} Self_Test_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Sum Check       				  		 	 	 ***************
+********************************************************************************
+*******************************************************************************/
+#define SUM_CHECK_VOTES									3			//Readings of a phase when the first one is rejected
+
+typedef enum
+{
+	SUM_CHECK_STORE,									//Readings agree with SC, or the vote settled them
+	SUM_CHECK_REMEASURE,							//Convert the phase again
+	SUM_CHECK_DISCARD									//No majority, the phase is not stored
+} Sum_Check_Result_TypeDef;
+
+typedef struct
+{
+	float																	Tolerance;						//V, cells against SC, 0 disabled
+	uint8_t																Vote;									//Readings of the running phase
+	uint8_t																Discarded[2];					//Phases in a row without majority, per chip
+	float																	Readings[2][SUM_CHECK_VOTES][12];	//V, raw
+	float																	Sum_Of_Cells[2][SUM_CHECK_VOTES];	//V
+	float																	Error[2];							//V, cells minus SC of the last check
+	uint32_t															Checks;
+	uint32_t															Mismatches;						//Phases re-measured
+	uint32_t															Voted;								//Phases settled by the vote
+	uint32_t															Discards;							//Phases without majority
+	uint32_t															Disagreements;				//Cells whose first reading lost the vote
+	uint32_t															Faults;								//Chips passed to the fail mode
+} Sum_Check_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Calibration       				  		 	 ***************
+********************************************************************************
+*******************************************************************************/
+// Applied in the conversion: value*Gain+Offset
+typedef struct
+{
+	float																	Temperature_Gain[BPCU_CHANNELS];
+	float																	Temperature_Offset[BPCU_CHANNELS];		//degC
+	float																	Voltage_Gain[BPCU_CHANNELS];
+	float																	Voltage_Offset[BPCU_CHANNELS];				//V
+	uint8_t																Curve[BPCU_CHANNELS];									//Thermistor table
+	BoolTypeDef														Loaded;																//Read from NVM at startup
+	volatile BoolTypeDef									Pending;
+	uint8_t																Request[8];
+	BoolTypeDef														Save_Pending;
+	uint32_t															Saves;
+	uint32_t															Rejected;
+} Calibration_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								NVM       				  		 	 				 ***************
+********************************************************************************
+*******************************************************************************/
+typedef struct
+{
+	volatile BoolTypeDef									Sensors_Pending;			//Activated sensors changed by the CAN dispatch
+	uint32_t															Sequence;							//Of the last backup copy
+	uint32_t															Rewrites;							//Erases done through the backup copy
+	uint32_t															Restores;							//Data sector rebuilt from the copy at startup
+	volatile BoolTypeDef									Window;								//Write window opened by the master
+	volatile uint32_t											Window_Tick;
+	BoolTypeDef														Rewrite_Held;					//A save needing an erase waits for a window
+} NVM_TypeDef;
+
+
+/*******************************************************************************
+********************************************************************************
+***************								Diagnostics       				  		 	 ***************
+********************************************************************************
+*******************************************************************************/
+typedef struct
+{
+	volatile BoolTypeDef									Pending;
+	uint8_t																Request_DLC;
+	uint8_t																Request[8];
+	uint32_t															Invariant_Violations;
+	uint8_t																Invariant_Last;				//Failed invariant bits of the last violation
+} Diagnostics_TypeDef;
+
 /*******************************************************************************
 ********************************************************************************
 ***************							CAN CONTROL UNIT       				  		 ***************
@@ -253,6 +874,22 @@ typedef struct
 	Control_Unit_Status_Typdef						Status;
 	Control_Unit_Led_Typedef							Green_Led;
 	Control_Unit_Led_Typedef							Yellow_Led;
+	Power_Governor_TypeDef								Power_Governor;
+	Diagnostics_TypeDef										Diagnostics;
+	Snapshot_TypeDef											Snapshot;
+	Startup_TypeDef												Startup;
+	Recovery_TypeDef											Recovery;
+	Acquisition_TypeDef										Acquisition;
+	Scan_Scheduler_TypeDef								Scan_Scheduler;
+	Thermal_Trend_TypeDef									Thermal_Trend;
+	Filter_Engine_TypeDef									Filter_Engine;
+	Calibration_TypeDef										Calibration;
+	NVM_TypeDef														NVM;
+	Cell_Stats_TypeDef										Cell_Stats;
+	Balancing_TypeDef											Balancing;
+	Open_Wire_TypeDef											Open_Wire;
+	Self_Test_TypeDef											Self_Test;
+	Sum_Check_TypeDef											Sum_Check;
 	
 } Control_Unit_TypeDef;
 